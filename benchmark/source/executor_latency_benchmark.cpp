@@ -0,0 +1,113 @@
+/*
+    Measures the wake-up latency of single thread executors: the time from posting a task to an idle executor until the
+    task starts running. worker_thread_executor parks its thread and is woken up through a futex, busy_poll_executor
+    spins on its queue, once in its hot spin and once in its low power (pause based) spin.
+    The producer waits between samples, so every sample hits an idle executor.
+
+    usage: executor_latency_benchmark [sample count] [busy poll core] [producer core]   (default: 10000, not pinned)
+*/
+
+#include "concurrencpp/concurrencpp.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <optional>
+#include <algorithm>
+
+#include <cstdio>
+#include <cstdlib>
+
+using namespace std::chrono;
+
+namespace {
+    using clock_type = steady_clock;
+
+    void print(const char* name, std::vector<nanoseconds>& latencies) {
+        std::sort(latencies.begin(), latencies.end());
+
+        const auto percentile = [&latencies](double p) {
+            const auto index = std::min(latencies.size() - 1, static_cast<size_t>(p * static_cast<double>(latencies.size())));
+            return duration<double, std::micro>(latencies[index]).count();
+        };
+
+        std::printf("%-28s %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f\n",
+                    name,
+                    percentile(0.0),
+                    percentile(0.5),
+                    percentile(0.9),
+                    percentile(0.99),
+                    percentile(0.999),
+                    percentile(1.0));
+    }
+
+    std::vector<nanoseconds> measure(concurrencpp::executor& executor, size_t sample_count, nanoseconds idle_time) {
+        std::vector<nanoseconds> latencies;
+        latencies.reserve(sample_count);
+
+        for (size_t i = 0; i < sample_count; i++) {
+            std::atomic<clock_type::time_point::rep> start_time {0};
+            std::atomic_bool done {false};
+
+            const auto deadline = clock_type::now() + idle_time;
+            while (clock_type::now() < deadline) {
+                // spin instead of sleeping, so the wake-up of the producer doesn't add to the numbers
+            }
+
+            const auto post_time = clock_type::now();
+            executor.post([&] {
+                start_time.store(clock_type::now().time_since_epoch().count(), std::memory_order_relaxed);
+                done.store(true, std::memory_order_release);
+            });
+
+            while (!done.load(std::memory_order_acquire)) {
+                concurrencpp::details::thread::cpu_relax();
+            }
+
+            latencies.emplace_back(clock_type::duration(start_time.load(std::memory_order_relaxed)) - post_time.time_since_epoch());
+        }
+
+        return latencies;
+    }
+}  // namespace
+
+int main(int argc, char** argv) {
+    const size_t sample_count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 10'000;
+    const auto busy_poll_core = (argc > 2) ? std::optional<size_t>(std::strtoull(argv[2], nullptr, 10)) : std::nullopt;
+
+    if (argc > 3) {
+        concurrencpp::details::thread::pin_current_to_core(std::strtoull(argv[3], nullptr, 10));
+    }
+
+    std::printf("post to start latency of an idle executor (us), %zu samples\n", sample_count);
+    std::printf("%-28s %10s %10s %10s %10s %10s %10s\n", "executor", "min", "p50", "p90", "p99", "p99.9", "max");
+
+    const auto idle_time = microseconds(50);
+
+    {
+        concurrencpp::worker_thread_executor executor;
+        executor.post([] {
+        });  // starts the thread
+
+        auto latencies = measure(executor, sample_count, idle_time);
+        print("worker_thread_executor", latencies);
+        executor.shutdown();
+    }
+
+    {
+        concurrencpp::busy_poll_executor executor(busy_poll_core);
+        auto latencies = measure(executor, sample_count, idle_time);
+        print("busy_poll_executor", latencies);
+        executor.shutdown();
+    }
+
+    {
+        concurrencpp::busy_poll_executor executor(busy_poll_core, microseconds(10));
+        auto latencies = measure(executor, sample_count, idle_time);
+        print("busy_poll_executor (low power)", latencies);
+        executor.shutdown();
+    }
+
+    return 0;
+}
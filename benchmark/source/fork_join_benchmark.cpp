@@ -0,0 +1,109 @@
+/*
+    Measures the cost of recursive fork-join parallelism: a naive recursive fibonacci computed sequentially, with a
+    result<int> coroutine per recursion node (like test/source/thread_sanitizer/fibonacci.cpp) and with parallel_invoke,
+    for growing thread-pool sizes. parallel_invoke forks a node only when a worker is idle, so with a single worker it
+    should stay close to the sequential time, while the coroutine version pays a frame and a result state per node.
+
+    usage: fork_join_benchmark [n] [max pool size]   (default: 30 hardware_concurrency)
+*/
+
+#include "concurrencpp/concurrencpp.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include <cstdio>
+#include <cstdlib>
+
+using namespace std::chrono;
+
+namespace {
+    using clock_type = steady_clock;
+
+    int fibonacci_sequential(int n) noexcept {
+        return (n < 2) ? n : fibonacci_sequential(n - 1) + fibonacci_sequential(n - 2);
+    }
+
+    concurrencpp::result<int> fibonacci_coroutine(concurrencpp::executor_tag, std::shared_ptr<concurrencpp::thread_pool_executor> tpe, int n) {
+        if (n < 2) {
+            co_return n;
+        }
+
+        auto fib_1 = fibonacci_coroutine({}, tpe, n - 1);
+        auto fib_2 = fibonacci_coroutine({}, tpe, n - 2);
+        co_return co_await fib_1 + co_await fib_2;
+    }
+
+    int fibonacci_fork_join(const std::shared_ptr<concurrencpp::thread_pool_executor>& tpe, int n) {
+        if (n < 2) {
+            return n;
+        }
+
+        int fib_1 = 0, fib_2 = 0;
+        concurrencpp::parallel_invoke(
+            tpe,
+            [&] {
+                fib_1 = fibonacci_fork_join(tpe, n - 1);
+            },
+            [&] {
+                fib_2 = fibonacci_fork_join(tpe, n - 2);
+            });
+
+        return fib_1 + fib_2;
+    }
+
+    template<class function_type>
+    double measure_ms(function_type&& function, int expected) {
+        const auto start = clock_type::now();
+        const auto value = function();
+        const auto elapsed = duration<double, std::milli>(clock_type::now() - start).count();
+
+        if (value != expected) {
+            std::fprintf(stderr, "wrong result: expected %d, got %d\n", expected, value);
+            std::abort();
+        }
+
+        return elapsed;
+    }
+}  // namespace
+
+int main(int argc, char** argv) {
+    const int n = (argc > 1) ? std::atoi(argv[1]) : 30;
+    const size_t max_pool_size = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : std::max(1u, std::thread::hardware_concurrency());
+
+    const auto expected = fibonacci_sequential(n);
+    const auto sequential_ms = measure_ms(
+        [n] {
+            return fibonacci_sequential(n);
+        },
+        expected);
+
+    std::printf("fibonacci(%d), sequential: %.2f ms\n", n, sequential_ms);
+    std::printf("%-10s %16s %16s %16s\n", "pool size", "coroutines (ms)", "fork-join (ms)", "fork-join / seq");
+
+    for (size_t pool_size = 1; pool_size <= max_pool_size; pool_size *= 2) {
+        const auto tpe = std::make_shared<concurrencpp::thread_pool_executor>("fork_join_benchmark pool", pool_size, seconds(10));
+
+        const auto coroutine_ms = measure_ms(
+            [&] {
+                return fibonacci_coroutine({}, tpe, n).get();
+            },
+            expected);
+
+        const auto fork_join_ms = measure_ms(
+            [&] {
+                return tpe->submit([&] {
+                              return fibonacci_fork_join(tpe, n);
+                          })
+                    .get();
+            },
+            expected);
+
+        std::printf("%-10zu %16.2f %16.2f %16.2f\n", pool_size, coroutine_ms, fork_join_ms, fork_join_ms / sequential_ms);
+        tpe->shutdown();
+    }
+
+    return 0;
+}
@@ -0,0 +1,171 @@
+/*
+    Multiplies two square matrices of doubles with a result<double> coroutine per cell, and with the parallel
+    algorithms: parallel_for over the rows, and parallel_transform_reduce computing the trace of the product.
+    Every variant is checked against a sequential run.
+
+    usage: matrix_multiplication_benchmark [matrix size] [pool size]   (default: 512 hardware_concurrency)
+*/
+
+#include "concurrencpp/concurrencpp.h"
+
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace std::chrono;
+
+namespace {
+    using clock_type = steady_clock;
+
+    struct matrix {
+        size_t size;
+        std::vector<double> cells;
+
+        explicit matrix(size_t size) : size(size), cells(size * size, 0.0) {}
+
+        double& at(size_t row, size_t column) noexcept {
+            return cells[row * size + column];
+        }
+
+        double at(size_t row, size_t column) const noexcept {
+            return cells[row * size + column];
+        }
+    };
+
+    matrix make_random_matrix(size_t size, unsigned seed) {
+        std::default_random_engine generator(seed);
+        std::uniform_real_distribution<double> distribution(-5000.0, 5000.0);
+
+        matrix result(size);
+        for (auto& cell : result.cells) {
+            cell = distribution(generator);
+        }
+
+        return result;
+    }
+
+    double multiply_cell(const matrix& lhs, const matrix& rhs, size_t row, size_t column) noexcept {
+        auto result = 0.0;
+        for (size_t i = 0; i < lhs.size; i++) {
+            result += lhs.at(row, i) * rhs.at(i, column);
+        }
+
+        return result;
+    }
+
+    void multiply_row(const matrix& lhs, const matrix& rhs, matrix& product, size_t row) noexcept {
+        for (size_t column = 0; column < lhs.size; column++) {
+            product.at(row, column) = multiply_cell(lhs, rhs, row, column);
+        }
+    }
+
+    concurrencpp::result<double> multiply_cell_coroutine(concurrencpp::executor_tag,
+                                                         std::shared_ptr<concurrencpp::thread_pool_executor> tpe,
+                                                         const matrix& lhs,
+                                                         const matrix& rhs,
+                                                         size_t row,
+                                                         size_t column) {
+        co_return multiply_cell(lhs, rhs, row, column);
+    }
+
+    concurrencpp::result<void> multiply_coroutines(std::shared_ptr<concurrencpp::thread_pool_executor> tpe,
+                                                   const matrix& lhs,
+                                                   const matrix& rhs,
+                                                   matrix& product) {
+        std::vector<concurrencpp::result<double>> results;
+        results.reserve(lhs.size * lhs.size);
+
+        for (size_t row = 0; row < lhs.size; row++) {
+            for (size_t column = 0; column < lhs.size; column++) {
+                results.emplace_back(multiply_cell_coroutine({}, tpe, lhs, rhs, row, column));
+            }
+        }
+
+        for (size_t i = 0; i < results.size(); i++) {
+            product.cells[i] = co_await results[i];
+        }
+    }
+
+    template<class function_type>
+    double measure_ms(function_type&& function) {
+        const auto start = clock_type::now();
+        function();
+        return duration<double, std::milli>(clock_type::now() - start).count();
+    }
+
+    void check(const char* name, const matrix& expected, const matrix& product) {
+        if (expected.cells != product.cells) {
+            std::fprintf(stderr, "%s: wrong product\n", name);
+            std::abort();
+        }
+    }
+}  // namespace
+
+int main(int argc, char** argv) {
+    const size_t size = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 512;
+    const size_t pool_size = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : std::max(1u, std::thread::hardware_concurrency());
+
+    const auto lhs = make_random_matrix(size, 1);
+    const auto rhs = make_random_matrix(size, 2);
+    const auto tpe = std::make_shared<concurrencpp::thread_pool_executor>("matrix_multiplication_benchmark pool", pool_size, seconds(10));
+
+    matrix expected(size);
+    const auto sequential_ms = measure_ms([&] {
+        for (size_t row = 0; row < size; row++) {
+            multiply_row(lhs, rhs, expected, row);
+        }
+    });
+
+    matrix product(size);
+    const auto coroutines_ms = measure_ms([&] {
+        multiply_coroutines(tpe, lhs, rhs, product).get();
+    });
+
+    check("coroutine per cell", expected, product);
+
+    matrix parallel_for_product(size);
+    const auto parallel_for_ms = measure_ms([&] {
+        concurrencpp::parallel_for(tpe, size_t(0), size, [&](size_t row) {
+            multiply_row(lhs, rhs, parallel_for_product, row);
+        });
+    });
+
+    check("parallel_for", expected, parallel_for_product);
+
+    auto expected_trace = 0.0;
+    const auto sequential_trace_ms = measure_ms([&] {
+        for (size_t i = 0; i < size; i++) {
+            expected_trace += multiply_cell(lhs, rhs, i, i);
+        }
+    });
+
+    auto trace = 0.0;
+    const auto parallel_trace_ms = measure_ms([&] {
+        trace = concurrencpp::parallel_transform_reduce(tpe, size_t(0), size, 0.0, std::plus<> {}, [&](size_t i) {
+            return multiply_cell(lhs, rhs, i, i);
+        });
+    });
+
+    // the parallel sum may associate differently
+    if (std::abs(trace - expected_trace) > 1e-6 * std::max(1.0, std::abs(expected_trace))) {
+        std::fprintf(stderr, "parallel_transform_reduce: wrong trace\n");
+        std::abort();
+    }
+
+    std::printf("%zux%zu matrices, %zu workers\n", size, size, pool_size);
+    std::printf("%-34s %12s %12s\n", "variant", "time (ms)", "speedup");
+    std::printf("%-34s %12.2f %12.2f\n", "product, sequential", sequential_ms, 1.0);
+    std::printf("%-34s %12.2f %12.2f\n", "product, coroutine per cell", coroutines_ms, sequential_ms / coroutines_ms);
+    std::printf("%-34s %12.2f %12.2f\n", "product, parallel_for over rows", parallel_for_ms, sequential_ms / parallel_for_ms);
+    std::printf("%-34s %12.3f %12.2f\n", "trace, sequential", sequential_trace_ms, 1.0);
+    std::printf("%-34s %12.3f %12.2f\n", "trace, parallel_transform_reduce", parallel_trace_ms, sequential_trace_ms / parallel_trace_ms);
+
+    tpe->shutdown();
+    return 0;
+}
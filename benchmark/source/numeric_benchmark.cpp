@@ -0,0 +1,178 @@
+/*
+    Measures the memory bandwidth of the numeric reductions. The first table runs the kernels of every instruction set
+    the cpu supports on one thread, over an array that fits in L2 and over one that only fits in memory: vector kernels
+    should be much faster in cache, and close to what one core can pull from memory out of it. The second table runs
+    numeric::sum, dot and histogram on thread pools of growing sizes: the total bandwidth grows until the memory bus is
+    saturated, the bandwidth per worker drops from there on. Every result is checked against a sequential run.
+
+    usage: numeric_benchmark [array size in MB] [max pool size]   (default: 256 hardware_concurrency)
+*/
+
+#include "concurrencpp/concurrencpp.h"
+#include "concurrencpp/algorithms/impl/numeric_kernels.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include <cstdio>
+#include <cstdlib>
+
+using namespace std::chrono;
+
+namespace {
+    using clock_type = steady_clock;
+    using concurrencpp::numeric::instruction_set;
+
+    constexpr size_t k_repetitions = 5;
+    constexpr size_t k_bins = 16;
+    constexpr size_t k_cache_resident_size = 128 * 1024 / sizeof(float);  // fits in the L2 of any recent core
+
+    // the best of a few runs, in GB/s. function() processes bytes bytes.
+    template<class function_type>
+    double measure_bandwidth(size_t bytes, function_type&& function) {
+        auto best = duration<double>::max();
+        for (size_t i = 0; i < k_repetitions; i++) {
+            const auto start = clock_type::now();
+            function();
+            best = std::min<duration<double>>(best, clock_type::now() - start);
+        }
+
+        return static_cast<double>(bytes) / best.count() / 1e9;
+    }
+
+    void check(const char* name, bool correct) {
+        if (!correct) {
+            std::fprintf(stderr, "%s: wrong result\n", name);
+            std::abort();
+        }
+    }
+
+    struct expected_results {
+        double sum = 0;
+        double dot = 0;  // of the two halves of the array
+        std::vector<uint64_t> histogram = std::vector<uint64_t>(k_bins);
+    };
+
+    // small integers, sums and dot products are exact whichever way they're computed
+    expected_results fill(std::vector<float>& values) {
+        expected_results expected;
+        for (size_t i = 0; i < values.size(); i++) {
+            values[i] = static_cast<float>(i % k_bins);
+            expected.sum += values[i];
+            ++expected.histogram[i % k_bins];
+        }
+
+        const auto half = values.size() / 2;
+        for (size_t i = 0; i < half; i++) {
+            expected.dot += static_cast<double>(values[i]) * values[half + i];
+        }
+
+        return expected;
+    }
+
+    void run_kernels(const concurrencpp::details::numeric_kernels& kernels,
+                     const std::vector<float>& values,
+                     const expected_results& expected) {
+        const auto* const data = values.data();
+        const auto size = values.size();
+        const auto scale = 1.0f;  // k_bins bins over [0, k_bins)
+
+        // the cache resident array is summed over and over, as many bytes as the big one in total
+        const auto rounds = std::max<size_t>(1, size / k_cache_resident_size);
+        const auto in_cache = measure_bandwidth(rounds * k_cache_resident_size * sizeof(float), [&] {
+            double total = 0;
+            for (size_t i = 0; i < rounds; i++) {
+                total += kernels.sum_f32(data, k_cache_resident_size);
+            }
+
+            check("sum (cache)", total >= 0);
+        });
+
+        const auto in_memory = measure_bandwidth(size * sizeof(float), [&] {
+            check("sum", kernels.sum_f32(data, size) == expected.sum);
+        });
+
+        const auto dot = measure_bandwidth(size * sizeof(float), [&] {  // two halves of the array
+            check("dot", kernels.dot_f32(data, data + size / 2, size / 2) == expected.dot);
+        });
+
+        std::vector<uint64_t> bins(k_bins);
+        const auto histogram = measure_bandwidth(size * sizeof(float), [&] {
+            std::fill(bins.begin(), bins.end(), 0);
+            kernels.histogram_f32(data, size, 0.0f, static_cast<float>(k_bins), scale, bins.data(), k_bins);
+            check("histogram", bins == expected.histogram);
+        });
+
+        std::printf("%-10s %14.2f %14.2f %14.2f %14.2f\n",
+                    concurrencpp::numeric::instruction_set_name(kernels.isa),
+                    in_cache,
+                    in_memory,
+                    dot,
+                    histogram);
+    }
+
+    void run_pool(size_t pool_size, const std::vector<float>& values, const expected_results& expected) {
+        const auto tpe = std::make_shared<concurrencpp::thread_pool_executor>("numeric_benchmark pool", pool_size, seconds(10));
+        const std::span<const float> span(values);
+        const auto bytes = values.size() * sizeof(float);
+
+        const auto sum = measure_bandwidth(bytes, [&] {
+            check("numeric::sum", concurrencpp::numeric::sum(tpe, span) == expected.sum);
+        });
+
+        const auto half = span.size() / 2;
+        const auto dot = measure_bandwidth(bytes, [&] {
+            check("numeric::dot", concurrencpp::numeric::dot(tpe, span.first(half), span.subspan(half, half)) == expected.dot);
+        });
+
+        std::vector<uint64_t> bins(k_bins);
+        const auto histogram = measure_bandwidth(bytes, [&] {
+            concurrencpp::numeric::histogram(tpe, span, 0.0f, static_cast<float>(k_bins), bins);
+            check("numeric::histogram", bins == expected.histogram);
+        });
+
+        const auto workers = static_cast<double>(pool_size);
+        std::printf("%-10zu %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f\n",
+                    pool_size,
+                    sum,
+                    sum / workers,
+                    dot,
+                    dot / workers,
+                    histogram,
+                    histogram / workers);
+
+        tpe->shutdown();
+    }
+}  // namespace
+
+int main(int argc, char** argv) {
+    const size_t megabytes = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 256;
+    const size_t max_pool_size = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : std::max(1u, std::thread::hardware_concurrency());
+
+    std::vector<float> values(std::max<size_t>(k_cache_resident_size, megabytes * 1024 * 1024 / sizeof(float)));
+    const auto expected = fill(values);
+
+    std::printf("%zu MB of floats, active instruction set: %s\n",
+                values.size() * sizeof(float) / (1024 * 1024),
+                concurrencpp::numeric::instruction_set_name(concurrencpp::numeric::active_instruction_set()));
+
+    std::printf("\none thread, GB/s\n");
+    std::printf("%-10s %14s %14s %14s %14s\n", "kernels", "sum (L2)", "sum (memory)", "dot (memory)", "histogram");
+
+    for (const auto isa : {instruction_set::scalar, instruction_set::neon, instruction_set::avx2, instruction_set::avx512}) {
+        if (const auto* kernels = concurrencpp::details::numeric_kernels_of(isa)) {
+            run_kernels(*kernels, values, expected);
+        }
+    }
+
+    std::printf("\nthread pool, GB/s in total and per worker\n");
+    std::printf("%-10s %10s %10s %10s %10s %10s %10s\n", "workers", "sum", "/worker", "dot", "/worker", "histogram", "/worker");
+
+    for (size_t pool_size = 1; pool_size <= max_pool_size; pool_size *= 2) {
+        run_pool(pool_size, values, expected);
+    }
+
+    return 0;
+}
@@ -0,0 +1,138 @@
+/*
+    Sorts a vector of random 64 bit integers with std::sort, with std::sort(std::execution::par, ...) when the standard
+    library has a parallel backend, and with parallel_sort and parallel_stable_sort on thread-pools of growing sizes.
+    Also partitions the vector with std::partition and parallel_partition. Every result is checked.
+
+    usage: parallel_sort_benchmark [element count] [max pool size]   (default: 10000000 hardware_concurrency)
+*/
+
+#include "concurrencpp/concurrencpp.h"
+
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#if defined(CRCPP_BENCHMARK_PARALLEL_STL)
+#    include <execution>
+#endif
+
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+
+using namespace std::chrono;
+
+namespace {
+    using clock_type = steady_clock;
+
+    std::vector<uint64_t> make_random_vector(size_t size) {
+        std::mt19937_64 generator(2024);
+        std::vector<uint64_t> values(size);
+        for (auto& value : values) {
+            value = generator();
+        }
+
+        return values;
+    }
+
+    template<class function_type>
+    double measure_ms(const std::vector<uint64_t>& input, function_type&& function) {
+        auto values = input;
+
+        const auto start = clock_type::now();
+        function(values);
+        const auto elapsed = duration<double, std::milli>(clock_type::now() - start).count();
+
+        if (!std::is_sorted(values.begin(), values.end())) {
+            std::fprintf(stderr, "wrong result: the vector isn't sorted\n");
+            std::abort();
+        }
+
+        return elapsed;
+    }
+
+    bool is_even(uint64_t value) noexcept {
+        return value % 2 == 0;
+    }
+
+    template<class function_type>
+    double measure_partition_ms(const std::vector<uint64_t>& input, function_type&& function) {
+        auto values = input;
+
+        const auto start = clock_type::now();
+        const auto partition_point = function(values);
+        const auto elapsed = duration<double, std::milli>(clock_type::now() - start).count();
+
+        if (!std::all_of(values.begin(), partition_point, is_even) || !std::none_of(partition_point, values.end(), is_even)) {
+            std::fprintf(stderr, "wrong result: the vector isn't partitioned\n");
+            std::abort();
+        }
+
+        return elapsed;
+    }
+
+    void print(const char* name, size_t pool_size, double ms, double baseline_ms) {
+        std::printf("%-24s %10zu %12.2f %10.2f\n", name, pool_size, ms, baseline_ms / ms);
+    }
+}  // namespace
+
+int main(int argc, char** argv) {
+    const size_t size = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+    const size_t max_pool_size = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : std::max(1u, std::thread::hardware_concurrency());
+
+    const auto input = make_random_vector(size);
+
+    std::printf("%zu random uint64_t\n", size);
+    std::printf("%-24s %10s %12s %10s\n", "algorithm", "pool size", "time (ms)", "speedup");
+
+    const auto sort_ms = measure_ms(input, [](auto& values) {
+        std::sort(values.begin(), values.end());
+    });
+
+    print("std::sort", 1, sort_ms, sort_ms);
+
+#if defined(CRCPP_BENCHMARK_PARALLEL_STL)
+    const auto par_sort_ms = measure_ms(input, [](auto& values) {
+        std::sort(std::execution::par, values.begin(), values.end());
+    });
+
+    print("std::sort(par)", std::thread::hardware_concurrency(), par_sort_ms, sort_ms);
+#endif
+
+    for (size_t pool_size = 1; pool_size <= max_pool_size; pool_size *= 2) {
+        const auto tpe = std::make_shared<concurrencpp::thread_pool_executor>("parallel_sort_benchmark pool", pool_size, seconds(10));
+
+        const auto parallel_sort_ms = measure_ms(input, [&tpe](auto& values) {
+            concurrencpp::parallel_sort(tpe, values.begin(), values.end());
+        });
+
+        const auto parallel_stable_sort_ms = measure_ms(input, [&tpe](auto& values) {
+            concurrencpp::parallel_stable_sort(tpe, values.begin(), values.end());
+        });
+
+        print("parallel_sort", pool_size, parallel_sort_ms, sort_ms);
+        print("parallel_stable_sort", pool_size, parallel_stable_sort_ms, sort_ms);
+        tpe->shutdown();
+    }
+
+    const auto partition_ms = measure_partition_ms(input, [](auto& values) {
+        return std::partition(values.begin(), values.end(), is_even);
+    });
+
+    print("std::partition", 1, partition_ms, partition_ms);
+
+    for (size_t pool_size = 1; pool_size <= max_pool_size; pool_size *= 2) {
+        const auto tpe = std::make_shared<concurrencpp::thread_pool_executor>("parallel_sort_benchmark pool", pool_size, seconds(10));
+
+        const auto parallel_partition_ms = measure_partition_ms(input, [&tpe](auto& values) {
+            return concurrencpp::parallel_partition(tpe, values.begin(), values.end(), is_even);
+        });
+
+        print("parallel_partition", pool_size, parallel_partition_ms, partition_ms);
+        tpe->shutdown();
+    }
+
+    return 0;
+}
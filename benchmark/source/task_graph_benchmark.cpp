@@ -0,0 +1,181 @@
+/*
+    Measures the scheduling overhead of task_graph against the equivalent when_all code, on two shapes:
+    a binary tree where every node runs after its two children - a result<void> coroutine per node that awaits
+    when_all of its children, against a graph with an edge from every child to its parent - and a layered pipeline
+    where every node depends on two nodes of the layer before it. when_all can't share a result between two
+    dependents, so the when_all pipeline waits for a whole layer before submitting the next one.
+    The graph is built once and run again and again, the when_all code allocates its frames and states every time.
+
+    usage: task_graph_benchmark [tree depth] [pipeline width] [node work] [pool size]   (default: 12 64 0 hardware_concurrency)
+*/
+
+#include "concurrencpp/concurrencpp.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include <cstdio>
+#include <cstdlib>
+
+using namespace std::chrono;
+
+namespace {
+    using clock_type = steady_clock;
+    using concurrencpp::task_graph;
+    using concurrencpp::thread_pool_executor;
+
+    constexpr size_t k_repetitions = 10;
+    constexpr size_t k_pipeline_layers = 64;
+
+    std::atomic_size_t executed_nodes {0};
+    std::atomic_size_t work_sink {0};
+
+    // about work iterations of integer arithmetic the optimizer can't drop
+    void node_work(size_t work) noexcept {
+        size_t value = work;
+        for (size_t i = 0; i < work; i++) {
+            value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+        }
+
+        work_sink.store(value, std::memory_order_relaxed);
+        executed_nodes.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void check(const char* name, size_t expected_nodes) {
+        const auto executed = executed_nodes.exchange(0);
+        if (executed != expected_nodes) {
+            std::fprintf(stderr, "%s: %zu nodes executed, %zu expected\n", name, executed, expected_nodes);
+            std::abort();
+        }
+    }
+
+    // the best of a few runs, in milliseconds
+    template<class function_type>
+    double measure_ms(const char* name, size_t expected_nodes, function_type&& function) {
+        auto best = duration<double, std::milli>::max();
+        for (size_t i = 0; i < k_repetitions; i++) {
+            const auto start = clock_type::now();
+            function();
+            best = std::min<duration<double, std::milli>>(best, clock_type::now() - start);
+            check(name, expected_nodes);
+        }
+
+        return best.count();
+    }
+
+    concurrencpp::result<void> tree_node(concurrencpp::executor_tag, std::shared_ptr<thread_pool_executor> tpe, size_t depth, size_t work) {
+        if (depth != 0) {
+            co_await concurrencpp::when_all(tpe, tree_node({}, tpe, depth - 1, work), tree_node({}, tpe, depth - 1, work));
+        }
+
+        node_work(work);
+    }
+
+    // returns the root. node i of a level depends on nodes 2i and 2i + 1 of the level below it.
+    task_graph::node_id build_tree(task_graph& graph, size_t depth, size_t work) {
+        std::vector<task_graph::node_id> level;
+        for (size_t i = 0; i < (size_t(1) << depth); i++) {
+            level.emplace_back(graph.add_node([work] {
+                node_work(work);
+            }));
+        }
+
+        while (level.size() > 1) {
+            std::vector<task_graph::node_id> parents;
+            for (size_t i = 0; i < level.size(); i += 2) {
+                const auto parent = graph.add_node([work] {
+                    node_work(work);
+                });
+
+                graph.add_edge(level[i], parent);
+                graph.add_edge(level[i + 1], parent);
+                parents.emplace_back(parent);
+            }
+
+            level = std::move(parents);
+        }
+
+        return level[0];
+    }
+
+    void run_pipeline_when_all(const std::shared_ptr<thread_pool_executor>& tpe, size_t width, size_t work) {
+        std::vector<concurrencpp::result<void>> layer(width);
+        for (size_t l = 0; l < k_pipeline_layers; l++) {
+            for (auto& node : layer) {
+                node = tpe->submit([work] {
+                    node_work(work);
+                });
+            }
+
+            concurrencpp::when_all(tpe, layer.begin(), layer.end()).run().get();
+        }
+    }
+
+    // node i of a layer depends on nodes i and i + 1 (mod width) of the layer before it
+    void build_pipeline(task_graph& graph, size_t width, size_t work) {
+        std::vector<task_graph::node_id> previous, current;
+        for (size_t l = 0; l < k_pipeline_layers; l++) {
+            current.clear();
+            for (size_t i = 0; i < width; i++) {
+                current.emplace_back(graph.add_node([work] {
+                    node_work(work);
+                }));
+
+                if (!previous.empty()) {
+                    graph.add_edge(previous[i], current[i]);
+                    graph.add_edge(previous[(i + 1) % width], current[i]);
+                }
+            }
+
+            std::swap(previous, current);
+        }
+    }
+
+    void print_row(const char* shape, size_t nodes, double when_all_ms, double task_graph_ms) {
+        std::printf("%-10s %10zu %15.3f %15.3f %10.2fx\n", shape, nodes, when_all_ms, task_graph_ms, when_all_ms / task_graph_ms);
+    }
+}  // namespace
+
+int main(int argc, char** argv) {
+    const size_t depth = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 12;
+    const size_t width = (argc > 2) ? std::max<size_t>(1, std::strtoull(argv[2], nullptr, 10)) : 64;
+    const size_t work = (argc > 3) ? std::strtoull(argv[3], nullptr, 10) : 0;
+    const size_t pool_size = (argc > 4) ? std::strtoull(argv[4], nullptr, 10) : std::max(1u, std::thread::hardware_concurrency());
+
+    const auto tpe = std::make_shared<thread_pool_executor>("task_graph_benchmark pool", pool_size, seconds(10));
+
+    std::printf("%zu workers, %zu iterations of work per node, best of %zu runs\n", pool_size, work, k_repetitions);
+    std::printf("%-10s %10s %15s %15s %11s\n", "shape", "nodes", "when_all (ms)", "task_graph (ms)", "speedup");
+
+    const auto tree_nodes = (size_t(2) << depth) - 1;
+    const auto tree_when_all = measure_ms("when_all tree", tree_nodes, [&] {
+        tree_node({}, tpe, depth, work).get();
+    });
+
+    task_graph tree;
+    build_tree(tree, depth, work);
+    const auto tree_task_graph = measure_ms("task_graph tree", tree_nodes, [&] {
+        tree.run(tpe).get();
+    });
+
+    print_row("tree", tree_nodes, tree_when_all, tree_task_graph);
+
+    const auto pipeline_nodes = width * k_pipeline_layers;
+    const auto pipeline_when_all = measure_ms("when_all pipeline", pipeline_nodes, [&] {
+        run_pipeline_when_all(tpe, width, work);
+    });
+
+    task_graph pipeline;
+    build_pipeline(pipeline, width, work);
+    const auto pipeline_task_graph = measure_ms("task_graph pipeline", pipeline_nodes, [&] {
+        pipeline.run(tpe).get();
+    });
+
+    print_row("pipeline", pipeline_nodes, pipeline_when_all, pipeline_task_graph);
+
+    tpe->shutdown();
+    return 0;
+}
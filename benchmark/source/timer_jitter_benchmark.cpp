@@ -0,0 +1,135 @@
+/*
+    Measures how late timer_queue fires timers: the distribution of (fire time - deadline) for one-shot timers of
+    different due times, and of (interval - frequency) for a periodic timer. Callbacks run inline on the timer_queue thread,
+    so the numbers reflect the timer_queue alone and not the scheduling latency of an executor.
+
+    usage: timer_jitter_benchmark [sample count] [condition_variable | timerfd]   (default: 1000 condition_variable)
+*/
+
+#include "concurrencpp/concurrencpp.h"
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace std::chrono;
+
+namespace {
+    using clock_type = concurrencpp::timer_queue::clock_type;
+
+    void print(const char* name, std::vector<nanoseconds>& errors) {
+        std::sort(errors.begin(), errors.end());
+
+        const auto percentile = [&errors](double p) {
+            const auto index = std::min(errors.size() - 1, static_cast<size_t>(p * static_cast<double>(errors.size())));
+            return duration<double, std::micro>(errors[index]).count();
+        };
+
+        std::printf("%-22s %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f\n",
+                    name,
+                    percentile(0.0),
+                    percentile(0.5),
+                    percentile(0.9),
+                    percentile(0.99),
+                    percentile(0.999),
+                    percentile(1.0));
+    }
+
+    std::vector<nanoseconds> measure_one_shot(concurrencpp::timer_queue& timer_queue,
+                                              const std::shared_ptr<concurrencpp::executor>& executor,
+                                              nanoseconds due_time,
+                                              size_t sample_count) {
+        std::vector<nanoseconds> errors;
+        errors.reserve(sample_count);
+
+        for (size_t i = 0; i < sample_count; i++) {
+            std::atomic_bool fired {false};
+            clock_type::time_point fire_time;
+
+            const auto start = clock_type::now();
+            auto timer = timer_queue.make_one_shot_timer(due_time, executor, [&] {
+                fire_time = clock_type::now();
+                fired.store(true, std::memory_order_release);
+                fired.notify_one();
+            });
+
+            fired.wait(false, std::memory_order_acquire);
+            errors.emplace_back(fire_time - (start + due_time));
+        }
+
+        return errors;
+    }
+
+    std::vector<nanoseconds> measure_periodic(concurrencpp::timer_queue& timer_queue,
+                                              const std::shared_ptr<concurrencpp::executor>& executor,
+                                              nanoseconds frequency,
+                                              size_t sample_count) {
+        std::vector<clock_type::time_point> fire_times;
+        fire_times.reserve(sample_count + 1);
+        std::atomic_bool done {false};
+
+        auto timer = timer_queue.make_timer(frequency, frequency, executor, [&] {
+            if (fire_times.size() > sample_count) {
+                return;
+            }
+
+            fire_times.emplace_back(clock_type::now());
+            if (fire_times.size() > sample_count) {
+                done.store(true, std::memory_order_release);
+                done.notify_one();
+            }
+        });
+
+        done.wait(false, std::memory_order_acquire);
+        timer.cancel();
+
+        std::vector<nanoseconds> errors;
+        for (size_t i = 1; i < fire_times.size(); i++) {
+            errors.emplace_back((fire_times[i] - fire_times[i - 1]) - frequency);
+        }
+
+        return errors;
+    }
+}  // namespace
+
+int main(int argc, char** argv) {
+    const size_t sample_count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 1'000;
+
+    const auto backend = (argc > 2 && std::strcmp(argv[2], "timerfd") == 0) ? concurrencpp::timer_queue_backend::timerfd :
+                                                                              concurrencpp::timer_queue_backend::condition_variable;
+
+    const auto timer_queue = std::make_shared<concurrencpp::timer_queue>(seconds(60), nullptr, nullptr, 1, backend);
+    const auto executor = std::make_shared<concurrencpp::inline_executor>();
+
+    std::printf("fire time error (us), %s backend\n",
+                (backend == concurrencpp::timer_queue_backend::timerfd) ? "timerfd" : "condition_variable");
+    std::printf("%-22s %10s %10s %10s %10s %10s %10s\n", "timer", "min", "p50", "p90", "p99", "p99.9", "max");
+
+    const nanoseconds due_times[] = {50us, 250us, 1ms, 10ms};
+    for (const auto due_time : due_times) {
+        char name[64];
+        std::snprintf(name, sizeof(name), "one-shot %lldus", static_cast<long long>(duration_cast<microseconds>(due_time).count()));
+
+        // long due times are sampled less, so every row takes about the same time
+        const auto samples = std::max<size_t>(10, std::min<size_t>(sample_count, seconds(5) / std::max<nanoseconds>(due_time, 1ms)));
+        auto errors = measure_one_shot(*timer_queue, executor, due_time, samples);
+        print(name, errors);
+    }
+
+    const nanoseconds frequencies[] = {100us, 500us, 1ms};
+    for (const auto frequency : frequencies) {
+        char name[64];
+        std::snprintf(name, sizeof(name), "periodic %lldus", static_cast<long long>(duration_cast<microseconds>(frequency).count()));
+
+        auto errors = measure_periodic(*timer_queue, executor, frequency, sample_count);
+        print(name, errors);
+    }
+
+    timer_queue->shutdown();
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*
+    Measures the add/cancel throughput of timer_queue under contention: every thread creates one-shot timers that are
+    far in the future and cancels them right away, so the timer thread never fires anything and only drains requests.
+    Runs once with a single shard, where all the threads share one request list, and once with a shard per thread.
+
+    usage: timer_queue_contention_benchmark [thread count] [timers per thread]   (default: 32 100000)
+*/
+
+#include "concurrencpp/concurrencpp.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <cstdio>
+#include <cstdlib>
+
+using namespace std::chrono;
+
+namespace {
+    double measure(size_t shard_count, size_t thread_count, size_t timers_per_thread) {
+        const auto timer_queue = std::make_shared<concurrencpp::timer_queue>(seconds(60), nullptr, nullptr, shard_count);
+        const auto executor = std::make_shared<concurrencpp::inline_executor>();
+
+        std::atomic_size_t ready {0};
+        std::atomic_bool go {false};
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count);
+
+        for (size_t i = 0; i < thread_count; i++) {
+            threads.emplace_back([&] {
+                ready.fetch_add(1, std::memory_order_relaxed);
+                while (!go.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+
+                for (size_t j = 0; j < timers_per_thread; j++) {
+                    auto timer = timer_queue->make_one_shot_timer(hours(1), executor, [] {
+                    });
+                    timer.cancel();
+                }
+            });
+        }
+
+        while (ready.load(std::memory_order_relaxed) != thread_count) {
+            std::this_thread::yield();
+        }
+
+        const auto start = steady_clock::now();
+        go.store(true, std::memory_order_release);
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        const auto elapsed = duration<double>(steady_clock::now() - start).count();
+
+        timer_queue->shutdown();
+        executor->shutdown();
+
+        // every timer is one add and one cancel
+        return static_cast<double>(2 * thread_count * timers_per_thread) / elapsed;
+    }
+}  // namespace
+
+int main(int argc, char** argv) {
+    const size_t thread_count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 32;
+    const size_t timers_per_thread = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : 100'000;
+
+    std::printf("%zu threads, %zu timers per thread\n", thread_count, timers_per_thread);
+    std::printf("%-10s %16s\n", "shards", "ops/sec");
+
+    for (const auto shard_count : {size_t(1), thread_count}) {
+        std::printf("%-10zu %16.0f\n", shard_count, measure(shard_count, thread_count, timers_per_thread));
+    }
+
+    return 0;
+}
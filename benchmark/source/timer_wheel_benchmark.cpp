@@ -0,0 +1,203 @@
+/*
+    Compares the timing wheel of timer_queue against the std::multiset + std::unordered_map queue it replaced.
+    For every timer count: adds the timers with random deadlines, cancels half of them and drains the rest
+    by advancing a simulated clock one millisecond at a time.
+
+    usage: timer_wheel_benchmark [timer count...]   (default: 1000 100000 10000000)
+*/
+
+#include "concurrencpp/concurrencpp.h"
+#include "concurrencpp/timers/impl/timer_wheel.h"
+
+#include <set>
+#include <random>
+#include <chrono>
+#include <vector>
+#include <iostream>
+#include <unordered_map>
+
+#include <cstdio>
+#include <cstdlib>
+
+using namespace std::chrono;
+
+using concurrencpp::details::timer_wheel;
+using concurrencpp::details::timer_state;
+using concurrencpp::details::timer_state_base;
+
+using timer_ptr = std::shared_ptr<timer_state_base>;
+using clock_time_point = timer_state_base::time_point;
+
+namespace {
+    // the previous timer_queue implementation, kept here as a baseline.
+    class multiset_timer_queue {
+
+        struct deadline_comparator {
+            bool operator()(const timer_ptr& a, const timer_ptr& b) const noexcept {
+                return a->get_deadline() < b->get_deadline();
+            }
+        };
+
+        using timer_set = std::multiset<timer_ptr, deadline_comparator>;
+        using iterator_map = std::unordered_map<timer_ptr, timer_set::iterator>;
+
+       private:
+        timer_set m_timers;
+        iterator_map m_iterator_mapper;
+
+       public:
+        explicit multiset_timer_queue(clock_time_point) noexcept {}
+
+        void add(timer_ptr timer) {
+            auto timer_it = m_timers.emplace(timer);
+            m_iterator_mapper.emplace(std::move(timer), timer_it);
+        }
+
+        void remove(const timer_ptr& timer) {
+            const auto timer_it = m_iterator_mapper.find(timer);
+            if (timer_it == m_iterator_mapper.end()) {
+                return;
+            }
+
+            m_timers.erase(timer_it->second);
+            m_iterator_mapper.erase(timer_it);
+        }
+
+        clock_time_point process_timers(clock_time_point now) {
+            while (!m_timers.empty()) {
+                auto first_timer_it = m_timers.begin();
+                auto timer = *first_timer_it;
+                if (!timer->expired(now)) {
+                    break;
+                }
+
+                auto timer_node = m_timers.extract(first_timer_it);
+                timer_set temp_set;
+                auto temp_it = temp_set.insert(std::move(timer_node));
+
+                const auto cancelled = timer->cancelled();
+                if (!cancelled) {
+                    (*temp_it)->fire();
+                }
+
+                if (timer->is_oneshot() || cancelled) {
+                    m_iterator_mapper.erase(timer);
+                    continue;
+                }
+
+                timer_node = temp_set.extract(temp_it);
+                m_iterator_mapper[timer] = m_timers.insert(std::move(timer_node));
+            }
+
+            return m_timers.empty() ? now + hours(24) : (**m_timers.begin()).get_deadline();
+        }
+
+        bool empty() const noexcept {
+            return m_timers.empty();
+        }
+    };
+
+    struct counting_callback {
+        size_t* counter;
+
+        void operator()() const noexcept {
+            ++(*counter);
+        }
+    };
+
+    struct measurement {
+        double add_ms, remove_ms, drain_ms;
+        size_t fired;
+    };
+
+    constexpr size_t k_span_ms = 10'000;
+
+    double elapsed_ms(steady_clock::time_point begin) {
+        return duration<double, std::milli>(steady_clock::now() - begin).count();
+    }
+
+    template<class queue_type>
+    measurement run(size_t timer_count, const std::shared_ptr<concurrencpp::executor>& executor) {
+        std::mt19937_64 engine(timer_count);
+        std::uniform_int_distribution<size_t> due_time_distribution(1, k_span_ms);
+
+        size_t fired = 0;
+        std::vector<timer_ptr> timers;
+        timers.reserve(timer_count);
+
+        for (size_t i = 0; i < timer_count; i++) {
+            timers.emplace_back(std::make_shared<timer_state<counting_callback>>(milliseconds(due_time_distribution(engine)),
+                                                                                 nanoseconds::zero(),
+                                                                                 executor,
+                                                                                 std::weak_ptr<concurrencpp::timer_queue> {},
+                                                                                 true,
+                                                                                 counting_callback {&fired}));
+        }
+
+        // every deadline is reached by draining k_span_ms past this point
+        const auto origin = timer_state_base::clock_type::now();
+        queue_type queue(origin);
+        measurement result {};
+
+        auto begin = steady_clock::now();
+        for (auto& timer : timers) {
+            queue.add(timer);
+        }
+        result.add_ms = elapsed_ms(begin);
+
+        begin = steady_clock::now();
+        for (size_t i = 0; i < timers.size(); i += 2) {
+            timers[i]->cancel();
+            queue.remove(timers[i]);
+        }
+        result.remove_ms = elapsed_ms(begin);
+
+        timers.clear();
+
+        begin = steady_clock::now();
+        for (size_t ms = 0; ms <= k_span_ms + 1; ms++) {
+            queue.process_timers(origin + milliseconds(ms));
+        }
+        result.drain_ms = elapsed_ms(begin);
+        result.fired = fired;
+
+        if (!queue.empty()) {
+            std::cerr << "timers were left in the queue" << std::endl;
+            std::abort();
+        }
+
+        return result;
+    }
+
+    void print(const char* name, size_t timer_count, const measurement& result) {
+        std::printf("%-10s %12zu %12.2f %12.2f %12.2f %12.1f\n",
+                    name,
+                    timer_count,
+                    result.add_ms,
+                    result.remove_ms,
+                    result.drain_ms,
+                    (result.add_ms + result.remove_ms + result.drain_ms) * 1'000'000.0 / static_cast<double>(timer_count));
+    }
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::vector<size_t> timer_counts;
+    for (int i = 1; i < argc; i++) {
+        timer_counts.emplace_back(std::strtoull(argv[i], nullptr, 10));
+    }
+
+    if (timer_counts.empty()) {
+        timer_counts = {1'000, 100'000, 10'000'000};
+    }
+
+    const auto executor = std::make_shared<concurrencpp::inline_executor>();
+
+    std::printf("%-10s %12s %12s %12s %12s %12s\n", "queue", "timers", "add (ms)", "cancel (ms)", "drain (ms)", "ns/timer");
+
+    for (const auto timer_count : timer_counts) {
+        print("multiset", timer_count, run<multiset_timer_queue>(timer_count, executor));
+        print("wheel", timer_count, run<timer_wheel>(timer_count, executor));
+    }
+
+    return 0;
+}
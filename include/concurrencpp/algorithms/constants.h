@@ -0,0 +1,50 @@
+#ifndef CONCURRENCPP_ALGORITHMS_CONSTS_H
+#define CONCURRENCPP_ALGORITHMS_CONSTS_H
+
+#include <cstddef>
+
+namespace concurrencpp::details::consts {
+    constexpr size_t k_parallel_algorithm_chunks_per_worker = 8;  // the default grain size splits a range to this many chunks per worker
+    constexpr size_t k_parallel_algorithm_max_forks = 64;         // forks a thread makes from one range, each one halves what's left of it
+    constexpr size_t k_parallel_algorithm_extra_fork_depth = 2;   // recursion levels forked to non thread-pool executors, beyond one task per thread
+    constexpr size_t k_parallel_algorithm_max_fork_depth = 8;
+
+    constexpr size_t k_parallel_sort_sequential_threshold = 4 * 1024;        // ranges up to this size are sorted with std::sort
+    constexpr size_t k_parallel_merge_sequential_threshold = 8 * 1024;       // merges up to this size are done with std::merge
+    constexpr size_t k_parallel_partition_block_size = 16 * 1024;            // the blocks parallel_partition partitions separately
+    constexpr size_t k_parallel_sort_parallel_partition_threshold = 1024 * 1024;  // parallel_sort partitions bigger ranges in parallel
+
+    constexpr size_t k_numeric_block_bytes = 64 * 1024;             // numeric reductions split arrays on blocks of this many bytes
+    constexpr size_t k_numeric_histogram_elements_per_bin = 4;      // a histogram chunk counts at least this many elements per bin
+    constexpr size_t k_numeric_histogram_max_bins = 16 * 1024 * 1024;  // float positions can't tell more bins apart
+
+    inline const char* k_parallel_invoke_null_executor_err_msg = "concurrencpp::parallel_invoke - given executor is null.";
+    inline const char* k_fork_join_broken_task_err_msg =
+        "concurrencpp - a forked part of a parallel algorithm was destroyed before it ran (executor shut down).";
+    inline const char* k_parallel_for_null_executor_err_msg = "concurrencpp::parallel_for - given executor is null.";
+    inline const char* k_parallel_reduce_null_executor_err_msg = "concurrencpp::parallel_reduce - given executor is null.";
+    inline const char* k_parallel_transform_reduce_null_executor_err_msg =
+        "concurrencpp::parallel_transform_reduce - given executor is null.";
+    inline const char* k_parallel_sort_null_executor_err_msg = "concurrencpp::parallel_sort - given executor is null.";
+    inline const char* k_parallel_stable_sort_null_executor_err_msg = "concurrencpp::parallel_stable_sort - given executor is null.";
+    inline const char* k_parallel_partition_null_executor_err_msg = "concurrencpp::parallel_partition - given executor is null.";
+    inline const char* k_numeric_sum_null_executor_err_msg = "concurrencpp::numeric::sum - given executor is null.";
+    inline const char* k_numeric_min_max_null_executor_err_msg = "concurrencpp::numeric::min_max - given executor is null.";
+    inline const char* k_numeric_dot_null_executor_err_msg = "concurrencpp::numeric::dot - given executor is null.";
+    inline const char* k_numeric_dot_size_mismatch_err_msg = "concurrencpp::numeric::dot - given spans have different sizes.";
+    inline const char* k_numeric_histogram_null_executor_err_msg = "concurrencpp::numeric::histogram - given executor is null.";
+    inline const char* k_numeric_histogram_bin_count_err_msg =
+        "concurrencpp::numeric::histogram - bins must hold between 1 and 16M counters.";
+    inline const char* k_numeric_histogram_range_err_msg = "concurrencpp::numeric::histogram - low must be smaller than high.";
+    inline const char* k_numeric_histogram_scale_err_msg =
+        "concurrencpp::numeric::histogram - the width of [low, high) or of its bins is not a finite float.";
+
+    inline const char* k_task_graph_null_executor_err_msg = "concurrencpp::task_graph::run - given executor is null.";
+    inline const char* k_task_graph_unknown_node_err_msg = "concurrencpp::task_graph::add_edge - given node doesn't belong to the graph.";
+    inline const char* k_task_graph_cycle_err_msg = "concurrencpp::task_graph::run - the edges of the graph form a cycle.";
+    inline const char* k_task_graph_running_err_msg = "concurrencpp::task_graph - the graph can't be modified or run while it runs.";
+    inline const char* k_task_graph_broken_task_err_msg =
+        "concurrencpp::task_graph - a node was destroyed before it ran (executor shut down).";
+}  // namespace concurrencpp::details::consts
+
+#endif
@@ -0,0 +1,135 @@
+#ifndef CONCURRENCPP_FORK_JOIN_H
+#define CONCURRENCPP_FORK_JOIN_H
+
+#include "concurrencpp/forward_declarations.h"
+#include "concurrencpp/platform_defs.h"
+#include "concurrencpp/algorithms/constants.h"
+#include "concurrencpp/executors/manual_executor.h"
+
+#include <bit>
+#include <array>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <algorithm>
+#include <exception>
+#include <type_traits>
+
+#include <cstddef>
+
+namespace concurrencpp::details {
+    /*
+        One child of a fork-join scope, living on the stack of the forking thread. A child is forked - handed to an idle
+        worker of a thread_pool_executor - only if the pool has an idle worker at that moment, otherwise it is invoked
+        inline right away. Other executors get every child that is forked to them, callers bound how often they fork
+        with fork_depth_budget. Forking allocates nothing: the task refers to the child and to the callable, which both
+        outlive it since the forking thread joins every child before leaving the scope.
+    */
+    class CRCPP_API fork_join_child {
+
+       public:
+        using invoke_fn = void (*)(void* callable);
+
+       private:
+        std::atomic_bool m_done {false};
+        std::atomic_bool m_released {false};  // the completer doesn't touch the child anymore, it may be destroyed
+        bool m_forked = false;
+        std::exception_ptr m_exception;
+
+        static bool is_done(const void* context) noexcept;
+
+       public:
+        fork_join_child() noexcept = default;
+
+        fork_join_child(const fork_join_child&) = delete;
+        fork_join_child& operator=(const fork_join_child&) = delete;
+
+        // hands callable to an idle worker of executor, returns false if there is none.
+        bool try_fork(thread_pool_executor& executor, invoke_fn invoke, void* callable) noexcept;
+
+        // enqueues callable on executor. the calling thread must not be one executor needs to run it.
+        bool try_fork(executor& executor, invoke_fn invoke, void* callable) noexcept;
+
+        // called once by the task that runs a forked child, or by its destructor if the task never ran.
+        void complete(std::exception_ptr exception) noexcept;
+
+        template<class callable_type>
+        void invoke_inline(callable_type& callable) noexcept {
+            try {
+                callable();
+            } catch (...) {
+                m_exception = std::current_exception();
+            }
+        }
+
+        template<class executor_type, class callable_type>
+        void fork_or_invoke(executor_type& executor, callable_type& callable, bool last) noexcept {
+            // the last child is always invoked inline, the forking thread would only wait for it otherwise
+            if (!last) {
+                const auto invoke = [](void* callable_ptr) {
+                    (*static_cast<callable_type*>(callable_ptr))();
+                };
+
+                const auto callable_ptr = const_cast<void*>(static_cast<const void*>(std::addressof(callable)));
+                if (try_fork(executor, invoke, callable_ptr)) {
+                    return;
+                }
+            }
+
+            invoke_inline(callable);
+        }
+
+        // waits until a forked child is done. a pool worker executes other tasks meanwhile.
+        void join();
+
+        // rethrows the exception the child's callable threw, if any. the child must be joined.
+        void rethrow_if_failed() const;
+
+        // joins every child, then rethrows the first exception, in children order.
+        static void join_all(fork_join_child* children, size_t count);
+    };
+
+    /*
+        How many levels of a recursive algorithm may fork. Unbounded for a thread_pool_executor, which forks lazily,
+        a few levels more than needed to occupy every thread of other executors, none for executors that can't run
+        anything next to the calling thread. A manual_executor gets none either: it's usually looped by the calling
+        thread itself, which would block forever on forks only it could execute.
+    */
+    template<class executor_type>
+    size_t fork_depth_budget(executor_type& executor) noexcept {
+        if constexpr (std::is_same_v<executor_type, thread_pool_executor>) {
+            return std::numeric_limits<size_t>::max();
+        } else {
+            if (dynamic_cast<const manual_executor*>(std::addressof(executor)) != nullptr) {
+                return 0;
+            }
+
+            const auto concurrency_level = executor.max_concurrency_level();
+            if (concurrency_level <= 1) {
+                return 0;
+            }
+
+            const auto levels = std::bit_width(static_cast<size_t>(concurrency_level) - 1) + consts::k_parallel_algorithm_extra_fork_depth;
+            return std::min<size_t>(levels, consts::k_parallel_algorithm_max_fork_depth);
+        }
+    }
+
+    template<class executor_type, size_t... indices, class... callable_types>
+    void fork_join_invoke(executor_type& executor, std::index_sequence<indices...>, callable_types&... callables) {
+        constexpr auto count = sizeof...(callable_types);
+        std::array<fork_join_child, count> children;
+
+        (children[indices].fork_or_invoke(executor, callables, indices + 1 == count), ...);
+
+        fork_join_child::join_all(children.data(), count);
+    }
+
+    // invokes both callables, forking the first one, and rethrows the first exception once both are done.
+    template<class executor_type, class first_callable_type, class second_callable_type>
+    void fork_join_both(executor_type& executor, first_callable_type&& first, second_callable_type&& second) {
+        fork_join_invoke(executor, std::index_sequence<0, 1> {}, first, second);
+    }
+}  // namespace concurrencpp::details
+
+#endif
@@ -0,0 +1,170 @@
+#ifndef CONCURRENCPP_LAZY_SPLIT_H
+#define CONCURRENCPP_LAZY_SPLIT_H
+
+#include "concurrencpp/algorithms/constants.h"
+#include "concurrencpp/algorithms/impl/fork_join.h"
+#include "concurrencpp/executors/thread_pool_executor.h"
+
+#include <array>
+#include <iterator>
+#include <optional>
+#include <algorithm>
+#include <exception>
+#include <type_traits>
+
+#include <cstddef>
+
+namespace concurrencpp::details {
+    /*
+        A position of a parallel range: either an integral index or a random access iterator.
+        The element of an index is the index itself, the element of an iterator is what it points to.
+    */
+    template<class position_type>
+    concept range_position = std::is_integral_v<position_type> || std::random_access_iterator<position_type>;
+
+    template<class position_type>
+    decltype(auto) range_element(const position_type& position) {
+        if constexpr (std::is_integral_v<position_type>) {
+            return position_type(position);
+        } else {
+            return *position;
+        }
+    }
+
+    template<class position_type>
+    size_t range_distance(const position_type& first, const position_type& last) noexcept {
+        return (last > first) ? static_cast<size_t>(last - first) : 0;
+    }
+
+    template<class position_type>
+    position_type range_advance(const position_type& position, size_t count) noexcept {
+        return position + static_cast<std::conditional_t<std::is_integral_v<position_type>, position_type, std::iter_difference_t<position_type>>>(count);
+    }
+
+    // the smallest chunk a range is split to: the given grain size, or a fraction of what each worker would get.
+    inline size_t range_grain_size(size_t size, const thread_pool_executor& executor, size_t grain_size) noexcept {
+        if (grain_size != 0) {
+            return grain_size;
+        }
+
+        const auto chunk_count = static_cast<size_t>(executor.max_concurrency_level()) * consts::k_parallel_algorithm_chunks_per_worker;
+        return std::max<size_t>(1, size / std::max<size_t>(1, chunk_count));
+    }
+
+    /*
+        Lazy binary splitting: the calling thread processes its range chunk after chunk, and before every chunk, if a
+        worker of the pool is idle, it forks the second half of what's left to it. The forked half is processed the same
+        way by the worker. A busy pool never splits a range, an idle one takes work as soon as it asks for it, and the
+        only bookkeeping is a fixed array of fork slots on the stack of every thread taking part.
+        body(first, last) returns the partial value of a non empty sub range. partial values are combined in range order,
+        so combine only needs to be associative.
+    */
+    template<class position_type, class value_type, class body_type, class combine_type>
+    class lazy_split {
+
+       private:
+        struct fork_slot {
+            const lazy_split* split = nullptr;
+            position_type first {};
+            position_type last {};
+            std::optional<value_type> partial;
+
+            static void invoke(void* self_ptr) {
+                auto& self = *static_cast<fork_slot*>(self_ptr);
+                self.partial.emplace(self.split->run(self.first, self.last));
+            }
+        };
+
+        thread_pool_executor& m_executor;
+        const size_t m_grain_size;
+        body_type& m_body;
+        combine_type& m_combine;
+
+       public:
+        lazy_split(thread_pool_executor& executor, size_t grain_size, body_type& body, combine_type& combine) noexcept :
+            m_executor(executor), m_grain_size(grain_size), m_body(body), m_combine(combine) {}
+
+        // [first, last) must not be empty.
+        value_type run(position_type first, position_type last) const {
+            std::array<fork_join_child, consts::k_parallel_algorithm_max_forks> children;
+            std::array<fork_slot, consts::k_parallel_algorithm_max_forks> slots;
+            size_t fork_count = 0;
+
+            std::optional<value_type> partial;
+            std::exception_ptr exception;
+
+            try {
+                while (true) {
+                    const auto size = range_distance(first, last);
+                    if (size <= m_grain_size) {
+                        accumulate(partial, m_body(first, last));
+                        break;
+                    }
+
+                    if (fork_count < children.size()) {
+                        auto& slot = slots[fork_count];
+                        slot.split = this;
+                        slot.first = range_advance(first, size / 2);
+                        slot.last = last;
+
+                        if (children[fork_count].try_fork(m_executor, fork_slot::invoke, &slot)) {
+                            last = slot.first;
+                            ++fork_count;
+                            continue;
+                        }
+                    }
+
+                    const auto chunk_last = range_advance(first, m_grain_size);
+                    accumulate(partial, m_body(first, chunk_last));
+                    first = chunk_last;
+                }
+            } catch (...) {
+                exception = std::current_exception();
+            }
+
+            for (size_t i = 0; i < fork_count; i++) {
+                children[i].join();
+            }
+
+            if (static_cast<bool>(exception)) {
+                std::rethrow_exception(exception);
+            }
+
+            // every fork took the second half of what was left, so the last one is the leftmost
+            for (size_t i = fork_count; i != 0; i--) {
+                children[i - 1].rethrow_if_failed();
+            }
+
+            for (size_t i = fork_count; i != 0; i--) {
+                accumulate(partial, std::move(*slots[i - 1].partial));
+            }
+
+            return std::move(*partial);
+        }
+
+       private:
+        void accumulate(std::optional<value_type>& partial, value_type&& value) const {
+            if (partial.has_value()) {
+                partial.emplace(m_combine(std::move(*partial), std::move(value)));
+            } else {
+                partial.emplace(std::move(value));
+            }
+        }
+    };
+
+    template<class position_type, class value_type, class body_type, class combine_type>
+    value_type lazy_split_run(thread_pool_executor& executor,
+                              position_type first,
+                              position_type last,
+                              size_t grain_size,
+                              body_type& body,
+                              combine_type& combine) {
+        const lazy_split<position_type, value_type, body_type, combine_type> split(executor,
+                                                                                 range_grain_size(range_distance(first, last), executor, grain_size),
+                                                                                 body,
+                                                                                 combine);
+        return split.run(first, last);
+    }
+}  // namespace concurrencpp::details
+
+#endif
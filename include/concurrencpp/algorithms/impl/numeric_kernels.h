@@ -0,0 +1,71 @@
+#ifndef CONCURRENCPP_NUMERIC_KERNELS_H
+#define CONCURRENCPP_NUMERIC_KERNELS_H
+
+#include "concurrencpp/algorithms/numeric.h"
+#include "concurrencpp/platform_defs.h"
+
+#include <algorithm>
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#    define CRCPP_NUMERIC_X86_KERNELS
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    define CRCPP_NUMERIC_NEON_KERNELS
+#endif
+
+namespace concurrencpp::details {
+    /*
+        The kernels of one instruction set. Every kernel reduces a contiguous, possibly empty, array on the calling thread.
+        min_max kernels fold the array into min and max, histogram kernels add the counts of the array to bins.
+        A float value is counted in bin size_t((value - low) * scale) if low <= value < high. The position is clamped to
+        [0, bin_count - 1] before it is converted, a NaN position to 0, so no value is ever counted outside of bins.
+        Every instruction set computes that position with the same float operations, so all of them count alike.
+    */
+    struct numeric_kernels {
+        numeric::instruction_set isa;
+
+        double (*sum_f32)(const float* data, size_t size) noexcept;
+        double (*sum_f64)(const double* data, size_t size) noexcept;
+        int64_t (*sum_i32)(const int32_t* data, size_t size) noexcept;
+
+        void (*min_max_f32)(const float* data, size_t size, float& min, float& max) noexcept;
+        void (*min_max_f64)(const double* data, size_t size, double& min, double& max) noexcept;
+        void (*min_max_i32)(const int32_t* data, size_t size, int32_t& min, int32_t& max) noexcept;
+
+        double (*dot_f32)(const float* lhs, const float* rhs, size_t size) noexcept;
+        double (*dot_f64)(const double* lhs, const double* rhs, size_t size) noexcept;
+
+        void (*histogram_f32)(const float* data, size_t size, float low, float high, float scale, uint64_t* bins, size_t bin_count)
+            noexcept;
+        void (*histogram_i32)(const int32_t* data, size_t size, int32_t low, int32_t high, uint64_t* bins, size_t bin_count) noexcept;
+    };
+
+    CRCPP_API const numeric_kernels& scalar_numeric_kernels() noexcept;
+
+    inline size_t histogram_bin(float position, size_t bin_count) noexcept {
+        // std::max(0.0f, NaN) is 0.0f
+        return static_cast<size_t>(std::min(std::max(0.0f, position), static_cast<float>(bin_count - 1)));
+    }
+
+    void scalar_histogram_i32(const int32_t* data, size_t size, int32_t low, int32_t high, uint64_t* bins, size_t bin_count) noexcept;
+
+#if defined(CRCPP_NUMERIC_X86_KERNELS)
+    const numeric_kernels& avx2_numeric_kernels() noexcept;
+    const numeric_kernels& avx512_numeric_kernels() noexcept;
+#elif defined(CRCPP_NUMERIC_NEON_KERNELS)
+    const numeric_kernels& neon_numeric_kernels() noexcept;
+#endif
+
+    // the best instruction set both the build and the cpu support.
+    CRCPP_API numeric::instruction_set detect_instruction_set() noexcept;
+
+    // the kernels of isa, or null if the build or the cpu doesn't support it.
+    CRCPP_API const numeric_kernels* numeric_kernels_of(numeric::instruction_set isa) noexcept;
+
+    // the kernels of detect_instruction_set(), detected once.
+    CRCPP_API const numeric_kernels& active_numeric_kernels() noexcept;
+}  // namespace concurrencpp::details
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef CONCURRENCPP_NUMERIC_H
+#define CONCURRENCPP_NUMERIC_H
+
+#include "concurrencpp/forward_declarations.h"
+#include "concurrencpp/platform_defs.h"
+
+#include <span>
+#include <memory>
+
+#include <cstdint>
+
+namespace concurrencpp::numeric {
+    /*
+        The vector instructions the numeric kernels use. The best set the cpu supports is picked once, at the first call.
+    */
+    enum class instruction_set { scalar, neon, avx2, avx512 };
+
+    CRCPP_API instruction_set active_instruction_set() noexcept;
+    CRCPP_API const char* instruction_set_name(instruction_set isa) noexcept;
+
+    template<class type>
+    struct min_max_result {
+        type min;
+        type max;
+    };
+
+    /*
+        Numeric reductions over large arrays. The array is split on fixed size blocks which are reduced in parallel on the
+        workers of executor, every chunk of blocks by one vectorized kernel. Floating point values are accumulated as
+        doubles, int32_t values as int64_t, so results don't depend on how the array was split up to rounding.
+        All the functions throw std::invalid_argument if executor is null.
+    */
+    CRCPP_API double sum(const std::shared_ptr<thread_pool_executor>& executor, std::span<const float> values);
+    CRCPP_API double sum(const std::shared_ptr<thread_pool_executor>& executor, std::span<const double> values);
+    CRCPP_API int64_t sum(const std::shared_ptr<thread_pool_executor>& executor, std::span<const int32_t> values);
+
+    /*
+        The smallest and biggest value. For an empty span min is std::numeric_limits<type>::max() and max is
+        std::numeric_limits<type>::lowest(). The result is unspecified if values contains a NaN.
+    */
+    CRCPP_API min_max_result<float> min_max(const std::shared_ptr<thread_pool_executor>& executor, std::span<const float> values);
+    CRCPP_API min_max_result<double> min_max(const std::shared_ptr<thread_pool_executor>& executor, std::span<const double> values);
+    CRCPP_API min_max_result<int32_t> min_max(const std::shared_ptr<thread_pool_executor>& executor, std::span<const int32_t> values);
+
+    /*
+        The sum of lhs[i] * rhs[i]. Throws std::invalid_argument if lhs and rhs have different sizes.
+    */
+    CRCPP_API double dot(const std::shared_ptr<thread_pool_executor>& executor,
+                         std::span<const float> lhs,
+                         std::span<const float> rhs);
+    CRCPP_API double dot(const std::shared_ptr<thread_pool_executor>& executor,
+                         std::span<const double> lhs,
+                         std::span<const double> rhs);
+
+    /*
+        Splits [low, high) to bins.size() bins of equal width and overwrites every bin with the count of the values that
+        fall into it. Values outside of [low, high) and NaNs aren't counted.
+        Every chunk counts into a private histogram, so bins are never shared between threads.
+        Throws std::invalid_argument if bins is empty or has more than 16M bins, if low isn't smaller than high, or if
+        high - low or the width of a bin isn't a finite float.
+    */
+    CRCPP_API void histogram(const std::shared_ptr<thread_pool_executor>& executor,
+                             std::span<const float> values,
+                             float low,
+                             float high,
+                             std::span<uint64_t> bins);
+    CRCPP_API void histogram(const std::shared_ptr<thread_pool_executor>& executor,
+                             std::span<const int32_t> values,
+                             int32_t low,
+                             int32_t high,
+                             std::span<uint64_t> bins);
+}  // namespace concurrencpp::numeric
+
+#endif
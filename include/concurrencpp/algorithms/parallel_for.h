@@ -0,0 +1,91 @@
+#ifndef CONCURRENCPP_PARALLEL_FOR_H
+#define CONCURRENCPP_PARALLEL_FOR_H
+
+#include "concurrencpp/algorithms/constants.h"
+#include "concurrencpp/algorithms/impl/lazy_split.h"
+#include "concurrencpp/executors/thread_pool_executor.h"
+#include "concurrencpp/results/result.h"
+
+#include <memory>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+namespace concurrencpp::details {
+    struct parallel_for_partial {};
+
+    template<class position_type, class callable_type>
+    void parallel_for_impl(thread_pool_executor& executor, position_type first, position_type last, callable_type& callable, size_t grain_size) {
+        if (range_distance(first, last) == 0) {
+            return;
+        }
+
+        auto body = [&callable](position_type chunk_first, position_type chunk_last) {
+            for (; chunk_first != chunk_last; ++chunk_first) {
+                callable(range_element(chunk_first));
+            }
+
+            return parallel_for_partial {};
+        };
+
+        auto combine = [](parallel_for_partial, parallel_for_partial) noexcept {
+            return parallel_for_partial {};
+        };
+
+        lazy_split_run<position_type, parallel_for_partial>(executor, first, last, grain_size, body, combine);
+    }
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+        Invokes callable for every element of [first, last) - every index if first and last are integral, every pointed
+        object if they are random access iterators - possibly in parallel on the workers of executor, and returns once
+        all the invocations are done. The range is split lazily: chunks are handed to workers only while workers are idle.
+        grain_size is the smallest chunk a range is split to, 0 picks one from the size of the range and of the pool.
+        If invocations throw, the exception of the leftmost failing chunk is rethrown after all the chunks are done,
+        a chunk stops at the first exception it encounters.
+    */
+    template<class position_type, class callable_type>
+    void parallel_for(const std::shared_ptr<thread_pool_executor>& executor,
+                      position_type first,
+                      position_type last,
+                      callable_type&& callable,
+                      size_t grain_size = 0) {
+        static_assert(details::range_position<position_type>,
+                      "concurrencpp::parallel_for - <<position_type>> must be an integral type or a random access iterator.");
+        static_assert(std::is_invocable_v<callable_type&, decltype(details::range_element(first))>,
+                      "concurrencpp::parallel_for - <<callable_type>> is not invocable with the elements of the range.");
+
+        if (!static_cast<bool>(executor)) {
+            throw std::invalid_argument(details::consts::k_parallel_for_null_executor_err_msg);
+        }
+
+        details::parallel_for_impl(*executor, first, last, callable, grain_size);
+    }
+
+    /*
+        Like parallel_for, but returns right away: the loop runs on executor and the returned result becomes ready once
+        the loop is done. callable is copied or moved into the loop, the range has to stay valid until then.
+    */
+    template<class position_type, class callable_type>
+    result<void> async_parallel_for(const std::shared_ptr<thread_pool_executor>& executor,
+                                    position_type first,
+                                    position_type last,
+                                    callable_type&& callable,
+                                    size_t grain_size = 0) {
+        static_assert(details::range_position<position_type>,
+                      "concurrencpp::parallel_for - <<position_type>> must be an integral type or a random access iterator.");
+
+        if (!static_cast<bool>(executor)) {
+            throw std::invalid_argument(details::consts::k_parallel_for_null_executor_err_msg);
+        }
+
+        // the pool outlives the loop, queued tasks are destroyed when it's shut down
+        auto& executor_ref = *executor;
+        return executor->submit([&executor_ref, first, last, callable = std::forward<callable_type>(callable), grain_size]() mutable {
+            details::parallel_for_impl(executor_ref, first, last, callable, grain_size);
+        });
+    }
+}  // namespace concurrencpp
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef CONCURRENCPP_PARALLEL_INVOKE_H
+#define CONCURRENCPP_PARALLEL_INVOKE_H
+
+#include "concurrencpp/algorithms/constants.h"
+#include "concurrencpp/algorithms/impl/fork_join.h"
+#include "concurrencpp/executors/thread_pool_executor.h"
+
+#include <memory>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+namespace concurrencpp {
+    /*
+        Invokes every callable, possibly in parallel on the workers of executor, and returns once all of them are done.
+        A callable is handed to the pool only if one of its workers is idle, otherwise the calling thread invokes it
+        inline, so recursive divide-and-conquer code costs about as much as its sequential version when the pool is busy.
+        While the calling thread waits for the callables it handed over, a pool worker executes other tasks.
+        If callables throw, the first exception (in argument order) is rethrown after all the callables are done.
+    */
+    template<class... callable_types>
+    void parallel_invoke(const std::shared_ptr<thread_pool_executor>& executor, callable_types&&... callables) {
+        static_assert(sizeof...(callable_types) != 0, "concurrencpp::parallel_invoke - at least one callable must be given.");
+        static_assert((std::is_invocable_v<callable_types&> && ...),
+                      "concurrencpp::parallel_invoke - given callables must be invocable with no arguments.");
+
+        if (!static_cast<bool>(executor)) {
+            throw std::invalid_argument(details::consts::k_parallel_invoke_null_executor_err_msg);
+        }
+
+        details::fork_join_invoke(*executor, std::index_sequence_for<callable_types...> {}, callables...);
+    }
+}  // namespace concurrencpp
+
+#endif
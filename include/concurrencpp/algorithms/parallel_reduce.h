@@ -0,0 +1,155 @@
+#ifndef CONCURRENCPP_PARALLEL_REDUCE_H
+#define CONCURRENCPP_PARALLEL_REDUCE_H
+
+#include "concurrencpp/algorithms/constants.h"
+#include "concurrencpp/algorithms/impl/lazy_split.h"
+#include "concurrencpp/executors/thread_pool_executor.h"
+#include "concurrencpp/results/result.h"
+
+#include <memory>
+#include <utility>
+#include <stdexcept>
+#include <functional>
+#include <type_traits>
+
+namespace concurrencpp::details {
+    template<class position_type, class value_type, class reduce_type, class transform_type>
+    value_type parallel_transform_reduce_impl(thread_pool_executor& executor,
+                                              position_type first,
+                                              position_type last,
+                                              value_type init,
+                                              reduce_type& reduce,
+                                              transform_type& transform,
+                                              size_t grain_size) {
+        if (range_distance(first, last) == 0) {
+            return init;
+        }
+
+        auto body = [&reduce, &transform](position_type chunk_first, position_type chunk_last) {
+            value_type partial = transform(range_element(chunk_first));
+            for (++chunk_first; chunk_first != chunk_last; ++chunk_first) {
+                partial = reduce(std::move(partial), transform(range_element(chunk_first)));
+            }
+
+            return partial;
+        };
+
+        auto partial = lazy_split_run<position_type, value_type>(executor, first, last, grain_size, body, reduce);
+        return reduce(std::move(init), std::move(partial));
+    }
+
+    struct parallel_reduce_identity {
+        template<class type>
+        type&& operator()(type&& value) const noexcept {
+            return std::forward<type>(value);
+        }
+    };
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+        Reduces transform(element) for every element of [first, last) - every index if first and last are integral, every
+        pointed object if they are random access iterators - and init with reduce, possibly in parallel on the workers of
+        executor. Partial values are combined in range order, so reduce has to be associative, but not commutative.
+        grain_size is the smallest chunk a range is split to, 0 picks one from the size of the range and of the pool.
+        If reduce or transform throw, the exception of the leftmost failing chunk is rethrown after all the chunks are done.
+    */
+    template<class position_type, class value_type, class reduce_type, class transform_type>
+    value_type parallel_transform_reduce(const std::shared_ptr<thread_pool_executor>& executor,
+                                         position_type first,
+                                         position_type last,
+                                         value_type init,
+                                         reduce_type&& reduce,
+                                         transform_type&& transform,
+                                         size_t grain_size = 0) {
+        static_assert(details::range_position<position_type>,
+                      "concurrencpp::parallel_transform_reduce - <<position_type>> must be an integral type or a random access iterator.");
+
+        if (!static_cast<bool>(executor)) {
+            throw std::invalid_argument(details::consts::k_parallel_transform_reduce_null_executor_err_msg);
+        }
+
+        return details::parallel_transform_reduce_impl(*executor, first, last, std::move(init), reduce, transform, grain_size);
+    }
+
+    /*
+        Like parallel_transform_reduce with an identity transform: reduces the elements of [first, last) and init.
+    */
+    template<class position_type, class value_type, class reduce_type = std::plus<>>
+    value_type parallel_reduce(const std::shared_ptr<thread_pool_executor>& executor,
+                               position_type first,
+                               position_type last,
+                               value_type init,
+                               reduce_type&& reduce = {},
+                               size_t grain_size = 0) {
+        static_assert(details::range_position<position_type>,
+                      "concurrencpp::parallel_reduce - <<position_type>> must be an integral type or a random access iterator.");
+
+        if (!static_cast<bool>(executor)) {
+            throw std::invalid_argument(details::consts::k_parallel_reduce_null_executor_err_msg);
+        }
+
+        details::parallel_reduce_identity transform;
+        return details::parallel_transform_reduce_impl(*executor, first, last, std::move(init), reduce, transform, grain_size);
+    }
+
+    /*
+        Like parallel_transform_reduce, but returns right away: the reduction runs on executor and the returned result
+        holds its value once it's done. reduce and transform are copied or moved into the reduction, the range has to
+        stay valid until then.
+    */
+    template<class position_type, class value_type, class reduce_type, class transform_type>
+    result<value_type> async_parallel_transform_reduce(const std::shared_ptr<thread_pool_executor>& executor,
+                                                       position_type first,
+                                                       position_type last,
+                                                       value_type init,
+                                                       reduce_type&& reduce,
+                                                       transform_type&& transform,
+                                                       size_t grain_size = 0) {
+        static_assert(details::range_position<position_type>,
+                      "concurrencpp::parallel_transform_reduce - <<position_type>> must be an integral type or a random access iterator.");
+
+        if (!static_cast<bool>(executor)) {
+            throw std::invalid_argument(details::consts::k_parallel_transform_reduce_null_executor_err_msg);
+        }
+
+        // the pool outlives the reduction, queued tasks are destroyed when it's shut down
+        auto& executor_ref = *executor;
+        return executor->submit([&executor_ref,
+                                 first,
+                                 last,
+                                 init = std::move(init),
+                                 reduce = std::forward<reduce_type>(reduce),
+                                 transform = std::forward<transform_type>(transform),
+                                 grain_size]() mutable {
+            return details::parallel_transform_reduce_impl(executor_ref, first, last, std::move(init), reduce, transform, grain_size);
+        });
+    }
+
+    /*
+        Like parallel_reduce, but returns right away: the reduction runs on executor and the returned result holds its
+        value once it's done.
+    */
+    template<class position_type, class value_type, class reduce_type = std::plus<>>
+    result<value_type> async_parallel_reduce(const std::shared_ptr<thread_pool_executor>& executor,
+                                             position_type first,
+                                             position_type last,
+                                             value_type init,
+                                             reduce_type&& reduce = {},
+                                             size_t grain_size = 0) {
+        static_assert(details::range_position<position_type>,
+                      "concurrencpp::parallel_reduce - <<position_type>> must be an integral type or a random access iterator.");
+
+        if (!static_cast<bool>(executor)) {
+            throw std::invalid_argument(details::consts::k_parallel_reduce_null_executor_err_msg);
+        }
+
+        auto& executor_ref = *executor;
+        return executor->submit([&executor_ref, first, last, init = std::move(init), reduce = std::forward<reduce_type>(reduce), grain_size]() mutable {
+            details::parallel_reduce_identity transform;
+            return details::parallel_transform_reduce_impl(executor_ref, first, last, std::move(init), reduce, transform, grain_size);
+        });
+    }
+}  // namespace concurrencpp
+
+#endif
@@ -0,0 +1,356 @@
+#ifndef CONCURRENCPP_PARALLEL_SORT_H
+#define CONCURRENCPP_PARALLEL_SORT_H
+
+#include "concurrencpp/algorithms/constants.h"
+#include "concurrencpp/algorithms/impl/fork_join.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/executors/thread_pool_executor.h"
+
+#include <bit>
+#include <memory>
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+#include <type_traits>
+
+#include <cassert>
+
+namespace concurrencpp::details {
+    // invokes function(i) for every i in [first, last), splitting the indices in halves while fork_depth allows.
+    template<class executor_type, class function_type>
+    void fork_join_for_each(executor_type& executor, size_t first, size_t last, function_type& function, size_t fork_depth) {
+        if (last - first == 1 || fork_depth == 0) {
+            for (; first != last; ++first) {
+                function(first);
+            }
+
+            return;
+        }
+
+        const auto mid = first + (last - first) / 2;
+        fork_join_both(
+            executor,
+            [&] {
+                fork_join_for_each(executor, first, mid, function, fork_depth - 1);
+            },
+            [&] {
+                fork_join_for_each(executor, mid, last, function, fork_depth - 1);
+            });
+    }
+
+    /*
+        Partitions every block of the range on its own, then swaps the elements that ended up on the wrong side of the
+        partition point: the i-th misplaced false element with the i-th misplaced true one. Both phases are split into
+        about the same number of independent pieces.
+    */
+    template<class executor_type, class iterator_type, class predicate_type>
+    iterator_type parallel_partition_impl(executor_type& executor, iterator_type first, iterator_type last, predicate_type& predicate, size_t fork_depth) {
+        const auto size = static_cast<size_t>(last - first);
+        const auto block_size = consts::k_parallel_partition_block_size;
+        if (size <= block_size * 2 || fork_depth == 0) {
+            return std::partition(first, last, predicate);
+        }
+
+        const auto block_count = (size + block_size - 1) / block_size;
+        std::vector<size_t> true_counts(block_count);
+
+        auto partition_block = [&](size_t block) {
+            const auto block_first = first + block * block_size;
+            const auto block_last = first + std::min(size, (block + 1) * block_size);
+            true_counts[block] = static_cast<size_t>(std::partition(block_first, block_last, predicate) - block_first);
+        };
+
+        fork_join_for_each(executor, 0, block_count, partition_block, fork_depth);
+
+        size_t partition_point = 0;
+        for (const auto true_count : true_counts) {
+            partition_point += true_count;
+        }
+
+        // the misplaced elements, as runs of offsets, with the number of misplaced elements before each run
+        struct misplaced_run {
+            size_t first;
+            size_t last;
+            size_t rank;
+        };
+
+        std::vector<misplaced_run> misplaced_false, misplaced_true;
+        size_t false_rank = 0, true_rank = 0;
+
+        for (size_t block = 0; block < block_count; block++) {
+            const auto block_first = block * block_size;
+            const auto block_last = std::min(size, (block + 1) * block_size);
+            const auto block_partition_point = block_first + true_counts[block];
+
+            const auto false_last = std::min(block_last, partition_point);
+            if (block_partition_point < false_last) {
+                misplaced_false.push_back({block_partition_point, false_last, false_rank});
+                false_rank += false_last - block_partition_point;
+            }
+
+            const auto true_first = std::max(block_first, partition_point);
+            if (true_first < block_partition_point) {
+                misplaced_true.push_back({true_first, block_partition_point, true_rank});
+                true_rank += block_partition_point - true_first;
+            }
+        }
+
+        assert(false_rank == true_rank);
+        const auto misplaced_count = false_rank;
+        if (misplaced_count == 0) {
+            return first + partition_point;
+        }
+
+        const auto find_run = [](const std::vector<misplaced_run>& runs, size_t rank) {
+            const auto run = std::upper_bound(runs.begin(), runs.end(), rank, [](size_t rank, const misplaced_run& run) {
+                return rank < run.rank;
+            });
+
+            return static_cast<size_t>(run - runs.begin()) - 1;
+        };
+
+        const auto segment_count = std::min(block_count, misplaced_count);
+        auto swap_segment = [&](size_t segment) {
+            auto rank = misplaced_count * segment / segment_count;
+            const auto rank_last = misplaced_count * (segment + 1) / segment_count;
+
+            auto false_run = find_run(misplaced_false, rank);
+            auto true_run = find_run(misplaced_true, rank);
+            auto false_offset = misplaced_false[false_run].first + (rank - misplaced_false[false_run].rank);
+            auto true_offset = misplaced_true[true_run].first + (rank - misplaced_true[true_run].rank);
+
+            for (; rank != rank_last; ++rank) {
+                if (false_offset == misplaced_false[false_run].last) {
+                    false_offset = misplaced_false[++false_run].first;
+                }
+
+                if (true_offset == misplaced_true[true_run].last) {
+                    true_offset = misplaced_true[++true_run].first;
+                }
+
+                std::iter_swap(first + false_offset++, first + true_offset++);
+            }
+        };
+
+        fork_join_for_each(executor, 0, segment_count, swap_segment, fork_depth);
+        return first + partition_point;
+    }
+
+    /*
+        Quicksort whose two sides are sorted in parallel. The pivot, a median of three, is moved to the front and the rest
+        of the range is split three ways - smaller, equivalent and bigger - so runs of equivalent elements end the
+        recursion. Big ranges are partitioned in parallel. Ranges under the sequential threshold, ranges past the fork
+        depth and ranges that recurse too deep (a bad pivot sequence) are sorted with std::sort.
+    */
+    template<class executor_type, class iterator_type, class compare_type>
+    void parallel_sort_impl(executor_type& executor,
+                            iterator_type first,
+                            iterator_type last,
+                            compare_type& compare,
+                            size_t fork_depth,
+                            size_t depth_limit) {
+        const auto size = static_cast<size_t>(last - first);
+        if (size <= consts::k_parallel_sort_sequential_threshold || fork_depth == 0 || depth_limit == 0) {
+            std::sort(first, last, compare);
+            return;
+        }
+
+        const auto mid = first + size / 2;
+        const auto back = last - 1;
+        const auto median = compare(*first, *mid) ? (compare(*mid, *back) ? mid : (compare(*first, *back) ? back : first)) :
+                                                    (compare(*first, *back) ? first : (compare(*mid, *back) ? back : mid));
+        std::iter_swap(first, median);
+
+        const auto& pivot = *first;
+        auto is_smaller = [&](const auto& value) {
+            return compare(value, pivot);
+        };
+
+        auto is_not_bigger = [&](const auto& value) {
+            return !compare(pivot, value);
+        };
+
+        iterator_type smaller_last, equivalent_last;
+        if (size > consts::k_parallel_sort_parallel_partition_threshold) {
+            smaller_last = parallel_partition_impl(executor, first + 1, last, is_smaller, fork_depth);
+            equivalent_last = parallel_partition_impl(executor, smaller_last, last, is_not_bigger, fork_depth);
+        } else {
+            smaller_last = std::partition(first + 1, last, is_smaller);
+            equivalent_last = std::partition(smaller_last, last, is_not_bigger);
+        }
+
+        // [first, smaller_last - 1) < pivot, [smaller_last - 1, equivalent_last) ~ pivot, [equivalent_last, last) > pivot
+        std::iter_swap(first, smaller_last - 1);
+
+        fork_join_both(
+            executor,
+            [&] {
+                parallel_sort_impl(executor, first, smaller_last - 1, compare, fork_depth - 1, depth_limit - 1);
+            },
+            [&] {
+                parallel_sort_impl(executor, equivalent_last, last, compare, fork_depth - 1, depth_limit - 1);
+            });
+    }
+
+    /*
+        Moves the merge of two sorted ranges to output. Splits the bigger range in the middle and the other one at the
+        matching bound, and merges both halves in parallel. Equivalent elements of the left range stay before the ones of
+        the right range.
+    */
+    template<class executor_type, class input_iterator_type, class output_iterator_type, class compare_type>
+    void parallel_merge_impl(executor_type& executor,
+                             input_iterator_type left_first,
+                             input_iterator_type left_last,
+                             input_iterator_type right_first,
+                             input_iterator_type right_last,
+                             output_iterator_type output,
+                             compare_type& compare,
+                             size_t fork_depth) {
+        const auto left_size = static_cast<size_t>(left_last - left_first);
+        const auto right_size = static_cast<size_t>(right_last - right_first);
+
+        if (left_size + right_size <= consts::k_parallel_merge_sequential_threshold || fork_depth == 0) {
+            std::merge(std::make_move_iterator(left_first),
+                       std::make_move_iterator(left_last),
+                       std::make_move_iterator(right_first),
+                       std::make_move_iterator(right_last),
+                       output,
+                       compare);
+            return;
+        }
+
+        input_iterator_type left_mid, right_mid;
+        if (left_size >= right_size) {
+            left_mid = left_first + left_size / 2;
+            right_mid = std::lower_bound(right_first, right_last, *left_mid, compare);
+        } else {
+            right_mid = right_first + right_size / 2;
+            left_mid = std::upper_bound(left_first, left_last, *right_mid, compare);
+        }
+
+        const auto output_mid = output + (left_mid - left_first) + (right_mid - right_first);
+
+        fork_join_both(
+            executor,
+            [&] {
+                parallel_merge_impl(executor, left_first, left_mid, right_first, right_mid, output, compare, fork_depth - 1);
+            },
+            [&] {
+                parallel_merge_impl(executor, left_mid, left_last, right_mid, right_last, output_mid, compare, fork_depth - 1);
+            });
+    }
+
+    /*
+        Merge sort between the range and a buffer of the same size. The two halves are sorted in parallel into the storage
+        the result isn't supposed to end up in, then merged in parallel into the other one.
+    */
+    template<class executor_type, class iterator_type, class buffer_iterator_type, class compare_type>
+    void parallel_stable_sort_impl(executor_type& executor,
+                                   iterator_type first,
+                                   iterator_type last,
+                                   buffer_iterator_type buffer,
+                                   bool into_buffer,
+                                   compare_type& compare,
+                                   size_t fork_depth) {
+        const auto size = static_cast<size_t>(last - first);
+        if (size <= consts::k_parallel_sort_sequential_threshold || fork_depth == 0) {
+            std::stable_sort(first, last, compare);
+            if (into_buffer) {
+                std::move(first, last, buffer);
+            }
+
+            return;
+        }
+
+        const auto mid = first + size / 2;
+        const auto buffer_mid = buffer + size / 2;
+        const auto buffer_last = buffer + size;
+
+        fork_join_both(
+            executor,
+            [&] {
+                parallel_stable_sort_impl(executor, first, mid, buffer, !into_buffer, compare, fork_depth - 1);
+            },
+            [&] {
+                parallel_stable_sort_impl(executor, mid, last, buffer_mid, !into_buffer, compare, fork_depth - 1);
+            });
+
+        if (into_buffer) {
+            parallel_merge_impl(executor, first, mid, mid, last, buffer, compare, fork_depth);
+        } else {
+            parallel_merge_impl(executor, buffer, buffer_mid, buffer_mid, buffer_last, first, compare, fork_depth);
+        }
+    }
+
+    template<class executor_type, class iterator_type>
+    void parallel_sort_check_arguments(const std::shared_ptr<executor_type>& executor, const char* error_message) {
+        static_assert(std::is_base_of_v<concurrencpp::executor, executor_type>,
+                      "concurrencpp - parallel sort algorithms - <<executor_type>> must be a concurrencpp executor.");
+        static_assert(std::random_access_iterator<iterator_type>,
+                      "concurrencpp - parallel sort algorithms - <<iterator_type>> must be a random access iterator.");
+
+        if (!static_cast<bool>(executor)) {
+            throw std::invalid_argument(error_message);
+        }
+    }
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+        Sorts [first, last) with compare, possibly in parallel on executor. Like std::sort, the order of equivalent
+        elements isn't preserved. Ranges of up to a few thousand elements are sorted with std::sort on the calling thread.
+        A thread_pool_executor forks work only to idle workers. Other executors get a bounded number of tasks, and the
+        calling thread blocks until they are done, so it mustn't be a thread those tasks need.
+        If compare throws, the exception is rethrown once all the parts of the sort are done, the range is left in an
+        unspecified order.
+    */
+    template<class executor_type, class iterator_type, class compare_type = std::less<>>
+    void parallel_sort(const std::shared_ptr<executor_type>& executor, iterator_type first, iterator_type last, compare_type&& compare = {}) {
+        details::parallel_sort_check_arguments<executor_type, iterator_type>(executor, details::consts::k_parallel_sort_null_executor_err_msg);
+
+        const auto size = static_cast<size_t>(std::max<std::iter_difference_t<iterator_type>>(last - first, 0));
+        const auto depth_limit = 2 * static_cast<size_t>(std::bit_width(size));
+        details::parallel_sort_impl(*executor, first, last, compare, details::fork_depth_budget(*executor), depth_limit);
+    }
+
+    /*
+        Like parallel_sort, but keeps the order of equivalent elements. Merges in parallel through a buffer as big as the
+        range, so elements have to be move constructible and move assignable.
+    */
+    template<class executor_type, class iterator_type, class compare_type = std::less<>>
+    void parallel_stable_sort(const std::shared_ptr<executor_type>& executor, iterator_type first, iterator_type last, compare_type&& compare = {}) {
+        details::parallel_sort_check_arguments<executor_type, iterator_type>(executor,
+                                                                            details::consts::k_parallel_stable_sort_null_executor_err_msg);
+
+        const auto size = last - first;
+        if (size <= static_cast<std::iter_difference_t<iterator_type>>(details::consts::k_parallel_sort_sequential_threshold)) {
+            std::stable_sort(first, last, compare);
+            return;
+        }
+
+        // the buffer takes the elements over, the sort moves them back
+        std::vector<std::iter_value_t<iterator_type>> buffer(std::make_move_iterator(first), std::make_move_iterator(last));
+        details::parallel_stable_sort_impl(*executor, buffer.begin(), buffer.end(), first, true, compare, details::fork_depth_budget(*executor));
+    }
+
+    /*
+        Reorders [first, last) so the elements predicate returns true for precede the ones it returns false for, possibly
+        in parallel on executor, and returns an iterator to the first element of the second group. Like std::partition,
+        the relative order of the elements isn't preserved.
+    */
+    template<class executor_type, class iterator_type, class predicate_type>
+    iterator_type parallel_partition(const std::shared_ptr<executor_type>& executor, iterator_type first, iterator_type last, predicate_type&& predicate) {
+        details::parallel_sort_check_arguments<executor_type, iterator_type>(executor, details::consts::k_parallel_partition_null_executor_err_msg);
+
+        if (last <= first) {
+            return first;
+        }
+
+        return details::parallel_partition_impl(*executor, first, last, predicate, details::fork_depth_budget(*executor));
+    }
+}  // namespace concurrencpp
+
+#endif
@@ -0,0 +1,126 @@
+#ifndef CONCURRENCPP_TASK_GRAPH_H
+#define CONCURRENCPP_TASK_GRAPH_H
+
+#include "concurrencpp/forward_declarations.h"
+#include "concurrencpp/platform_defs.h"
+#include "concurrencpp/results/result.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <utility>
+#include <optional>
+#include <exception>
+#include <type_traits>
+
+#include <cstddef>
+
+namespace concurrencpp::details {
+    // the callable of a node. unlike a task, it can be invoked once per run of the graph.
+    class task_graph_callable {
+
+       public:
+        virtual ~task_graph_callable() noexcept = default;
+        virtual void invoke() = 0;
+    };
+
+    template<class callable_type>
+    class task_graph_callable_impl final : public task_graph_callable {
+
+       private:
+        callable_type m_callable;
+
+       public:
+        template<class given_callable_type>
+        explicit task_graph_callable_impl(given_callable_type&& callable) : m_callable(std::forward<given_callable_type>(callable)) {}
+
+        void invoke() override {
+            m_callable();
+        }
+    };
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+        A directed acyclic graph of callables. Nodes are added with add_node, add_edge(from, to) makes to run only after
+        from is done. run enqueues the nodes no edge leads to, every node that finishes decrements the pending
+        predecessor counters of its successors, and a successor whose counter drops to zero is released right away:
+        the first one continues on the same thread, the rest are enqueued to the executor.
+        The graph is compiled to flat adjacency arrays the first time it runs after a change, so running it again
+        allocates nothing but the result of the run. If a node throws, the nodes that haven't started yet are skipped
+        and the result of the run holds the first exception.
+        The graph must outlive its runs, and can't be modified or run again until the result of the current run is ready.
+    */
+    class CRCPP_API task_graph {
+
+       public:
+        using node_id = size_t;
+
+       private:
+        class node_task;
+
+        // built by add_node and add_edge
+        std::vector<std::unique_ptr<details::task_graph_callable>> m_callables;
+        std::vector<std::pair<node_id, node_id>> m_edges;
+        bool m_compiled = false;
+
+        // compiled from m_edges: the successors of node i are m_successors[m_successor_offsets[i], m_successor_offsets[i + 1])
+        std::vector<size_t> m_successor_offsets;
+        std::vector<node_id> m_successors;
+        std::vector<size_t> m_in_degrees;
+        std::vector<node_id> m_roots;
+        std::unique_ptr<std::atomic_size_t[]> m_pending;
+        std::vector<node_id> m_skip_links;  // intrusive stacks of the nodes a failed run skips, one link per node
+
+        // the state of the current run
+        std::atomic_size_t m_remaining {0};
+        std::atomic_bool m_failed {false};
+        std::atomic_bool m_running {false};
+        std::exception_ptr m_exception;
+        std::optional<result_promise<void>> m_promise;
+        std::shared_ptr<executor> m_executor;
+
+        node_id add_node_impl(std::unique_ptr<details::task_graph_callable> callable);
+
+        void throw_if_running() const;
+        void compile();
+
+        void schedule(node_id node) noexcept;
+        void run_nodes(node_id node) noexcept;
+        void skip_nodes(node_id node) noexcept;
+        bool release_successors(node_id node, node_id& next) noexcept;
+        bool finish_node() noexcept;
+        void fail(std::exception_ptr exception) noexcept;
+        void complete_run() noexcept;
+
+       public:
+        task_graph() noexcept = default;
+
+        task_graph(const task_graph&) = delete;
+        task_graph& operator=(const task_graph&) = delete;
+
+        template<class callable_type>
+        node_id add_node(callable_type&& callable) {
+            static_assert(std::is_invocable_v<std::decay_t<callable_type>&>,
+                          "concurrencpp::task_graph::add_node - given callable must be invocable with no arguments.");
+
+            using decayed_type = std::decay_t<callable_type>;
+            return add_node_impl(std::make_unique<details::task_graph_callable_impl<decayed_type>>(std::forward<callable_type>(callable)));
+        }
+
+        // from must be done before to starts. throws std::invalid_argument if either node isn't part of the graph.
+        void add_edge(node_id from, node_id to);
+
+        size_t size() const noexcept;
+        size_t edge_count() const noexcept;
+        bool running() const noexcept;
+
+        /*
+            Runs the graph on executor. Throws std::invalid_argument if executor is null or if the edges form a cycle,
+            std::system_error if the graph is already running.
+        */
+        result<void> run(std::shared_ptr<executor> executor);
+    };
+}  // namespace concurrencpp
+
+#endif
@@ -6,6 +6,7 @@
 
 #include "concurrencpp/timers/timer.h"
 #include "concurrencpp/timers/timer_queue.h"
+#include "concurrencpp/timers/timeout_token.h"
 #include "concurrencpp/runtime/runtime.h"
 #include "concurrencpp/results/result.h"
 #include "concurrencpp/results/lazy_result.h"
@@ -17,7 +18,17 @@
 #include "concurrencpp/results/resume_on.h"
 #include "concurrencpp/results/generator.h"
 #include "concurrencpp/executors/executor_all.h"
+#include "concurrencpp/algorithms/parallel_invoke.h"
+#include "concurrencpp/algorithms/parallel_for.h"
+#include "concurrencpp/algorithms/parallel_reduce.h"
+#include "concurrencpp/algorithms/parallel_sort.h"
+#include "concurrencpp/algorithms/numeric.h"
+#include "concurrencpp/algorithms/task_graph.h"
 #include "concurrencpp/threads/async_lock.h"
+#include "concurrencpp/threads/async_shared_lock.h"
+#include "concurrencpp/threads/async_semaphore.h"
+#include "concurrencpp/threads/async_latch.h"
+#include "concurrencpp/threads/async_barrier.h"
 #include "concurrencpp/threads/async_condition_variable.h"
 
 #endif
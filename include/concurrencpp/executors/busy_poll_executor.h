@@ -0,0 +1,61 @@
+#ifndef CONCURRENCPP_BUSY_POLL_EXECUTOR_H
+#define CONCURRENCPP_BUSY_POLL_EXECUTOR_H
+
+#include "concurrencpp/threads/thread.h"
+#include "concurrencpp/threads/cache_line.h"
+#include "concurrencpp/executors/constants.h"
+#include "concurrencpp/executors/derivable_executor.h"
+#include "concurrencpp/executors/impl/mpsc_task_queue.h"
+
+#include <deque>
+#include <chrono>
+#include <optional>
+
+namespace concurrencpp {
+    /*
+        A single thread that never blocks: it spins on its lock-free queue, so a task is picked up within the time of a
+        cache miss instead of a futex wake-up. The thread is started by the constructor and can be pinned to a core,
+        preferably an isolated one. After low_power_spin_after of idleness the thread keeps spinning, but with a pause
+        instruction between polls, which lowers its power usage and leaves the core to a sibling hyperthread.
+    */
+    class CRCPP_API alignas(CRCPP_CACHE_LINE_ALIGNMENT) busy_poll_executor final : public derivable_executor<busy_poll_executor> {
+
+       private:
+        std::deque<task> m_private_queue;
+        std::atomic_bool m_private_atomic_abort;
+        alignas(CRCPP_CACHE_LINE_ALIGNMENT) details::mpsc_task_queue m_public_queue;
+        alignas(CRCPP_CACHE_LINE_ALIGNMENT) std::atomic_bool m_atomic_abort;
+        std::atomic_bool m_pinned;
+        const std::optional<size_t> m_core;
+        const std::chrono::nanoseconds m_low_power_spin_after;
+        details::thread m_thread;
+
+        bool drain_queue();
+        void work_loop();
+
+       public:
+        busy_poll_executor(std::optional<size_t> core = std::nullopt,
+                           std::chrono::nanoseconds low_power_spin_after = std::chrono::nanoseconds::max(),
+                           const std::function<void(std::string_view thread_name)>& thread_started_callback = {},
+                           const std::function<void(std::string_view thread_name)>& thread_terminated_callback = {});
+
+        ~busy_poll_executor() noexcept override;
+
+        void enqueue(concurrencpp::task task) override;
+        void enqueue(std::span<concurrencpp::task> tasks) override;
+
+        int max_concurrency_level() const noexcept override;
+
+        bool shutdown_requested() const override;
+        void shutdown() override;
+
+        std::optional<size_t> core() const noexcept;
+
+        // whether the thread was pinned to core. false until the thread has started, or if pinning isn't supported.
+        bool pinned() const noexcept;
+
+        std::chrono::nanoseconds low_power_spin_after() const noexcept;
+    };
+}  // namespace concurrencpp
+
+#endif
@@ -4,15 +4,20 @@
 #include <limits>
 #include <numeric>
 
+#include <cstddef>
+
 namespace concurrencpp::details::consts {
     inline const char* k_inline_executor_name = "concurrencpp::inline_executor";
     constexpr int k_inline_executor_max_concurrency_level = 0;
 
     inline const char* k_thread_executor_name = "concurrencpp::thread_executor";
     constexpr int k_thread_executor_max_concurrency_level = std::numeric_limits<int>::max();
+    constexpr size_t k_thread_executor_default_max_cached_threads = 16;
+    constexpr size_t k_thread_executor_default_max_idle_time_ms = 10 * 1000;
 
     inline const char* k_thread_pool_executor_name = "concurrencpp::thread_pool_executor";
     inline const char* k_background_executor_name = "concurrencpp::background_executor";
+    constexpr size_t k_thread_pool_help_yield_rounds = 64;  // idle rounds a helping worker yields before it starts sleeping
 
     constexpr int k_worker_thread_max_concurrency_level = 1;
     inline const char* k_worker_thread_executor_name = "concurrencpp::worker_thread_executor";
@@ -20,6 +25,22 @@ namespace concurrencpp::details::consts {
     inline const char* k_manual_executor_name = "concurrencpp::manual_executor";
     constexpr int k_manual_executor_max_concurrency_level = std::numeric_limits<int>::max();
 
+    inline const char* k_strand_executor_name = "concurrencpp::strand_executor";
+    constexpr int k_strand_executor_max_concurrency_level = 1;
+    constexpr size_t k_strand_executor_default_max_batch_size = 64;
+    inline const char* k_strand_executor_null_executor_err_msg = "concurrencpp::strand_executor - given underlying executor is null.";
+    inline const char* k_strand_executor_zero_batch_size_err_msg = "concurrencpp::strand_executor - max_batch_size must be positive.";
+
+    inline const char* k_busy_poll_executor_name = "concurrencpp::busy_poll_executor";
+    constexpr int k_busy_poll_executor_max_concurrency_level = 1;
+    constexpr size_t k_busy_poll_executor_clock_check_interval = 1024;
+
+    inline const char* k_keyed_executor_name = "concurrencpp::keyed_executor";
+    constexpr size_t k_keyed_executor_default_lane_count = 64;
+    constexpr size_t k_keyed_executor_buckets_per_lane = 8;
+    inline const char* k_keyed_executor_null_executor_err_msg = "concurrencpp::keyed_executor - given underlying executor is null.";
+    inline const char* k_keyed_executor_zero_lane_count_err_msg = "concurrencpp::keyed_executor - lane_count must be positive.";
+
     inline const char* k_timer_queue_name = "concurrencpp::timer_queue";
 
     inline const char* k_executor_shutdown_err_msg = " - shutdown has been called on this executor.";
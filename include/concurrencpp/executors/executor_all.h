@@ -7,5 +7,8 @@
 #include "concurrencpp/executors/thread_executor.h"
 #include "concurrencpp/executors/worker_thread_executor.h"
 #include "concurrencpp/executors/manual_executor.h"
+#include "concurrencpp/executors/strand_executor.h"
+#include "concurrencpp/executors/keyed_executor.h"
+#include "concurrencpp/executors/busy_poll_executor.h"
 
 #endif
@@ -0,0 +1,90 @@
+#ifndef CONCURRENCPP_KEYED_LANE_TABLE_H
+#define CONCURRENCPP_KEYED_LANE_TABLE_H
+
+#include "concurrencpp/threads/cache_line.h"
+#include "concurrencpp/platform_defs.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <cstddef>
+
+namespace concurrencpp::details {
+    /*
+        The routing of a keyed_executor. Keys are hashed onto buckets and every bucket is routed to a lane. A bucket counts
+        its tasks which weren't released yet, and can be routed to another lane only while that count is zero: the tasks
+        it had on the old lane are done by then, so the tasks it gets on the new lane can't overtake them.
+        The table is shared with the tasks themselves, so releasing a task never touches a destroyed keyed_executor.
+    */
+    class CRCPP_API keyed_lane_table {
+
+       private:
+        // a bucket being re-routed has this bit set in its state, producers wait for it to be cleared.
+        static constexpr size_t k_migrating_bit = size_t(1) << (sizeof(size_t) * 8 - 1);
+
+        struct alignas(CRCPP_CACHE_LINE_ALIGNMENT) bucket {
+            std::atomic_size_t state {0};  // unreleased tasks | k_migrating_bit
+            std::atomic_size_t lane {0};
+            std::atomic_size_t load {0};  // tasks acquired since the last call to take_loads
+        };
+
+        struct alignas(CRCPP_CACHE_LINE_ALIGNMENT) lane {
+            std::atomic_size_t depth {0};
+        };
+
+        const size_t m_lane_count;
+        const std::unique_ptr<bucket[]> m_buckets;
+        const size_t m_bucket_count;
+        const std::unique_ptr<lane[]> m_lanes;
+
+       public:
+        keyed_lane_table(size_t lane_count, size_t buckets_per_lane);
+
+        size_t lane_count() const noexcept {
+            return m_lane_count;
+        }
+
+        size_t bucket_count() const noexcept {
+            return m_bucket_count;
+        }
+
+        size_t bucket_of(size_t hash) const noexcept;
+        size_t lane_of_bucket(size_t bucket_index) const noexcept;
+        size_t lane_depth(size_t lane_index) const noexcept;
+
+        // counts a task of the bucket and returns the lane it must be executed on.
+        size_t acquire(size_t bucket_index) noexcept;
+        void release(size_t bucket_index, size_t lane_index) noexcept;
+
+        // routes an idle bucket to another lane, returns false if the bucket has unreleased tasks.
+        bool try_migrate(size_t bucket_index, size_t lane_index) noexcept;
+
+        // returns the load of every bucket since the last call and resets it.
+        std::vector<size_t> take_loads();
+    };
+
+    // releases the bucket and the lane of a keyed task once the task was executed or discarded.
+    class CRCPP_API keyed_lane_ticket {
+
+       private:
+        std::shared_ptr<keyed_lane_table> m_table;
+        size_t m_bucket_index;
+        size_t m_lane_index;
+
+       public:
+        keyed_lane_ticket(std::shared_ptr<keyed_lane_table> table, size_t bucket_index) noexcept;
+        keyed_lane_ticket(keyed_lane_ticket&& rhs) noexcept = default;
+        ~keyed_lane_ticket() noexcept;
+
+        keyed_lane_ticket(const keyed_lane_ticket&) = delete;
+        keyed_lane_ticket& operator=(const keyed_lane_ticket&) = delete;
+        keyed_lane_ticket& operator=(keyed_lane_ticket&&) = delete;
+
+        size_t lane_index() const noexcept {
+            return m_lane_index;
+        }
+    };
+}  // namespace concurrencpp::details
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef CONCURRENCPP_MPSC_TASK_QUEUE_H
+#define CONCURRENCPP_MPSC_TASK_QUEUE_H
+
+#include "concurrencpp/task.h"
+#include "concurrencpp/platform_defs.h"
+
+#include <span>
+#include <deque>
+#include <atomic>
+
+namespace concurrencpp::details {
+    /*
+        An unbounded lock-free multi-producer single-consumer queue of tasks. Producers push nodes onto an intrusive
+        stack with a single CAS, a span of tasks is linked privately and pushed as a whole. The consumer takes the whole
+        stack with a single exchange and reverses it, so it pays one atomic operation per batch instead of one per task.
+    */
+    class CRCPP_API mpsc_task_queue {
+
+       private:
+        struct node {
+            task value;
+            node* next = nullptr;
+        };
+
+        std::atomic<node*> m_head {nullptr};
+
+        void push_chain(node* first, node* last) noexcept;
+        static void delete_chain(node* head) noexcept;
+
+       public:
+        mpsc_task_queue() noexcept = default;
+        ~mpsc_task_queue() noexcept;
+
+        mpsc_task_queue(const mpsc_task_queue&) = delete;
+        mpsc_task_queue& operator=(const mpsc_task_queue&) = delete;
+
+        // any thread. the tasks are moved only once their nodes were allocated, so on std::bad_alloc they're left intact.
+        void push(task& task);
+        void push(std::span<task> tasks);
+
+        bool empty() const noexcept;
+
+        // consumer only. moves the pending tasks to the back of queue in the order they were pushed, returns their count.
+        size_t pop_all(std::deque<task>& queue);
+
+        // consumer only, or once no producer is left. destroys the pending tasks.
+        void clear() noexcept;
+    };
+}  // namespace concurrencpp::details
+
+#endif
@@ -0,0 +1,101 @@
+#ifndef CONCURRENCPP_KEYED_EXECUTOR_H
+#define CONCURRENCPP_KEYED_EXECUTOR_H
+
+#include "concurrencpp/utils/bind.h"
+#include "concurrencpp/executors/constants.h"
+#include "concurrencpp/executors/strand_executor.h"
+#include "concurrencpp/executors/impl/keyed_lane_table.h"
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <functional>
+#include <type_traits>
+
+namespace concurrencpp {
+    /*
+        Executes the tasks of the same key one at a time and in the order they were posted, and the tasks of different
+        keys in parallel. Keys are hashed onto buckets, buckets are routed to a fixed number of lanes and every lane is a
+        strand_executor over the underlying executor. rebalance re-routes idle buckets away from the lanes that had the
+        most tasks, so keys that share a lane with a hot key stop queueing behind it.
+    */
+    class CRCPP_API keyed_executor {
+
+       private:
+        const std::shared_ptr<executor> m_underlying_executor;
+        const std::shared_ptr<details::keyed_lane_table> m_table;
+        std::vector<std::shared_ptr<strand_executor>> m_lanes;
+        std::mutex m_rebalance_lock;
+        std::atomic_bool m_atomic_abort;
+
+        template<class key_type>
+        size_t bucket_of(const key_type& key) const noexcept(noexcept(std::hash<key_type> {}(key))) {
+            return m_table->bucket_of(std::hash<key_type> {}(key));
+        }
+
+        details::keyed_lane_ticket make_ticket(size_t bucket_index) const;
+
+       public:
+        keyed_executor(std::shared_ptr<executor> underlying_executor,
+                       size_t lane_count = details::consts::k_keyed_executor_default_lane_count,
+                       size_t max_batch_size = details::consts::k_strand_executor_default_max_batch_size);
+
+        ~keyed_executor() noexcept;
+
+        keyed_executor(const keyed_executor&) = delete;
+        keyed_executor& operator=(const keyed_executor&) = delete;
+
+        template<class key_type, class callable_type, class... argument_types>
+        void post(const key_type& key, callable_type&& callable, argument_types&&... arguments) {
+            static_assert(std::is_invocable_v<callable_type, argument_types...>,
+                          "concurrencpp::keyed_executor::post - <<callable_type>> is not invokable with <<argument_types...>>");
+
+            auto ticket = make_ticket(bucket_of(key));
+            auto& lane = *m_lanes[ticket.lane_index()];
+
+            lane.post([ticket = std::move(ticket),
+                       callable = details::bind(std::forward<callable_type>(callable),
+                                                std::forward<argument_types>(arguments)...)]() mutable {
+                callable();
+            });
+        }
+
+        template<class key_type, class callable_type, class... argument_types>
+        auto submit(const key_type& key, callable_type&& callable, argument_types&&... arguments) {
+            static_assert(std::is_invocable_v<callable_type, argument_types...>,
+                          "concurrencpp::keyed_executor::submit - <<callable_type>> is not invokable with <<argument_types...>>");
+
+            using return_type = typename std::invoke_result_t<callable_type, argument_types...>;
+
+            auto ticket = make_ticket(bucket_of(key));
+            auto& lane = *m_lanes[ticket.lane_index()];
+
+            return lane.submit([ticket = std::move(ticket),
+                                callable = details::bind(std::forward<callable_type>(callable),
+                                                         std::forward<argument_types>(arguments)...)]() mutable -> return_type {
+                return callable();
+            });
+        }
+
+        template<class key_type>
+        size_t lane_of(const key_type& key) const noexcept(noexcept(std::hash<key_type> {}(key))) {
+            return m_table->lane_of_bucket(bucket_of(key));
+        }
+
+        size_t lane_count() const noexcept;
+
+        // the number of tasks every lane has which weren't executed yet.
+        std::vector<size_t> lane_depths() const;
+
+        // re-routes idle buckets from the lanes that had the most tasks since the last call, returns the number of moved buckets.
+        size_t rebalance();
+
+        std::shared_ptr<executor> underlying_executor() const noexcept;
+
+        void shutdown();
+        bool shutdown_requested() const noexcept;
+    };
+}  // namespace concurrencpp
+
+#endif
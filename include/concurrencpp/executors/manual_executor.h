@@ -3,39 +3,66 @@
 
 #include "concurrencpp/threads/cache_line.h"
 #include "concurrencpp/executors/derivable_executor.h"
+#include "concurrencpp/executors/impl/mpsc_task_queue.h"
 
 #include <deque>
 #include <mutex>
 #include <chrono>
+#include <type_traits>
 #include <condition_variable>
 
 namespace concurrencpp {
+    /*
+        Producers push tasks onto a lock-free queue and only take m_lock when a thread is blocked waiting for tasks.
+        Consumers move the pushed tasks into m_tasks under m_lock, take a whole batch and execute it outside the lock.
+        Deadlines are measured on std::chrono::steady_clock, so adjustments of the system clock don't affect them.
+    */
     class CRCPP_API alignas(CRCPP_CACHE_LINE_ALIGNMENT) manual_executor final : public derivable_executor<manual_executor> {
 
        private:
+        using time_point = std::chrono::steady_clock::time_point;
+
         mutable std::mutex m_lock;
-        std::deque<task> m_tasks;
+        mutable std::deque<task> m_tasks;  // the pushed tasks are collected into it by const methods as well
         std::condition_variable m_condition;
         bool m_abort;
         std::atomic_bool m_atomic_abort;
+        std::atomic_size_t m_waiters;  // threads blocked on m_condition, producers skip m_lock when there are none
+        mutable details::mpsc_task_queue m_pushed_tasks;
 
         template<class clock_type, class duration_type>
-        static std::chrono::system_clock::time_point to_system_time_point(
-            std::chrono::time_point<clock_type, duration_type> time_point) noexcept(noexcept(clock_type::now())) {
-            const auto src_now = clock_type::now();
-            const auto dst_now = std::chrono::system_clock::now();
-            return dst_now + std::chrono::duration_cast<std::chrono::milliseconds>(time_point - src_now);
+        static time_point to_steady_time_point(std::chrono::time_point<clock_type, duration_type> timeout_time) noexcept(
+            noexcept(clock_type::now())) {
+            if constexpr (std::is_same_v<clock_type, std::chrono::steady_clock>) {
+                return std::chrono::time_point_cast<time_point::duration>(timeout_time);
+            } else {
+                const auto src_now = clock_type::now();
+                const auto dst_now = std::chrono::steady_clock::now();
+                return dst_now + std::chrono::duration_cast<time_point::duration>(timeout_time - src_now);
+            }
         }
 
-        static std::chrono::system_clock::time_point time_point_from_now(std::chrono::milliseconds ms) noexcept {
-            return std::chrono::system_clock::now() + ms;
+        static time_point time_point_from_now(std::chrono::milliseconds ms) noexcept {
+            return std::chrono::steady_clock::now() + ms;
         }
 
+        void notify_waiters();
+        size_t collect_tasks() const;
+        void take_batch(std::deque<task>& batch, size_t max_count);
+        void return_batch(std::deque<task>& batch);
+        size_t execute_batch(std::deque<task>& batch, time_point deadline = time_point::max());
+
+        template<class predicate_type>
+        void wait(std::unique_lock<std::mutex>& lock, predicate_type predicate);
+
+        template<class predicate_type>
+        bool wait_until(std::unique_lock<std::mutex>& lock, time_point deadline, predicate_type predicate);
+
         size_t loop_impl(size_t max_count);
-        size_t loop_until_impl(size_t max_count, std::chrono::time_point<std::chrono::system_clock> deadline);
+        size_t loop_until_impl(size_t max_count, time_point deadline);
 
         void wait_for_tasks_impl(size_t count);
-        size_t wait_for_tasks_impl(size_t count, std::chrono::time_point<std::chrono::system_clock> deadline);
+        size_t wait_for_tasks_impl(size_t count, time_point deadline);
 
        public:
         manual_executor();
@@ -58,7 +85,7 @@ namespace concurrencpp {
 
         template<class clock_type, class duration_type>
         bool loop_once_until(std::chrono::time_point<clock_type, duration_type> timeout_time) {
-            return loop_until_impl(1, to_system_time_point(timeout_time));
+            return loop_until_impl(1, to_steady_time_point(timeout_time));
         }
 
         size_t loop(size_t max_count);
@@ -66,7 +93,7 @@ namespace concurrencpp {
 
         template<class clock_type, class duration_type>
         size_t loop_until(size_t max_count, std::chrono::time_point<clock_type, duration_type> timeout_time) {
-            return loop_until_impl(max_count, to_system_time_point(timeout_time));
+            return loop_until_impl(max_count, to_steady_time_point(timeout_time));
         }
 
         void wait_for_task();
@@ -74,7 +101,7 @@ namespace concurrencpp {
 
         template<class clock_type, class duration_type>
         bool wait_for_task_until(std::chrono::time_point<clock_type, duration_type> timeout_time) {
-            return wait_for_tasks_impl(1, to_system_time_point(timeout_time)) == 1;
+            return wait_for_tasks_impl(1, to_steady_time_point(timeout_time)) == 1;
         }
 
         void wait_for_tasks(size_t count);
@@ -82,7 +109,7 @@ namespace concurrencpp {
 
         template<class clock_type, class duration_type>
         size_t wait_for_tasks_until(size_t count, std::chrono::time_point<clock_type, duration_type> timeout_time) {
-            return wait_for_tasks_impl(count, to_system_time_point(timeout_time));
+            return wait_for_tasks_impl(count, to_steady_time_point(timeout_time));
         }
     };
 }  // namespace concurrencpp
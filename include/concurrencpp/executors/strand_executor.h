@@ -0,0 +1,58 @@
+#ifndef CONCURRENCPP_STRAND_EXECUTOR_H
+#define CONCURRENCPP_STRAND_EXECUTOR_H
+
+#include "concurrencpp/threads/cache_line.h"
+#include "concurrencpp/executors/constants.h"
+#include "concurrencpp/executors/derivable_executor.h"
+#include "concurrencpp/executors/impl/mpsc_task_queue.h"
+
+#include <deque>
+#include <memory>
+
+namespace concurrencpp {
+    /*
+        Executes its tasks one at a time and in the order they were enqueued, on top of another executor and without
+        a thread of its own. Tasks are pushed to a lock-free queue, the producer that makes the strand non-empty schedules
+        a drain task on the underlying executor. The drain task executes a batch of tasks and reschedules itself only if
+        more tasks are pending, so an idle strand costs nothing but its memory.
+        A strand_executor must be owned by a std::shared_ptr, a scheduled drain task keeps it alive.
+        If the underlying executor can't run a drain task anymore, the strand shuts itself down: its pending tasks are
+        discarded and further enqueues throw errors::runtime_shutdown.
+    */
+    class CRCPP_API alignas(CRCPP_CACHE_LINE_ALIGNMENT) strand_executor final :
+        public derivable_executor<strand_executor>,
+        public std::enable_shared_from_this<strand_executor> {
+
+       private:
+        class drain_task;
+
+        const std::shared_ptr<executor> m_underlying_executor;
+        const size_t m_max_batch_size;
+        details::mpsc_task_queue m_queue;
+        std::atomic_size_t m_pending;  // enqueued tasks which weren't executed yet. whoever raises it from 0 owns the strand
+        std::atomic_bool m_atomic_abort;
+        std::deque<task> m_batch;  // only accessed by the owner of the strand
+
+        void schedule();
+        void drain();
+        void discard_tasks() noexcept;
+        void abandon() noexcept;
+
+       public:
+        strand_executor(std::shared_ptr<executor> underlying_executor,
+                        size_t max_batch_size = details::consts::k_strand_executor_default_max_batch_size);
+
+        void enqueue(concurrencpp::task task) override;
+        void enqueue(std::span<concurrencpp::task> tasks) override;
+
+        int max_concurrency_level() const noexcept override;
+
+        bool shutdown_requested() const override;
+        void shutdown() override;
+
+        std::shared_ptr<executor> underlying_executor() const noexcept;
+        size_t max_batch_size() const noexcept;
+    };
+}  // namespace concurrencpp
+
+#endif
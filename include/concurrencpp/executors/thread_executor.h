@@ -3,32 +3,56 @@
 
 #include "concurrencpp/threads/thread.h"
 #include "concurrencpp/threads/cache_line.h"
+#include "concurrencpp/executors/constants.h"
 #include "concurrencpp/executors/derivable_executor.h"
 
 #include <list>
 #include <span>
 #include <mutex>
+#include <chrono>
 #include <condition_variable>
 
 namespace concurrencpp {
+    /*
+        Runs every task on a thread of its own. A thread that finishes its task is parked for up to max_idle_time,
+        waiting to be handed the next task instead of a new thread being created for it. At most max_cached_threads
+        threads are parked at any time, the rest exit when their task is done.
+    */
     class CRCPP_API alignas(CRCPP_CACHE_LINE_ALIGNMENT) thread_executor final : public derivable_executor<thread_executor> {
 
        private:
+        struct worker {
+            details::thread thread;
+            task next_task;
+            std::condition_variable condition;
+            bool has_task = false;
+        };
+
+        using worker_list = std::list<worker>;
+
         std::mutex m_lock;
-        std::list<details::thread> m_workers;
+        worker_list m_workers;         // running a task
+        worker_list m_parked_workers;  // waiting for a task, the most recently parked first
         std::condition_variable m_condition;
-        std::list<details::thread> m_last_retired;
+        worker_list m_last_retired;
         bool m_abort;
         std::atomic_bool m_atomic_abort;
+        const size_t m_max_cached_threads;
+        const std::chrono::milliseconds m_max_idle_time;
         const std::function<void(std::string_view thread_name)> m_thread_started_callback;
         const std::function<void(std::string_view thread_name)> m_thread_terminated_callback;
 
         void enqueue_impl(std::unique_lock<std::mutex>& lock, task& task);
-        void retire_worker(std::list<details::thread>::iterator it);
+        void work_loop(worker_list::iterator self_it, task first_task);
+        bool park_worker(std::unique_lock<std::mutex>& lock, worker_list::iterator self_it);
+        void retire_worker(std::unique_lock<std::mutex>& lock, worker_list& list, worker_list::iterator it);
 
        public:
         thread_executor(const std::function<void(std::string_view thread_name)>& thread_started_callback = {},
-                        const std::function<void(std::string_view thread_name)>& thread_terminated_callback = {});
+                        const std::function<void(std::string_view thread_name)>& thread_terminated_callback = {},
+                        size_t max_cached_threads = details::consts::k_thread_executor_default_max_cached_threads,
+                        std::chrono::milliseconds max_idle_time =
+                            std::chrono::milliseconds(details::consts::k_thread_executor_default_max_idle_time_ms));
         ~thread_executor() noexcept;
 
         void enqueue(task task) override;
@@ -38,6 +62,9 @@ namespace concurrencpp {
 
         bool shutdown_requested() const override;
         void shutdown() override;
+
+        size_t max_cached_threads() const noexcept;
+        std::chrono::milliseconds max_worker_idle_time() const noexcept;
     };
 }  // namespace concurrencpp
 
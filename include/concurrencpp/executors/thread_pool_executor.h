@@ -37,12 +37,22 @@ namespace concurrencpp::details {
 
 namespace concurrencpp::details {
     class thread_pool_worker;
+    class fork_join_child;
+
+    /*
+        Called by blocking waits. If the calling thread is a thread_pool_executor worker, it executes queued tasks - its
+        own, then tasks stolen from the other workers of its pool - until ready(context) returns true, and returns true.
+        A worker that waits for a task queued behind it in the same pool runs that task instead of deadlocking the pool.
+        Returns false right away if the calling thread isn't a worker, or once its pool is shut down.
+    */
+    CRCPP_API bool help_thread_pool_until(bool (*ready)(const void* context) noexcept, const void* context);
 }  // namespace concurrencpp::details
 
 namespace concurrencpp {
     class CRCPP_API alignas(CRCPP_CACHE_LINE_ALIGNMENT) thread_pool_executor final : public derivable_executor<thread_pool_executor> {
 
         friend class details::thread_pool_worker;
+        friend class details::fork_join_child;
 
        private:
         std::vector<details::thread_pool_worker> m_workers;
@@ -55,6 +65,11 @@ namespace concurrencpp {
         void find_idle_workers(size_t caller_index, std::vector<size_t>& buffer, size_t max_count) noexcept;
 
         details::thread_pool_worker& worker_at(size_t index) noexcept;
+        bool steal_task(size_t caller_index, task& task);
+
+        // for fork-join: reserves an idle worker (returns -1 if there is none) and enqueues a task on it.
+        size_t acquire_idle_worker() noexcept;
+        void enqueue_to_worker(size_t index, task& task);
 
        public:
         thread_pool_executor(std::string_view pool_name,
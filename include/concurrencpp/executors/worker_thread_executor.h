@@ -3,32 +3,40 @@
 
 #include "concurrencpp/threads/thread.h"
 #include "concurrencpp/threads/cache_line.h"
+#include "concurrencpp/threads/impl/event_count.h"
 #include "concurrencpp/executors/derivable_executor.h"
+#include "concurrencpp/executors/impl/mpsc_task_queue.h"
 
 #include <deque>
 #include <mutex>
-#include <semaphore>
 
 namespace concurrencpp {
+    /*
+        A single thread that executes its tasks in order. Foreign threads push their tasks to a lock-free queue which
+        the worker takes in batches, and signal it through an event count only when it's actually waiting. Tasks
+        enqueued by the worker itself go straight to its private queue.
+    */
     class CRCPP_API alignas(CRCPP_CACHE_LINE_ALIGNMENT) worker_thread_executor final :
         public derivable_executor<worker_thread_executor> {
 
        private:
         std::deque<task> m_private_queue;
         std::atomic_bool m_private_atomic_abort;
-        alignas(CRCPP_CACHE_LINE_ALIGNMENT) std::mutex m_lock;
-        std::deque<task> m_public_queue;
-        std::binary_semaphore m_semaphore;
-        details::thread m_thread;
+        alignas(CRCPP_CACHE_LINE_ALIGNMENT) details::mpsc_task_queue m_public_queue;
+        details::event_count m_event_count;
+        std::atomic_bool m_thread_started;
         std::atomic_bool m_atomic_abort;
+        alignas(CRCPP_CACHE_LINE_ALIGNMENT) std::mutex m_lock;  // guards the creation and the joining of m_thread
+        details::thread m_thread;
         bool m_abort;
         const std::function<void(std::string_view)> m_thread_started_callback;
         const std::function<void(std::string_view)> m_thread_terminated_callback;
 
         void make_os_worker_thread();
+        void ensure_worker_thread();
         bool drain_queue_impl();
         bool drain_queue();
-        void wait_for_task(std::unique_lock<std::mutex>& lock);
+        bool wait_for_task();
         void work_loop();
 
         void enqueue_local(concurrencpp::task& task);
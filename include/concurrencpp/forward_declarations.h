@@ -20,6 +20,7 @@ namespace concurrencpp {
 
     class timer_queue;
     class timer;
+    enum class timer_queue_backend;
 
     class executor;
     class inline_executor;
@@ -27,11 +28,18 @@ namespace concurrencpp {
     class thread_executor;
     class worker_thread_executor;
     class manual_executor;
+    class strand_executor;
+    class keyed_executor;
+    class busy_poll_executor;
 
     template<typename type>
     class generator;
 
     class async_lock;
+    class async_shared_lock;
+    class async_semaphore;
+    class async_latch;
+    class async_barrier;
     class async_condition_variable;
 }  // namespace concurrencpp
 
@@ -38,6 +38,21 @@ namespace concurrencpp::details::consts {
 
     inline const char* k_result_resolve_error_msg = "concurrencpp::result::resolve() - result is empty.";
 
+    inline const char* k_result_with_timeout_error_msg = "concurrencpp::result::with_timeout() - result is empty.";
+
+    inline const char* k_result_with_timeout_null_timer_queue_error_msg = "concurrencpp::result::with_timeout() - given timer_queue is null.";
+
+    inline const char* k_result_with_timeout_null_executor_error_msg = "concurrencpp::result::with_timeout() - given executor is null.";
+
+    inline const char* k_result_async_wait_for_error_msg = "concurrencpp::result::async_wait_for() - result is empty.";
+
+    inline const char* k_result_async_wait_for_null_timer_queue_error_msg =
+        "concurrencpp::result::async_wait_for() - given timer_queue is null.";
+
+    inline const char* k_result_async_wait_for_null_executor_error_msg = "concurrencpp::result::async_wait_for() - given executor is null.";
+
+    inline const char* k_result_timeout_error_msg = "concurrencpp::result - the result wasn't ready before the timeout.";
+
     inline const char* k_executor_exception_error_msg =
         "concurrencpp::concurrencpp::result - an exception was thrown while trying to enqueue result continuation.";
 
@@ -89,6 +104,13 @@ namespace concurrencpp::details::consts {
 
     inline const char* k_empty_lazy_result_run_err_msg = "concurrencpp::lazy_result::run - result is empty.";
 
+    inline const char* k_empty_lazy_result_with_timeout_err_msg = "concurrencpp::lazy_result::with_timeout - result is empty.";
+
+    inline const char* k_lazy_result_with_timeout_null_timer_queue_err_msg =
+        "concurrencpp::lazy_result::with_timeout - given timer_queue is null.";
+
+    inline const char* k_lazy_result_with_timeout_null_executor_err_msg = "concurrencpp::lazy_result::with_timeout - given executor is null.";
+
     /*
      * resume_on
      */
@@ -8,6 +8,8 @@
 #include <semaphore>
 
 namespace concurrencpp::details {
+    class result_timeout_context;
+
     class CRCPP_API await_via_functor {
 
        private:
@@ -45,13 +47,14 @@ namespace concurrencpp::details {
     class CRCPP_API consumer_context {
 
        private:
-        enum class consumer_status { idle, await, wait_for, when_any, shared };
+        enum class consumer_status { idle, await, wait_for, when_any, shared, timeout };
 
         union storage {
             coroutine_handle<void> caller_handle;
             std::shared_ptr<std::binary_semaphore> wait_for_ctx;
             std::shared_ptr<when_any_context> when_any_ctx;
             std::weak_ptr<shared_result_state_base> shared_ctx;
+            result_timeout_context* timeout_ctx;
 
             storage() noexcept {}
             ~storage() noexcept {}
@@ -73,6 +76,7 @@ namespace concurrencpp::details {
         void set_wait_for_context(const std::shared_ptr<std::binary_semaphore>& wait_ctx) noexcept;
         void set_when_any_context(const std::shared_ptr<when_any_context>& when_any_ctx) noexcept;
         void set_shared_context(const std::shared_ptr<shared_result_state_base>& shared_ctx) noexcept;
+        void set_timeout_context(result_timeout_context& timeout_ctx) noexcept;
     };
 }  // namespace concurrencpp::details
 
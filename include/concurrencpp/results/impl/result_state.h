@@ -30,7 +30,11 @@ namespace concurrencpp::details {
 
         void share(const std::shared_ptr<shared_result_state_base>& shared_result_state) noexcept;
 
-        void try_rewind_consumer() noexcept;
+        // returns true if the consumer was set, false if the result is already ready.
+        bool await_with_timeout(result_timeout_context& timeout_ctx) noexcept;
+
+        // returns true if the consumer was rewound, false if there was none or the producer has already completed.
+        bool try_rewind_consumer() noexcept;
     };
 
     template<class type>
@@ -0,0 +1,58 @@
+#ifndef CONCURRENCPP_RESULT_TIMEOUT_CONTEXT_H
+#define CONCURRENCPP_RESULT_TIMEOUT_CONTEXT_H
+
+#include "concurrencpp/timers/timeout_token.h"
+#include "concurrencpp/coroutines/coroutine.h"
+#include "concurrencpp/results/result_fwd_declarations.h"
+
+#include <atomic>
+#include <memory>
+#include <chrono>
+#include <exception>
+
+namespace concurrencpp::details {
+    /*
+        The consumer of a result awaited with a timeout. The context is also the timeout token of the await, so a single
+        timer is armed and nothing is allocated. Whichever of the producer and the timer completes first resumes the caller
+        through the executor, the other one backs off:
+        the timer rewinds the consumer of the result before resuming the caller, so the result stays usable after a timeout,
+        the producer disarms the timer, which waits for a timeout that is already running.
+    */
+    class CRCPP_API result_timeout_context final : public timeout_token_base {
+
+       private:
+        enum class stage { suspending, suspended, result_ready, timed_out };
+
+        std::atomic<stage> m_stage {stage::suspending};
+        result_state_base& m_state;
+        const std::shared_ptr<timer_queue> m_timer_queue;
+        const std::shared_ptr<executor> m_executor;
+        const duration m_timeout;
+        coroutine_handle<void> m_caller_handle;
+        std::exception_ptr m_error;
+        bool m_interrupted = false;
+
+        void on_timeout() noexcept override;
+        void resume_caller() noexcept;
+
+       public:
+        result_timeout_context(result_state_base& state,
+                               std::shared_ptr<timer_queue> timer_queue,
+                               duration timeout,
+                               std::shared_ptr<executor> executor) noexcept;
+
+        ~result_timeout_context() noexcept;
+
+        // returns false if the caller shouldn't be suspended: the result is ready, the timeout has passed or the timer
+        // couldn't be armed.
+        bool await_suspend(coroutine_handle<void> caller_handle) noexcept;
+
+        // called by the producer once the result is ready
+        void on_result_finished() noexcept;
+
+        // throws if the caller was interrupted or the timer couldn't be armed. returns true if the result is ready.
+        bool await_resume() const;
+    };
+}  // namespace concurrencpp::details
+
+#endif
@@ -24,6 +24,14 @@ namespace concurrencpp {
             co_return co_await self;
         }
 
+        static lazy_result<type> with_timeout_impl(lazy_result self,
+                                                   std::shared_ptr<timer_queue> timer_queue,
+                                                   std::chrono::nanoseconds timeout,
+                                                   std::shared_ptr<executor> executor) {
+            auto running = self.run();
+            co_return co_await running.with_timeout(std::move(timer_queue), timeout, std::move(executor));
+        }
+
        public:
         lazy_result() noexcept = default;
 
@@ -73,6 +81,26 @@ namespace concurrencpp {
             throw_if_empty(details::consts::k_empty_lazy_result_run_err_msg);
             return run_impl();
         }
+
+        /*
+            Returns a lazy result that, once awaited, starts this task and awaits it for at most timeout, then resumes the
+            caller on executor. If timeout passes first, throws errors::timeout and the task keeps running detached.
+        */
+        lazy_result<type> with_timeout(std::shared_ptr<timer_queue> timer_queue,
+                                       std::chrono::nanoseconds timeout,
+                                       std::shared_ptr<executor> executor) {
+            throw_if_empty(details::consts::k_empty_lazy_result_with_timeout_err_msg);
+
+            if (!static_cast<bool>(timer_queue)) {
+                throw std::invalid_argument(details::consts::k_lazy_result_with_timeout_null_timer_queue_err_msg);
+            }
+
+            if (!static_cast<bool>(executor)) {
+                throw std::invalid_argument(details::consts::k_lazy_result_with_timeout_null_executor_err_msg);
+            }
+
+            return with_timeout_impl(std::move(*this), std::move(timer_queue), timeout, std::move(executor));
+        }
     };
 }  // namespace concurrencpp
 
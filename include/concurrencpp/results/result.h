@@ -90,6 +90,44 @@ namespace concurrencpp {
             throw_if_empty(details::consts::k_result_resolve_error_msg);
             return resolve_awaitable<type> {std::move(m_state)};
         }
+
+        /*
+            Awaits the result for at most timeout, then resumes the caller on executor. Returns the value or rethrows the
+            exception of the result, which is consumed. If timeout passes first, throws errors::timeout and *this stays usable.
+        */
+        auto with_timeout(std::shared_ptr<timer_queue> timer_queue, std::chrono::nanoseconds timeout, std::shared_ptr<executor> executor) {
+            throw_if_empty(details::consts::k_result_with_timeout_error_msg);
+
+            if (!static_cast<bool>(timer_queue)) {
+                throw std::invalid_argument(details::consts::k_result_with_timeout_null_timer_queue_error_msg);
+            }
+
+            if (!static_cast<bool>(executor)) {
+                throw std::invalid_argument(details::consts::k_result_with_timeout_null_executor_error_msg);
+            }
+
+            return timeout_awaitable<type> {m_state, std::move(timer_queue), timeout, std::move(executor)};
+        }
+
+        /*
+            Like wait_for, but asynchronous: awaits the result for at most timeout, then resumes the caller on executor.
+            Returns the status of the result, result_status::idle if timeout has passed. *this is not consumed.
+        */
+        auto async_wait_for(std::shared_ptr<timer_queue> timer_queue,
+                            std::chrono::nanoseconds timeout,
+                            std::shared_ptr<executor> executor) {
+            throw_if_empty(details::consts::k_result_async_wait_for_error_msg);
+
+            if (!static_cast<bool>(timer_queue)) {
+                throw std::invalid_argument(details::consts::k_result_async_wait_for_null_timer_queue_error_msg);
+            }
+
+            if (!static_cast<bool>(executor)) {
+                throw std::invalid_argument(details::consts::k_result_async_wait_for_null_executor_error_msg);
+            }
+
+            return wait_for_awaitable<type> {m_state, std::move(timer_queue), timeout, std::move(executor)};
+        }
     };
 }  // namespace concurrencpp
 
@@ -1,8 +1,11 @@
 #ifndef CONCURRENCPP_RESULT_AWAITABLE_H
 #define CONCURRENCPP_RESULT_AWAITABLE_H
 
+#include "concurrencpp/errors.h"
 #include "concurrencpp/coroutines/coroutine.h"
+#include "concurrencpp/results/constants.h"
 #include "concurrencpp/results/impl/result_state.h"
+#include "concurrencpp/results/impl/result_timeout_context.h"
 
 namespace concurrencpp::details {
     template<class type>
@@ -16,6 +19,30 @@ namespace concurrencpp::details {
         awaitable_base(const awaitable_base&) = delete;
         awaitable_base(awaitable_base&&) = delete;
     };
+
+    // borrows the state of the awaited result, which stays usable if the timeout passes first.
+    template<class type>
+    class timeout_awaitable_base : public suspend_always {
+       protected:
+        consumer_result_state_ptr<type>& m_state;
+        result_timeout_context m_context;
+
+       public:
+        timeout_awaitable_base(consumer_result_state_ptr<type>& state,
+                               std::shared_ptr<timer_queue> timer_queue,
+                               std::chrono::nanoseconds timeout,
+                               std::shared_ptr<executor> executor) noexcept :
+            m_state(state),
+            m_context(*state, std::move(timer_queue), timeout, std::move(executor)) {}
+
+        timeout_awaitable_base(const timeout_awaitable_base&) = delete;
+        timeout_awaitable_base(timeout_awaitable_base&&) = delete;
+
+        bool await_suspend(coroutine_handle<void> caller_handle) noexcept {
+            assert(static_cast<bool>(m_state));
+            return m_context.await_suspend(caller_handle);
+        }
+    };
 }  // namespace concurrencpp::details
 
 namespace concurrencpp {
@@ -54,6 +81,37 @@ namespace concurrencpp {
             return result<type>(std::move(this->m_state));
         }
     };
+
+    template<class type>
+    class timeout_awaitable : public details::timeout_awaitable_base<type> {
+
+       public:
+        using details::timeout_awaitable_base<type>::timeout_awaitable_base;
+
+        type await_resume() {
+            if (!this->m_context.await_resume()) {
+                throw errors::timeout(details::consts::k_result_timeout_error_msg);
+            }
+
+            details::joined_consumer_result_state_ptr<type> state(this->m_state.release());
+            return state->get();
+        }
+    };
+
+    template<class type>
+    class wait_for_awaitable : public details::timeout_awaitable_base<type> {
+
+       public:
+        using details::timeout_awaitable_base<type>::timeout_awaitable_base;
+
+        result_status await_resume() {
+            if (!this->m_context.await_resume()) {
+                return result_status::idle;
+            }
+
+            return this->m_state->status();
+        }
+    };
 }  // namespace concurrencpp
 
 #endif
\ No newline at end of file
@@ -26,6 +26,12 @@ namespace concurrencpp {
     template<class type>
     class resolve_awaitable;
 
+    template<class type>
+    class timeout_awaitable;
+
+    template<class type>
+    class wait_for_awaitable;
+
     struct executor_tag {};
 
     struct null_result {};
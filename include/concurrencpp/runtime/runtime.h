@@ -32,7 +32,12 @@ namespace concurrencpp {
         size_t max_background_threads;
         std::chrono::milliseconds max_background_executor_waiting_time;
 
+        size_t max_thread_executor_cached_threads;
+        std::chrono::milliseconds max_thread_executor_waiting_time;
+
         std::chrono::milliseconds max_timer_queue_waiting_time;
+        size_t timer_queue_shard_count;
+        timer_queue_backend timer_backend;
 
         std::function<void(std::string_view thread_name)> thread_started_callback;
         std::function<void(std::string_view thread_name)> thread_terminated_callback;
@@ -0,0 +1,73 @@
+#ifndef CONCURRENCPP_ASYNC_BARRIER_H
+#define CONCURRENCPP_ASYNC_BARRIER_H
+
+#include "concurrencpp/utils/slist.h"
+#include "concurrencpp/platform_defs.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/forward_declarations.h"
+#include "concurrencpp/threads/impl/async_waiter.h"
+
+#include <mutex>
+#include <memory>
+#include <functional>
+
+namespace concurrencpp::details {
+    class CRCPP_API async_barrier_awaitable {
+
+       private:
+        async_barrier& m_parent;
+        const std::shared_ptr<executor> m_resume_executor;
+        async_waiter m_waiter;
+
+       public:
+        async_barrier_awaitable(async_barrier& parent, std::shared_ptr<executor> resume_executor) noexcept;
+
+        async_barrier_awaitable(const async_barrier_awaitable&) = delete;
+        async_barrier_awaitable(async_barrier_awaitable&&) = delete;
+
+        constexpr bool await_ready() const noexcept {
+            return false;
+        }
+
+        bool await_suspend(coroutine_handle<void> caller_handle);
+        void await_resume() const;
+    };
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+        A reusable, phased barrier for coroutines.
+        Each phase completes when the expected number of participants have arrived. The last arriving coroutine
+        runs the completion callback (if any) and continues inline, all other participants of the phase are resumed
+        through their resume executors.
+    */
+    class CRCPP_API async_barrier {
+
+        friend class details::async_barrier_awaitable;
+
+       private:
+        mutable std::mutex m_lock;
+        details::slist<details::async_waiter> m_waiters;
+        size_t m_expected;
+        size_t m_arrived = 0;
+        size_t m_pending_drops = 0;
+        size_t m_phase = 0;
+        const std::function<void()> m_completion;
+
+        bool arrive(details::async_waiter* waiter, size_t drop_count);
+
+       public:
+        explicit async_barrier(size_t expected, std::function<void()> completion = {});
+        ~async_barrier() noexcept;
+
+        async_barrier(const async_barrier&) = delete;
+        async_barrier(async_barrier&&) = delete;
+
+        details::async_barrier_awaitable arrive_and_wait(std::shared_ptr<executor> resume_executor);
+        void arrive_and_drop();
+
+        size_t phase() const;
+    };
+}  // namespace concurrencpp
+
+#endif
@@ -3,29 +3,55 @@
 
 #include "concurrencpp/utils/slist.h"
 #include "concurrencpp/threads/async_lock.h"
+#include "concurrencpp/timers/timer.h"
 #include "concurrencpp/results/lazy_result.h"
 #include "concurrencpp/coroutines/coroutine.h"
 #include "concurrencpp/forward_declarations.h"
 
+#include <chrono>
+#include <algorithm>
+#include <condition_variable>
+
 namespace concurrencpp::details {
     class CRCPP_API cv_awaiter {
+
+        friend class concurrencpp::async_condition_variable;
+
        private:
         async_condition_variable& m_parent;
         scoped_async_lock& m_lock;
-        coroutine_handle<void> m_caller_handle;
+        async_lock_awaiter m_lock_awaiter;  // moved to the async_lock's awaiters when notified
+
+        // timed waits only
+        timer_queue* const m_timer_queue = nullptr;
+        const std::chrono::nanoseconds m_timeout {};
+        timer m_timer;
+        std::atomic_bool* m_timeout_claim = nullptr;  // lives inside the timer state, shared by the notifier and the timer
+        bool m_timed_out = false;
 
        public:
         cv_awaiter* next = nullptr;
 
+       public:
         cv_awaiter(async_condition_variable& parent, scoped_async_lock& lock) noexcept;
+        cv_awaiter(async_condition_variable& parent,
+                   scoped_async_lock& lock,
+                   timer_queue& timer_queue,
+                   std::chrono::nanoseconds timeout) noexcept;
 
         constexpr bool await_ready() const noexcept {
             return false;
         }
 
         void await_suspend(details::coroutine_handle<void> caller_handle);
-        void await_resume() const noexcept {}
-        void resume() noexcept;
+        bool await_resume() const noexcept {
+            return m_timed_out;
+        }
+
+        // called with the cv lock held. false if the timer of this awaiter has already claimed it.
+        bool try_claim() noexcept;
+
+        void on_timeout() noexcept;
     };
 }  // namespace concurrencpp::details
 
@@ -47,13 +73,51 @@ namespace concurrencpp {
             }
         }
 
+        template<class predicate_type>
+        lazy_result<bool> await_for_impl(std::shared_ptr<timer_queue> timer_queue,
+                                         std::shared_ptr<executor> resume_executor,
+                                         scoped_async_lock& lock,
+                                         std::chrono::nanoseconds timeout,
+                                         predicate_type pred) {
+            const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+            while (true) {
+                assert(lock.owns_lock());
+                if (pred()) {
+                    co_return true;
+                }
+
+                const auto time_left = std::chrono::ceil<std::chrono::nanoseconds>(deadline - std::chrono::steady_clock::now());
+                if (time_left <= std::chrono::nanoseconds(0)) {
+                    co_return false;
+                }
+
+                co_await await_for_impl(timer_queue, resume_executor, lock, time_left);
+            }
+        }
+
+        template<class clock_type, class duration_type>
+        static std::chrono::nanoseconds time_until(const std::chrono::time_point<clock_type, duration_type>& timeout_time) {
+            const auto time_left = std::chrono::ceil<std::chrono::nanoseconds>(timeout_time - clock_type::now());
+            return std::max(time_left, std::chrono::nanoseconds(0));
+        }
+
        private:
         std::mutex m_lock;
         details::slist<details::cv_awaiter> m_awaiters;
 
         static void verify_await_params(const std::shared_ptr<executor>& resume_executor, const scoped_async_lock& lock);
+        static void verify_await_for_params(const std::shared_ptr<timer_queue>& timer_queue,
+                                            const std::shared_ptr<executor>& resume_executor,
+                                            const scoped_async_lock& lock);
 
         lazy_result<void> await_impl(std::shared_ptr<executor> resume_executor, scoped_async_lock& lock);
+        lazy_result<std::cv_status> await_for_impl(std::shared_ptr<timer_queue> timer_queue,
+                                                   std::shared_ptr<executor> resume_executor,
+                                                   scoped_async_lock& lock,
+                                                   std::chrono::nanoseconds timeout);
+
+        static void move_to_lock_awaiters(details::slist<details::cv_awaiter>& awaiters);
 
        public:
         async_condition_variable() noexcept = default;
@@ -74,6 +138,47 @@ namespace concurrencpp {
             return await_impl(std::move(resume_executor), lock, pred);
         }
 
+        /*
+            Like await, but gives up once timeout has passed without a notification. The timeout is tracked by a one-shot
+            timer of timer_queue, which is cancelled by the notifier. Returns std::cv_status::timeout if the wait timed out.
+            Either way, the lock is re-acquired and the task is resumed inside resume_executor.
+        */
+        lazy_result<std::cv_status> await_for(std::shared_ptr<timer_queue> timer_queue,
+                                              std::shared_ptr<executor> resume_executor,
+                                              scoped_async_lock& lock,
+                                              std::chrono::nanoseconds timeout);
+
+        template<class predicate_type>
+        lazy_result<bool> await_for(std::shared_ptr<timer_queue> timer_queue,
+                                    std::shared_ptr<executor> resume_executor,
+                                    scoped_async_lock& lock,
+                                    std::chrono::nanoseconds timeout,
+                                    predicate_type pred) {
+            static_assert(
+                std::is_invocable_r_v<bool, predicate_type>,
+                "concurrencpp::async_condition_variable::await_for - given predicate isn't invocable with no arguments, or does not return a type which is or convertible to bool.");
+
+            verify_await_for_params(timer_queue, resume_executor, lock);
+            return await_for_impl(std::move(timer_queue), std::move(resume_executor), lock, timeout, pred);
+        }
+
+        template<class clock_type, class duration_type>
+        lazy_result<std::cv_status> await_until(std::shared_ptr<timer_queue> timer_queue,
+                                                std::shared_ptr<executor> resume_executor,
+                                                scoped_async_lock& lock,
+                                                const std::chrono::time_point<clock_type, duration_type>& timeout_time) {
+            return await_for(std::move(timer_queue), std::move(resume_executor), lock, time_until(timeout_time));
+        }
+
+        template<class clock_type, class duration_type, class predicate_type>
+        lazy_result<bool> await_until(std::shared_ptr<timer_queue> timer_queue,
+                                      std::shared_ptr<executor> resume_executor,
+                                      scoped_async_lock& lock,
+                                      const std::chrono::time_point<clock_type, duration_type>& timeout_time,
+                                      predicate_type pred) {
+            return await_for(std::move(timer_queue), std::move(resume_executor), lock, time_until(timeout_time), std::move(pred));
+        }
+
         void notify_one();
         void notify_all();
     };
@@ -0,0 +1,65 @@
+#ifndef CONCURRENCPP_ASYNC_LATCH_H
+#define CONCURRENCPP_ASYNC_LATCH_H
+
+#include "concurrencpp/utils/slist.h"
+#include "concurrencpp/platform_defs.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/forward_declarations.h"
+#include "concurrencpp/threads/impl/async_waiter.h"
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+
+namespace concurrencpp::details {
+    class CRCPP_API async_latch_awaitable {
+
+       private:
+        async_latch& m_parent;
+        const std::shared_ptr<executor> m_resume_executor;
+        async_waiter m_waiter;
+
+       public:
+        async_latch_awaitable(async_latch& parent, std::shared_ptr<executor> resume_executor) noexcept;
+
+        async_latch_awaitable(const async_latch_awaitable&) = delete;
+        async_latch_awaitable(async_latch_awaitable&&) = delete;
+
+        bool await_ready() const noexcept;
+        bool await_suspend(coroutine_handle<void> caller_handle);
+        void await_resume() const;
+    };
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+        A single-use downward counter for coroutines. Coroutines awaiting the latch are resumed once the counter reaches zero.
+        Counting down without reaching zero and waiting on a released latch are lock free.
+    */
+    class CRCPP_API async_latch {
+
+        friend class details::async_latch_awaitable;
+
+       private:
+        std::atomic_size_t m_counter;
+        std::mutex m_lock;
+        details::slist<details::async_waiter> m_waiters;
+
+        bool enqueue_waiter(details::async_waiter& waiter);
+
+       public:
+        explicit async_latch(size_t expected) noexcept;
+        ~async_latch() noexcept;
+
+        async_latch(const async_latch&) = delete;
+        async_latch(async_latch&&) = delete;
+
+        void count_down(size_t update = 1);
+        bool try_wait() const noexcept;
+
+        details::async_latch_awaitable wait(std::shared_ptr<executor> resume_executor);
+        details::async_latch_awaitable arrive_and_wait(std::shared_ptr<executor> resume_executor, size_t update = 1);
+    };
+}  // namespace concurrencpp
+
+#endif
@@ -8,9 +8,13 @@
 #include "concurrencpp/forward_declarations.h"
 
 namespace concurrencpp::details {
+    class cv_awaiter;
+
     class async_lock_awaiter {
 
         friend class concurrencpp::async_lock;
+        friend class concurrencpp::async_condition_variable;
+        friend class details::cv_awaiter;
 
        private:
         async_lock& m_parent;
@@ -22,6 +26,7 @@ namespace concurrencpp::details {
 
        public:
         async_lock_awaiter(async_lock& parent, std::unique_lock<std::mutex>& lock) noexcept;
+        async_lock_awaiter(async_lock& parent) noexcept;
 
         constexpr bool await_ready() const noexcept {
             return false;
@@ -31,6 +36,7 @@ namespace concurrencpp::details {
 
         constexpr void await_resume() const noexcept {}
 
+        void set_resume_handle(coroutine_handle<void> handle) noexcept;
         void retry() noexcept;
     };
 }  // namespace concurrencpp::details
@@ -41,7 +47,9 @@ namespace concurrencpp {
     class CRCPP_API async_lock {
 
         friend class scoped_async_lock;
+        friend class async_condition_variable;
         friend class details::async_lock_awaiter;
+        friend class details::cv_awaiter;
 
        private:
         std::mutex m_awaiter_lock;
@@ -52,7 +60,11 @@ namespace concurrencpp {
         std::atomic_intptr_t m_thread_count_in_critical_section {0};
 #endif
 
-        lazy_result<scoped_async_lock> lock_impl(std::shared_ptr<executor> resume_executor, bool with_raii_guard);
+        lazy_result<scoped_async_lock> lock_impl(std::shared_ptr<executor> resume_executor,
+                                                 bool with_raii_guard,
+                                                 bool resume_inline_if_free = true);
+
+        void enqueue_awaiters(details::slist<details::async_lock_awaiter>& awaiters);
 
        public:
         ~async_lock() noexcept;
@@ -0,0 +1,67 @@
+#ifndef CONCURRENCPP_ASYNC_SEMAPHORE_H
+#define CONCURRENCPP_ASYNC_SEMAPHORE_H
+
+#include "concurrencpp/utils/slist.h"
+#include "concurrencpp/platform_defs.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/forward_declarations.h"
+#include "concurrencpp/threads/impl/async_waiter.h"
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+
+namespace concurrencpp::details {
+    class CRCPP_API async_semaphore_awaitable {
+
+       private:
+        async_semaphore& m_parent;
+        const std::shared_ptr<executor> m_resume_executor;
+        async_waiter m_waiter;
+
+       public:
+        async_semaphore_awaitable(async_semaphore& parent, std::shared_ptr<executor> resume_executor) noexcept;
+
+        async_semaphore_awaitable(const async_semaphore_awaitable&) = delete;
+        async_semaphore_awaitable(async_semaphore_awaitable&&) = delete;
+
+        bool await_ready() noexcept;
+        bool await_suspend(coroutine_handle<void> caller_handle);
+        void await_resume();
+    };
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+        A counting semaphore for coroutines.
+        m_count holds the number of available permits, or minus the number of coroutines that are waiting for one.
+        Acquiring an available permit and releasing permits nobody waits for are lock free.
+    */
+    class CRCPP_API async_semaphore {
+
+        friend class details::async_semaphore_awaitable;
+
+       private:
+        std::atomic_intptr_t m_count;
+        std::mutex m_lock;
+        details::slist<details::async_waiter> m_waiters;
+        size_t m_pending_grants = 0;  // permits released to waiters which haven't enqueued themselves yet
+
+        bool enqueue_waiter(details::async_waiter& waiter);
+
+       public:
+        explicit async_semaphore(size_t initial_count);
+        ~async_semaphore() noexcept;
+
+        async_semaphore(const async_semaphore&) = delete;
+        async_semaphore(async_semaphore&&) = delete;
+
+        details::async_semaphore_awaitable acquire(std::shared_ptr<executor> resume_executor);
+        bool try_acquire() noexcept;
+        void release(size_t count = 1);
+
+        size_t approx_available() const noexcept;
+    };
+}  // namespace concurrencpp
+
+#endif
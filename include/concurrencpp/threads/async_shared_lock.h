@@ -0,0 +1,141 @@
+#ifndef CONCURRENCPP_ASYNC_SHARED_LOCK_H
+#define CONCURRENCPP_ASYNC_SHARED_LOCK_H
+
+#include "concurrencpp/utils/slist.h"
+#include "concurrencpp/platform_defs.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/results/lazy_result.h"
+#include "concurrencpp/forward_declarations.h"
+
+#include <mutex>
+
+namespace concurrencpp::details {
+    class async_shared_lock_awaiter {
+
+        friend class concurrencpp::async_shared_lock;
+
+       private:
+        async_shared_lock& m_parent;
+        std::unique_lock<std::mutex> m_lock;
+        executor& m_resume_executor;
+        coroutine_handle<void> m_resume_handle;
+        const bool m_shared;
+        bool m_interrupted = false;
+
+       public:
+        async_shared_lock_awaiter* next = nullptr;
+
+       public:
+        async_shared_lock_awaiter(async_shared_lock& parent,
+                                  std::unique_lock<std::mutex>& lock,
+                                  executor& resume_executor,
+                                  bool shared) noexcept;
+
+        constexpr bool await_ready() const noexcept {
+            return false;
+        }
+
+        void await_suspend(coroutine_handle<void> handle);
+        void await_resume();
+
+        void resume();
+        task make_resume_task() noexcept;
+    };
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    class scoped_async_shared_lock;
+    class scoped_async_exclusive_lock;
+
+    /*
+        A reader/writer lock for coroutines.
+        Ownership is handed directly to waiters on release: a waking writer owns the lock exclusively,
+        and all readers waiting at that moment are granted shared ownership together and resumed with a single
+        executor::enqueue(span) call per resume executor.
+        Fairness is writer-preferring - new readers queue up behind a writer that holds or waits for the lock.
+    */
+    class CRCPP_API async_shared_lock {
+
+        friend class details::async_shared_lock_awaiter;
+
+       private:
+        std::mutex m_awaiter_lock;
+        details::slist<details::async_shared_lock_awaiter> m_waiting_writers;
+        details::slist<details::async_shared_lock_awaiter> m_waiting_readers;
+        size_t m_waiting_reader_count = 0;
+        size_t m_reader_count = 0;
+        bool m_writer = false;
+
+        lazy_result<scoped_async_shared_lock> lock_shared_impl(std::shared_ptr<executor> resume_executor);
+        lazy_result<scoped_async_exclusive_lock> lock_impl(std::shared_ptr<executor> resume_executor);
+
+        static void resume_readers(details::slist<details::async_shared_lock_awaiter>& readers);
+
+       public:
+        async_shared_lock() noexcept = default;
+        ~async_shared_lock() noexcept;
+
+        async_shared_lock(const async_shared_lock&) = delete;
+        async_shared_lock(async_shared_lock&&) = delete;
+
+        lazy_result<scoped_async_shared_lock> lock_shared(std::shared_ptr<executor> resume_executor);
+        lazy_result<bool> try_lock_shared();
+        void unlock_shared();
+
+        lazy_result<scoped_async_exclusive_lock> lock(std::shared_ptr<executor> resume_executor);
+        lazy_result<bool> try_lock();
+        void unlock();
+    };
+
+    class CRCPP_API scoped_async_shared_lock {
+
+       private:
+        async_shared_lock* m_lock = nullptr;
+        bool m_owns = false;
+
+       public:
+        scoped_async_shared_lock() noexcept = default;
+        scoped_async_shared_lock(scoped_async_shared_lock&& rhs) noexcept;
+
+        scoped_async_shared_lock(async_shared_lock& lock, std::defer_lock_t) noexcept;
+        scoped_async_shared_lock(async_shared_lock& lock, std::adopt_lock_t) noexcept;
+
+        ~scoped_async_shared_lock() noexcept;
+
+        void unlock();
+
+        bool owns_lock() const noexcept;
+        explicit operator bool() const noexcept;
+
+        void swap(scoped_async_shared_lock& rhs) noexcept;
+        async_shared_lock* release() noexcept;
+        async_shared_lock* mutex() const noexcept;
+    };
+
+    class CRCPP_API scoped_async_exclusive_lock {
+
+       private:
+        async_shared_lock* m_lock = nullptr;
+        bool m_owns = false;
+
+       public:
+        scoped_async_exclusive_lock() noexcept = default;
+        scoped_async_exclusive_lock(scoped_async_exclusive_lock&& rhs) noexcept;
+
+        scoped_async_exclusive_lock(async_shared_lock& lock, std::defer_lock_t) noexcept;
+        scoped_async_exclusive_lock(async_shared_lock& lock, std::adopt_lock_t) noexcept;
+
+        ~scoped_async_exclusive_lock() noexcept;
+
+        void unlock();
+
+        bool owns_lock() const noexcept;
+        explicit operator bool() const noexcept;
+
+        void swap(scoped_async_exclusive_lock& rhs) noexcept;
+        async_shared_lock* release() noexcept;
+        async_shared_lock* mutex() const noexcept;
+    };
+}  // namespace concurrencpp
+
+#endif
@@ -20,12 +20,51 @@ namespace concurrencpp::details::consts {
     inline const char* k_scoped_async_lock_unlock_invalid_lock_err_msg =
         "concurrencpp::scoped_async_lock::unlock() - trying to unlock an unowned lock.";
 
+    inline const char* k_async_shared_lock_lock_null_resume_executor_err_msg =
+        "concurrencpp::async_shared_lock::lock() - given resume executor is null.";
+
+    inline const char* k_async_shared_lock_lock_shared_null_resume_executor_err_msg =
+        "concurrencpp::async_shared_lock::lock_shared() - given resume executor is null.";
+
+    inline const char* k_async_shared_lock_unlock_invalid_lock_err_msg =
+        "concurrencpp::async_shared_lock::unlock() - trying to unlock an unowned lock.";
+
+    inline const char* k_async_shared_lock_unlock_shared_invalid_lock_err_msg =
+        "concurrencpp::async_shared_lock::unlock_shared() - trying to unlock an unowned lock.";
+
+    inline const char* k_scoped_async_shared_lock_unlock_invalid_lock_err_msg =
+        "concurrencpp::scoped_async_shared_lock::unlock() - trying to unlock an unowned lock.";
+
+    inline const char* k_scoped_async_exclusive_lock_unlock_invalid_lock_err_msg =
+        "concurrencpp::scoped_async_exclusive_lock::unlock() - trying to unlock an unowned lock.";
+
+    inline const char* k_async_semaphore_acquire_null_resume_executor_err_msg =
+        "concurrencpp::async_semaphore::acquire() - given resume executor is null.";
+
+    inline const char* k_async_semaphore_invalid_count_err_msg = "concurrencpp::async_semaphore - count is too big.";
+
+    inline const char* k_async_latch_wait_null_resume_executor_err_msg = "concurrencpp::async_latch::wait() - given resume executor is null.";
+
+    inline const char* k_async_latch_count_down_invalid_update_err_msg =
+        "concurrencpp::async_latch::count_down() - update is bigger than the internal counter.";
+
+    inline const char* k_async_barrier_invalid_expected_err_msg = "concurrencpp::async_barrier - expected count is zero.";
+
+    inline const char* k_async_barrier_arrive_and_wait_null_resume_executor_err_msg =
+        "concurrencpp::async_barrier::arrive_and_wait() - given resume executor is null.";
+
+    inline const char* k_async_barrier_arrive_no_participants_err_msg =
+        "concurrencpp::async_barrier - all participants have dropped from the barrier.";
+
     inline const char* k_async_condition_variable_await_invalid_resume_executor_err_msg =
         "concurrencpp::async_condition_variable::await() - resume_executor is null.";
 
     inline const char* k_async_condition_variable_await_lock_unlocked_err_msg =
         "concurrencpp::async_condition_variable::await() - lock is unlocked.";
 
+    inline const char* k_async_condition_variable_await_for_null_timer_queue_err_msg =
+        "concurrencpp::async_condition_variable::await_for() - timer_queue is null.";
+
 }  // namespace concurrencpp::details::consts
 
 #endif
\ No newline at end of file
@@ -0,0 +1,40 @@
+#ifndef CONCURRENCPP_ASYNC_WAITER_H
+#define CONCURRENCPP_ASYNC_WAITER_H
+
+#include "concurrencpp/task.h"
+#include "concurrencpp/utils/slist.h"
+#include "concurrencpp/platform_defs.h"
+#include "concurrencpp/coroutines/coroutine.h"
+#include "concurrencpp/forward_declarations.h"
+
+namespace concurrencpp::details {
+    /*
+        An intrusive node for a coroutine suspended on an async synchronization primitive.
+        The coroutine is resumed by scheduling it on its resume executor. If the executor can't
+        schedule it, the coroutine is resumed inline and interrupted() returns true.
+    */
+    class CRCPP_API async_waiter {
+
+       private:
+        executor& m_resume_executor;
+        coroutine_handle<void> m_caller_handle;
+        bool m_interrupted = false;
+
+        task make_resume_task() noexcept;
+
+       public:
+        async_waiter* next = nullptr;
+
+        async_waiter(executor& resume_executor) noexcept;
+
+        void set_caller_handle(coroutine_handle<void> caller_handle) noexcept;
+        bool interrupted() const noexcept;
+
+        void resume() noexcept;
+
+        // resumes all waiters, with one executor::enqueue(span) call per run of waiters sharing a resume executor.
+        static void resume_all(slist<async_waiter>& waiters) noexcept;
+    };
+}  // namespace concurrencpp::details
+
+#endif
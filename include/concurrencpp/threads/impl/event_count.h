@@ -0,0 +1,49 @@
+#ifndef CONCURRENCPP_EVENT_COUNT_H
+#define CONCURRENCPP_EVENT_COUNT_H
+
+#include "concurrencpp/platform_defs.h"
+
+#include <atomic>
+
+#include <cstdint>
+
+namespace concurrencpp::details {
+    /*
+        A condition variable for lock-free data structures. A consumer that finds nothing to do calls prepare_wait,
+        checks its condition again and then either calls cancel_wait or wait. A producer makes the condition true and
+        then calls notify, which is a single load unless a consumer is actually waiting.
+        The waiter count and the notification epoch share one atomic word, so a notify that follows prepare_wait is
+        never lost.
+    */
+    class CRCPP_API event_count {
+
+       public:
+        using key_type = uint32_t;
+
+       private:
+        static constexpr uint64_t k_waiters_mask = 0xFFFFFFFF;
+        static constexpr uint64_t k_epoch_shift = 32;
+        static constexpr uint64_t k_epoch_increment = uint64_t(1) << k_epoch_shift;
+
+        std::atomic<uint64_t> m_state {0};
+
+        bool has_waiters() const noexcept;
+
+       public:
+        event_count() noexcept = default;
+
+        event_count(const event_count&) = delete;
+        event_count& operator=(const event_count&) = delete;
+
+        key_type prepare_wait() noexcept;
+        void cancel_wait() noexcept;
+
+        // blocks until notify is called after the prepare_wait call that returned key.
+        void wait(key_type key) noexcept;
+
+        void notify_one() noexcept;
+        void notify_all() noexcept;
+    };
+}  // namespace concurrencpp::details
+
+#endif
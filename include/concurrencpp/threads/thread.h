@@ -52,6 +52,12 @@ namespace concurrencpp::details {
         void join();
 
         static size_t hardware_concurrency() noexcept;
+
+        // binds the calling thread to a single logical core, returns false if the platform doesn't support it or refused.
+        static bool pin_current_to_core(size_t core) noexcept;
+
+        // a spin-wait hint (pause on x86, yield on arm) that saves power and frees the pipeline for the sibling hyperthread.
+        static void cpu_relax() noexcept;
     };
 }  // namespace concurrencpp::details
 
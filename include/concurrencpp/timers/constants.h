@@ -1,8 +1,13 @@
 #ifndef CONCURRENCPP_TIMER_CONSTS_H
 #define CONCURRENCPP_TIMER_CONSTS_H
 
+#include <cstddef>
+
 namespace concurrencpp::details::consts {
+    constexpr static size_t k_timer_queue_spin_window_us = 50;
+
     inline const char* k_timer_empty_get_due_time_err_msg = "concurrencpp::timer::get_due_time() - timer is empty.";
+    inline const char* k_timer_empty_get_slack_err_msg = "concurrencpp::timer::get_slack() - timer is empty.";
     inline const char* k_timer_empty_get_frequency_err_msg = "concurrencpp::timer::get_frequency() - timer is empty.";
     inline const char* k_timer_empty_get_executor_err_msg = "concurrencpp::timer::get_executor() - timer is empty.";
     inline const char* k_timer_empty_get_timer_queue_err_msg = "concurrencpp::timer::get_timer_queue() - timer is empty.";
@@ -11,8 +16,23 @@ namespace concurrencpp::details::consts {
     inline const char* k_timer_queue_make_timer_executor_null_err_msg = "concurrencpp::timer_queue::make_timer() - executor is null.";
     inline const char* k_timer_queue_make_oneshot_timer_executor_null_err_msg =
         "concurrencpp::timer_queue::make_one_shot_timer() - executor is null.";
+    inline const char* k_timer_queue_make_timer_negative_slack_err_msg = "concurrencpp::timer_queue::make_timer() - slack is negative.";
+    inline const char* k_timer_queue_make_oneshot_timer_negative_slack_err_msg =
+        "concurrencpp::timer_queue::make_one_shot_timer() - slack is negative.";
+    inline const char* k_timer_queue_make_inline_timer_negative_budget_err_msg =
+        "concurrencpp::timer_queue::make_inline_timer() - budget is negative.";
     inline const char* k_timer_queue_make_delay_object_executor_null_err_msg = "concurrencpp::timer_queue::make_delay_object() - executor is null.";
+    inline const char* k_timer_queue_zero_shard_count_err_msg = "concurrencpp::timer_queue::timer_queue() - shard count is zero.";
+    inline const char* k_timeout_token_arm_negative_slack_err_msg = "concurrencpp::timeout_token::arm() - slack is negative.";
     inline const char* k_timer_queue_shutdown_err_msg = "concurrencpp::timer_queue has been shut down.";
+
+    inline const char* k_timerfd_poller_unsupported_err_msg = "concurrencpp::timer_queue - the timerfd backend is only available on Linux.";
+    inline const char* k_timerfd_poller_epoll_create_err_msg = "concurrencpp::timer_queue - epoll_create1 failed.";
+    inline const char* k_timerfd_poller_timerfd_create_err_msg = "concurrencpp::timer_queue - timerfd_create failed.";
+    inline const char* k_timerfd_poller_eventfd_create_err_msg = "concurrencpp::timer_queue - eventfd failed.";
+    inline const char* k_timerfd_poller_epoll_ctl_err_msg = "concurrencpp::timer_queue - epoll_ctl failed.";
+    inline const char* k_timerfd_poller_timerfd_settime_err_msg = "concurrencpp::timer_queue - timerfd_settime failed.";
+    inline const char* k_timerfd_poller_epoll_wait_err_msg = "concurrencpp::timer_queue - epoll_wait failed.";
 }  // namespace concurrencpp::details::consts
 
 #endif
@@ -0,0 +1,158 @@
+#ifndef CONCURRENCPP_TIMER_WHEEL_H
+#define CONCURRENCPP_TIMER_WHEEL_H
+
+#include "concurrencpp/task.h"
+#include "concurrencpp/timers/timer.h"
+#include "concurrencpp/platform_defs.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <cstdint>
+
+namespace concurrencpp::details {
+    /*
+        A hierarchical hashed timing wheel of intrusive timer_wheel_nodes. It doesn't own its nodes and isn't thread safe.
+        Level L has k_slots slots, each one covering k_slots^L ticks. A node is linked into the lowest level whose current
+        slot range contains its deadline. When the wheel enters a slot of a higher level, the nodes of that slot are
+        cascaded into the lower levels. Nodes which are further away than the top level covers wait in an overflow slot.
+        Linking and unlinking a node are O(1) and allocation free.
+        A node with slack is placed on the most rounded tick inside [deadline, deadline + slack], so nodes with close
+        deadlines share a slot and a wake-up.
+    */
+    class CRCPP_API timer_wheel_base {
+
+       public:
+        using clock_type = timer_wheel_node::clock_type;
+        using time_point = timer_wheel_node::time_point;
+
+        // the head of an intrusive list of nodes outside of the wheel, like the expired nodes.
+        using node_list = timer_wheel_node*;
+
+        static constexpr size_t k_slot_bits = 8;
+        static constexpr size_t k_slots = size_t(1) << k_slot_bits;
+        static constexpr size_t k_levels = 4;
+        static constexpr clock_type::duration k_tick = std::chrono::microseconds(1);
+
+       private:
+        const time_point m_origin;
+        uint64_t m_current_tick = 0;
+        size_t m_size = 0;
+        std::array<timer_wheel_node*, k_slots * k_levels> m_slots {};
+        std::array<uint64_t, k_slots * k_levels / 64> m_occupied {};  // a bit per non-empty slot
+        timer_wheel_node* m_overflow = nullptr;
+
+        uint64_t deadline_tick(time_point deadline) const noexcept;
+        uint64_t elapsed_ticks(time_point now) const noexcept;
+        uint64_t fire_tick(const timer_wheel_node& node, uint64_t min_tick) const noexcept;
+
+        bool owns_slot(const timer_wheel_node* const* slot) const noexcept;
+        void set_occupied(const timer_wheel_node* const* slot, bool occupied) noexcept;
+
+        void link(timer_wheel_node& node, timer_wheel_node*& slot) noexcept;
+        void unlink(timer_wheel_node& node) noexcept;
+
+        void place(timer_wheel_node& node, uint64_t min_tick) noexcept;
+        timer_wheel_node* detach(timer_wheel_node*& slot) noexcept;
+        void splice(timer_wheel_node*& slot, node_list& list, timer_wheel_node*& tail) noexcept;
+
+        void cascade(timer_wheel_node*& slot) noexcept;
+        void advance_to(uint64_t tick) noexcept;
+
+        size_t next_occupied_slot(size_t level, size_t from) const noexcept;
+        uint64_t next_event_tick() const noexcept;
+
+       public:
+        explicit timer_wheel_base(time_point origin = clock_type::now()) noexcept;
+        ~timer_wheel_base() noexcept;
+
+        timer_wheel_base(const timer_wheel_base&) = delete;
+        timer_wheel_base& operator=(const timer_wheel_base&) = delete;
+
+        // links an unlinked node by its deadline and slack.
+        void insert(timer_wheel_node& node) noexcept;
+
+        // like insert, but never on the current tick. for nodes that have just expired on it.
+        void reinsert(timer_wheel_node& node) noexcept;
+
+        // unlinks a node from the wheel or from the node_list it was moved to. no-op if the node isn't linked.
+        void erase(timer_wheel_node& node) noexcept;
+
+        // moves the nodes whose deadline has passed by now to the back of expired, in deadline order.
+        void expire(time_point now, node_list& expired) noexcept;
+
+        // moves all the nodes to the back of list.
+        void expire_all(node_list& list) noexcept;
+
+        static timer_wheel_node* pop_front(node_list& list) noexcept;
+
+        // returns the time the wheel should be expired again, now + 24h if it's empty.
+        time_point next_deadline(time_point now) const noexcept;
+
+        bool empty() const noexcept {
+            return m_size == 0;
+        }
+
+        size_t size() const noexcept {
+            return m_size;
+        }
+    };
+
+    /*
+        The timers of a timer_queue shard, owned by its thread. The wheel keeps its timers alive while they're scheduled,
+        fires them and re-schedules the periodic ones. The tasks of fired timers are enqueued in one batch per executor,
+        inline timers are run right away and counted in inline_overruns when they exceed their budget.
+    */
+    class CRCPP_API timer_wheel {
+
+       public:
+        using clock_type = timer_wheel_base::clock_type;
+        using time_point = timer_wheel_base::time_point;
+        using timer_ptr = std::shared_ptr<timer_state_base>;
+
+        static constexpr clock_type::duration k_tick = timer_wheel_base::k_tick;
+
+       private:
+        struct fire_batch {
+            executor* target = nullptr;
+            std::vector<concurrencpp::task> tasks;
+        };
+
+        timer_wheel_base m_wheel;
+        std::atomic_size_t* const m_inline_overruns;
+        std::vector<fire_batch> m_batches;  // reused between calls to process_timers, only the first m_batch_count are used
+        size_t m_batch_count = 0;
+
+        static void release(timer_state_base& timer) noexcept;
+        static timer_state_base& to_timer(timer_wheel_node& node) noexcept;
+
+        fire_batch& batch_of(executor& target);
+        void dispatch_batches();
+
+       public:
+        explicit timer_wheel(time_point origin = clock_type::now(), std::atomic_size_t* inline_overruns = nullptr) noexcept;
+        ~timer_wheel() noexcept;
+
+        timer_wheel(const timer_wheel&) = delete;
+        timer_wheel& operator=(const timer_wheel&) = delete;
+
+        void add(timer_ptr timer);
+        void remove(const timer_ptr& timer) noexcept;
+
+        // fires the timers that are due by now, returns the time the wheel should be processed again.
+        time_point process_timers(time_point now);
+
+        bool empty() const noexcept {
+            return m_wheel.empty();
+        }
+
+        size_t size() const noexcept {
+            return m_wheel.size();
+        }
+    };
+}  // namespace concurrencpp::details
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef CONCURRENCPP_TIMERFD_POLLER_H
+#define CONCURRENCPP_TIMERFD_POLLER_H
+
+#include "concurrencpp/platform_defs.h"
+
+#include <chrono>
+
+namespace concurrencpp::details {
+    /*
+        The wait primitive of the timerfd timer_queue backend (Linux only): a timerfd armed with the next deadline and an
+        eventfd signalled by request producers, both waited on by a single epoll instance. Unlike a condition variable,
+        producers signal the timer thread without touching its mutex and the deadline is tracked by a high resolution
+        kernel timer. The epoll descriptor can also be used to wait on other file descriptors next to the timers.
+    */
+    class CRCPP_API timerfd_poller {
+
+       public:
+        using clock_type = std::chrono::high_resolution_clock;
+        using time_point = std::chrono::time_point<clock_type>;
+
+       private:
+        int m_epoll_fd = -1;
+        int m_timer_fd = -1;
+        int m_event_fd = -1;
+
+        bool wait_impl(int timeout_ms);
+        void arm(std::chrono::nanoseconds relative_deadline);
+
+       public:
+        // throws std::system_error if one of the descriptors can't be created, std::invalid_argument if unsupported.
+        timerfd_poller();
+        ~timerfd_poller() noexcept;
+
+        timerfd_poller(const timerfd_poller&) = delete;
+        timerfd_poller& operator=(const timerfd_poller&) = delete;
+
+        static bool supported() noexcept;
+
+        // wakes up a thread waiting in wait_until/wait_for, or the next one if none is waiting.
+        void notify() noexcept;
+
+        // returns true if notified, false if the deadline has passed.
+        bool wait_until(time_point deadline);
+
+        // returns true if notified, false if the timeout has elapsed.
+        bool wait_for(std::chrono::milliseconds timeout);
+
+        int native_handle() const noexcept {
+            return m_epoll_fd;
+        }
+    };
+}  // namespace concurrencpp::details
+
+#endif
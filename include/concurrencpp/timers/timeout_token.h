@@ -0,0 +1,84 @@
+#ifndef CONCURRENCPP_TIMEOUT_TOKEN_H
+#define CONCURRENCPP_TIMEOUT_TOKEN_H
+
+#include "concurrencpp/timers/timer.h"
+#include "concurrencpp/forward_declarations.h"
+#include "concurrencpp/platform_defs.h"
+
+#include <chrono>
+#include <utility>
+#include <type_traits>
+
+namespace concurrencpp::details {
+    class timer_queue_shard;
+
+    class CRCPP_API timeout_token_base : public timer_wheel_node {
+
+        friend class concurrencpp::details::timer_queue_shard;
+
+       private:
+        timer_queue_shard* m_shard = nullptr;  // the shard the token was last armed on, written only by the owner.
+
+       protected:
+        virtual void on_timeout() noexcept = 0;
+
+       public:
+        timeout_token_base() noexcept;
+        ~timeout_token_base() noexcept;
+
+        // (re)arms the token to expire after timeout, up to slack later. throws std::invalid_argument if slack is negative,
+        // errors::runtime_shutdown if timer_queue has been shut down.
+        void arm(timer_queue& timer_queue, duration timeout, duration slack = duration::zero());
+
+        // returns true if the token was armed and won't expire. if the token is expiring on another thread,
+        // waits for the callable to return.
+        bool disarm() noexcept;
+
+        bool armed() const noexcept;
+    };
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+        An intrusive, allocation-free alternative to a one-shot timer, meant for per-request deadlines that are almost
+        always cancelled before they expire. The token lives in the caller's storage (a coroutine frame, a request object)
+        and is linked into the timing wheel of a timer_queue shard directly: arming and disarming are O(1), allocate
+        nothing and touch no reference counts.
+        The callable is invoked inline on the timer_queue thread when the token expires, so it must be short and must not
+        throw - typically it flags the request as timed out or forwards the work to an executor.
+        A token is not thread safe: arm, disarm and the destructor are called by its owner. The timer_queue must outlive
+        the token. Tokens that are armed when the timer_queue is shut down are disarmed without being invoked.
+    */
+    template<class callable_type>
+    class timeout_token final : public details::timeout_token_base {
+
+        static_assert(std::is_nothrow_invocable_v<callable_type&>,
+                      "concurrencpp::timeout_token<callable_type> - callable_type must be invocable with no arguments and noexcept.");
+
+       private:
+        callable_type m_callable;
+
+        void on_timeout() noexcept override {
+            m_callable();
+        }
+
+       public:
+        template<class given_callable_type>
+        explicit timeout_token(given_callable_type&& callable) noexcept(
+            std::is_nothrow_constructible_v<callable_type, given_callable_type&&>) :
+            m_callable(std::forward<given_callable_type>(callable)) {}
+
+        // waits for the callable to return if it's being invoked on another thread.
+        ~timeout_token() noexcept {
+            disarm();
+        }
+
+        timeout_token(timeout_token&&) = delete;
+        timeout_token& operator=(timeout_token&&) = delete;
+    };
+
+    template<class callable_type>
+    timeout_token(callable_type&&) -> timeout_token<std::decay_t<callable_type>>;
+}  // namespace concurrencpp
+
+#endif
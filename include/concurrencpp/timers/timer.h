@@ -1,6 +1,7 @@
 #ifndef CONCURRENCPP_TIMER_H
 #define CONCURRENCPP_TIMER_H
 
+#include "concurrencpp/task.h"
 #include "concurrencpp/forward_declarations.h"
 #include "concurrencpp/platform_defs.h"
 
@@ -9,52 +10,106 @@
 #include <chrono>
 
 namespace concurrencpp::details {
-    class CRCPP_API timer_state_base : public std::enable_shared_from_this<timer_state_base> {
+    class timer_wheel;
+    class timer_wheel_base;
+    class timer_queue_shard;
+
+    // the intrusive hook of everything a timer_wheel schedules: timers and timeout tokens.
+    class CRCPP_API timer_wheel_node {
+
+        friend class timer_wheel_base;
 
        public:
         using clock_type = std::chrono::high_resolution_clock;
         using time_point = std::chrono::time_point<clock_type>;
-        using milliseconds = std::chrono::milliseconds;
+        using duration = std::chrono::nanoseconds;
+
+       protected:
+        time_point m_deadline;
+        duration m_slack;  // how late the node may expire, so it can share a wake-up with other nodes.
+
+       private:
+        timer_wheel_node* m_wheel_prev = nullptr;
+        timer_wheel_node* m_wheel_next = nullptr;
+        timer_wheel_node** m_wheel_slot = nullptr;
+
+       public:
+        timer_wheel_node(time_point deadline, duration slack) noexcept : m_deadline(deadline), m_slack(slack) {}
+
+        timer_wheel_node(const timer_wheel_node&) = delete;
+        timer_wheel_node& operator=(const timer_wheel_node&) = delete;
+
+        time_point get_deadline() const noexcept {
+            return m_deadline;
+        }
+
+        duration get_slack() const noexcept {
+            return m_slack;
+        }
+
+        bool linked() const noexcept {
+            return m_wheel_slot != nullptr;
+        }
+    };
+
+    class CRCPP_API timer_state_base : public std::enable_shared_from_this<timer_state_base>, public timer_wheel_node {
+
+        friend class timer_wheel;
+        friend class timer_queue_shard;
+        friend class concurrencpp::timer_queue;
 
        private:
         const std::weak_ptr<timer_queue> m_timer_queue;
-        const std::shared_ptr<executor> m_executor;
-        const size_t m_due_time;
-        std::atomic_size_t m_frequency;
-        time_point m_deadline;  // set by the c.tor, changed only by the timer_queue thread.
+        const std::shared_ptr<executor> m_executor;  // null for inline timers, which run on the timer_queue thread
+        const duration m_due_time;
+        const duration m_inline_budget;  // how long the callable of an inline timer may run before it counts as an overrun
+        std::atomic<duration> m_frequency;
         std::atomic_bool m_cancelled;
         const bool m_is_oneshot;
+        size_t m_shard_index = 0;  // the timer_queue shard the timer was added to, set before the timer is published.
+        std::shared_ptr<timer_state_base> m_wheel_ref;  // keeps the timer alive while it's linked or waiting to be added.
 
-        static time_point make_deadline(milliseconds diff) noexcept {
+        // the hooks of the lock-free add and remove request lists of the timer_queue shard.
+        timer_state_base* m_next_added = nullptr;
+        timer_state_base* m_next_removed = nullptr;
+        std::shared_ptr<timer_state_base> m_removed_ref;  // keeps the timer alive while its removal is pending.
+
+        static time_point make_deadline(duration diff) noexcept {
             return clock_type::now() + diff;
         }
 
        public:
-        timer_state_base(size_t due_time,
-                         size_t frequency,
+        timer_state_base(duration due_time,
+                         duration frequency,
                          std::shared_ptr<concurrencpp::executor> executor,
                          std::weak_ptr<concurrencpp::timer_queue> timer_queue,
-                         bool is_oneshot) noexcept;
+                         bool is_oneshot,
+                         duration slack = duration::zero(),
+                         duration inline_budget = duration::zero()) noexcept;
 
         virtual ~timer_state_base() noexcept = default;
 
         virtual void execute() = 0;
 
-        void fire();
+        // schedules the next deadline and returns the task that runs the callable. the caller enqueues it on the executor.
+        concurrencpp::task fire();
 
-        bool expired(const time_point now) const noexcept {
-            return m_deadline <= now;
+        // schedules the next deadline and runs the callable of an inline timer, returns false if it exceeded its budget.
+        bool fire_inline() noexcept;
+
+        bool is_inline() const noexcept {
+            return !static_cast<bool>(m_executor);
         }
 
-        time_point get_deadline() const noexcept {
-            return m_deadline;
+        bool expired(const time_point now) const noexcept {
+            return m_deadline <= now;
         }
 
-        size_t get_frequency() const noexcept {
+        duration get_frequency() const noexcept {
             return m_frequency.load(std::memory_order_relaxed);
         }
 
-        size_t get_due_time() const noexcept {
+        duration get_due_time() const noexcept {
             return m_due_time;  // no need to synchronize, const anyway.
         }
 
@@ -70,7 +125,7 @@ namespace concurrencpp::details {
             return m_timer_queue;
         }
 
-        void set_new_frequency(size_t new_frequency) noexcept {
+        void set_new_frequency(duration new_frequency) noexcept {
             m_frequency.store(new_frequency, std::memory_order_relaxed);
         }
 
@@ -91,13 +146,15 @@ namespace concurrencpp::details {
 
        public:
         template<class given_callable_type>
-        timer_state(size_t due_time,
-                    size_t frequency,
+        timer_state(duration due_time,
+                    duration frequency,
                     std::shared_ptr<concurrencpp::executor> executor,
                     std::weak_ptr<concurrencpp::timer_queue> timer_queue,
                     bool is_oneshot,
-                    given_callable_type&& callable) :
-            timer_state_base(due_time, frequency, std::move(executor), std::move(timer_queue), is_oneshot),
+                    given_callable_type&& callable,
+                    duration slack = duration::zero(),
+                    duration inline_budget = duration::zero()) :
+            timer_state_base(due_time, frequency, std::move(executor), std::move(timer_queue), is_oneshot, slack, inline_budget),
             m_callable(std::forward<given_callable_type>(callable)) {}
 
         void execute() override {
@@ -107,6 +164,10 @@ namespace concurrencpp::details {
 
             m_callable();
         }
+
+        callable_type& get_callable() noexcept {
+            return m_callable;
+        }
     };
 }  // namespace concurrencpp::details
 
@@ -132,12 +193,13 @@ namespace concurrencpp {
 
         void cancel();
 
-        std::chrono::milliseconds get_due_time() const;
+        std::chrono::nanoseconds get_due_time() const;
+        std::chrono::nanoseconds get_slack() const;
         std::shared_ptr<executor> get_executor() const;
         std::weak_ptr<timer_queue> get_timer_queue() const;
 
-        std::chrono::milliseconds get_frequency() const;
-        void set_frequency(std::chrono::milliseconds new_frequency);
+        std::chrono::nanoseconds get_frequency() const;
+        void set_frequency(std::chrono::nanoseconds new_frequency);
 
         explicit operator bool() const noexcept {
             return static_cast<bool>(m_state);
@@ -5,62 +5,77 @@
 #include "constants.h"
 #include "concurrencpp/errors.h"
 #include "concurrencpp/utils/bind.h"
-#include "concurrencpp/threads/thread.h"
 #include "concurrencpp/results/lazy_result.h"
 
-#include <mutex>
 #include <memory>
 #include <chrono>
 #include <vector>
-#include <condition_variable>
+#include <functional>
+#include <string_view>
 
 #include <cassert>
 
 namespace concurrencpp::details {
-    enum class timer_request { add, remove };
-}
+    class cv_awaiter;
+    class timer_queue_shard;
+    class timeout_token_base;
+}  // namespace concurrencpp::details
 
 namespace concurrencpp {
+    enum class timer_queue_backend {
+        condition_variable,  // portable, waits on a std::condition_variable and spins out the last microseconds
+        timerfd              // linux only, waits on a timerfd and an eventfd multiplexed by epoll
+    };
+
+    /*
+        The timers of a timer_queue are spread over one or more shards. Each shard has its own thread, timing wheel and
+        lock-free request lists, so threads that create and cancel timers on different shards don't contend with each other.
+        A timer is added to the shard selected by the calling thread and is cancelled through the same shard.
+    */
     class CRCPP_API timer_queue : public std::enable_shared_from_this<timer_queue> {
 
        public:
         using timer_ptr = std::shared_ptr<details::timer_state_base>;
         using clock_type = std::chrono::high_resolution_clock;
         using time_point = std::chrono::time_point<std::chrono::high_resolution_clock>;
-        using request_queue = std::vector<std::pair<timer_ptr, details::timer_request>>;
+        using duration = std::chrono::nanoseconds;
 
         friend class concurrencpp::timer;
+        friend class concurrencpp::details::cv_awaiter;
+        friend class concurrencpp::details::timer_queue_shard;
+        friend class concurrencpp::details::timeout_token_base;
 
        private:
         std::atomic_bool m_atomic_abort;
-        std::mutex m_lock;
-        request_queue m_request_queue;
-        details::thread m_worker;
-        std::condition_variable m_condition;
-        bool m_abort;
-        bool m_idle;
+        std::atomic_size_t m_inline_timer_overruns;
         const std::chrono::milliseconds m_max_waiting_time;
         const std::function<void(std::string_view thread_name)> m_thread_started_callback;
         const std::function<void(std::string_view thread_name)> m_thread_terminated_callback;
+        const timer_queue_backend m_backend;
+        std::vector<std::unique_ptr<details::timer_queue_shard>> m_shards;
 
-        details::thread ensure_worker_thread(std::unique_lock<std::mutex>& lock);
-
-        void add_internal_timer(std::unique_lock<std::mutex>& lock, timer_ptr new_timer);
+        void add_timer(timer_ptr new_timer);
         void remove_internal_timer(timer_ptr existing_timer);
 
-        void add_timer(std::unique_lock<std::mutex>& lock, timer_ptr new_timer);
+        // timeout tokens are linked into the token wheel of the calling thread's shard, returns that shard.
+        details::timer_queue_shard& arm_token(details::timeout_token_base& token);
+        static bool disarm_token(details::timer_queue_shard& shard, details::timeout_token_base& token) noexcept;
+        static bool token_armed(details::timer_queue_shard& shard, const details::timeout_token_base& token) noexcept;
 
-        lazy_result<void> make_delay_object_impl(std::chrono::milliseconds due_time,
+        lazy_result<void> make_delay_object_impl(duration due_time,
                                                  std::shared_ptr<concurrencpp::timer_queue> self,
                                                  std::shared_ptr<concurrencpp::executor> executor);
 
         template<class callable_type>
-        timer_ptr make_timer_impl(size_t due_time,
-                                  size_t frequency,
+        timer_ptr make_timer_impl(duration due_time,
+                                  duration frequency,
                                   std::shared_ptr<concurrencpp::executor> executor,
                                   bool is_oneshot,
-                                  callable_type&& callable) {
-            assert(static_cast<bool>(executor));
+                                  callable_type&& callable,
+                                  duration slack = duration::zero(),
+                                  duration inline_budget = duration::zero()) {
+            assert(slack >= duration::zero());
+            assert(inline_budget >= duration::zero());
 
             using decayed_type = typename std::decay_t<callable_type>;
 
@@ -69,29 +84,28 @@ namespace concurrencpp {
                                                                                     std::move(executor),
                                                                                     weak_from_this(),
                                                                                     is_oneshot,
-                                                                                    std::forward<callable_type>(callable));
-            {
-                std::unique_lock<std::mutex> lock(m_lock);
-                add_timer(lock, timer_state);
-            }
+                                                                                    std::forward<callable_type>(callable),
+                                                                                    slack,
+                                                                                    inline_budget);
 
+            add_timer(timer_state);
             return timer_state;
         }
 
-        void work_loop();
-
        public:
         timer_queue(std::chrono::milliseconds max_waiting_time,
                     const std::function<void(std::string_view thread_name)>& thread_started_callback = {},
-                    const std::function<void(std::string_view thread_name)>& thread_terminated_callback = {});
+                    const std::function<void(std::string_view thread_name)>& thread_terminated_callback = {},
+                    size_t shard_count = 1,
+                    timer_queue_backend backend = timer_queue_backend::condition_variable);
         ~timer_queue() noexcept;
 
         void shutdown();
         bool shutdown_requested() const noexcept;
 
         template<class callable_type, class... argumet_types>
-        timer make_timer(std::chrono::milliseconds due_time,
-                         std::chrono::milliseconds frequency,
+        timer make_timer(duration due_time,
+                         duration frequency,
                          std::shared_ptr<concurrencpp::executor> executor,
                          callable_type&& callable,
                          argumet_types&&... arguments) {
@@ -99,15 +113,15 @@ namespace concurrencpp {
                 throw std::invalid_argument(details::consts::k_timer_queue_make_timer_executor_null_err_msg);
             }
 
-            return make_timer_impl(due_time.count(),
-                                   frequency.count(),
+            return make_timer_impl(due_time,
+                                   frequency,
                                    std::move(executor),
                                    false,
                                    details::bind(std::forward<callable_type>(callable), std::forward<argumet_types>(arguments)...));
         }
 
         template<class callable_type, class... argumet_types>
-        timer make_one_shot_timer(std::chrono::milliseconds due_time,
+        timer make_one_shot_timer(duration due_time,
                                   std::shared_ptr<concurrencpp::executor> executor,
                                   callable_type&& callable,
                                   argumet_types&&... arguments) {
@@ -115,16 +129,91 @@ namespace concurrencpp {
                 throw std::invalid_argument(details::consts::k_timer_queue_make_oneshot_timer_executor_null_err_msg);
             }
 
-            return make_timer_impl(due_time.count(),
-                                   0,
+            return make_timer_impl(due_time,
+                                   duration::zero(),
                                    std::move(executor),
                                    true,
                                    details::bind(std::forward<callable_type>(callable), std::forward<argumet_types>(arguments)...));
         }
 
-        lazy_result<void> make_delay_object(std::chrono::milliseconds due_time, std::shared_ptr<concurrencpp::executor> executor);
+        /*
+            The slack overloads allow a timer to be fired up to slack after its deadline. Timers whose deadlines fall into
+            each other's slack are fired in a single wake-up of the timer queue.
+        */
+        template<class callable_type, class... argumet_types>
+        timer make_timer(duration due_time,
+                         duration frequency,
+                         duration slack,
+                         std::shared_ptr<concurrencpp::executor> executor,
+                         callable_type&& callable,
+                         argumet_types&&... arguments) {
+            if (!static_cast<bool>(executor)) {
+                throw std::invalid_argument(details::consts::k_timer_queue_make_timer_executor_null_err_msg);
+            }
+
+            if (slack < duration::zero()) {
+                throw std::invalid_argument(details::consts::k_timer_queue_make_timer_negative_slack_err_msg);
+            }
+
+            return make_timer_impl(due_time,
+                                   frequency,
+                                   std::move(executor),
+                                   false,
+                                   details::bind(std::forward<callable_type>(callable), std::forward<argumet_types>(arguments)...),
+                                   slack);
+        }
+
+        template<class callable_type, class... argumet_types>
+        timer make_one_shot_timer(duration due_time,
+                                  duration slack,
+                                  std::shared_ptr<concurrencpp::executor> executor,
+                                  callable_type&& callable,
+                                  argumet_types&&... arguments) {
+            if (!static_cast<bool>(executor)) {
+                throw std::invalid_argument(details::consts::k_timer_queue_make_oneshot_timer_executor_null_err_msg);
+            }
+
+            if (slack < duration::zero()) {
+                throw std::invalid_argument(details::consts::k_timer_queue_make_oneshot_timer_negative_slack_err_msg);
+            }
+
+            return make_timer_impl(due_time,
+                                   duration::zero(),
+                                   std::move(executor),
+                                   true,
+                                   details::bind(std::forward<callable_type>(callable), std::forward<argumet_types>(arguments)...),
+                                   slack);
+        }
+
+        /*
+            An inline timer runs its callable on the timer_queue thread instead of posting it to an executor, which saves
+            the enqueue and the thread hop of cheap callbacks like setting a flag. The callable delays every other timer of
+            its shard while it runs, so it must not block. A call that takes longer than budget is counted by
+            inline_timer_overruns. Exceptions thrown by the callable are ignored.
+        */
+        template<class callable_type, class... argumet_types>
+        timer make_inline_timer(duration due_time, duration frequency, duration budget, callable_type&& callable, argumet_types&&... arguments) {
+            if (budget < duration::zero()) {
+                throw std::invalid_argument(details::consts::k_timer_queue_make_inline_timer_negative_budget_err_msg);
+            }
+
+            return make_timer_impl(due_time,
+                                   frequency,
+                                   nullptr,
+                                   false,
+                                   details::bind(std::forward<callable_type>(callable), std::forward<argumet_types>(arguments)...),
+                                   duration::zero(),
+                                   budget);
+        }
+
+        lazy_result<void> make_delay_object(duration due_time, std::shared_ptr<concurrencpp::executor> executor);
+
+        // the number of inline timer calls that took longer than their budget.
+        size_t inline_timer_overruns() const noexcept;
 
         std::chrono::milliseconds max_worker_idle_time() const noexcept;
+        size_t shard_count() const noexcept;
+        timer_queue_backend backend() const noexcept;
     };
 }  // namespace concurrencpp
 
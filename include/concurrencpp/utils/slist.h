@@ -57,8 +57,54 @@ namespace concurrencpp::details {
                 m_tail = nullptr;
             }
 
+            node->next = nullptr;
             return node;
         }
+
+        bool remove(node_type& node) noexcept {
+            assert_state();
+
+            node_type* prev = nullptr;
+            for (auto cursor = m_head; cursor != nullptr; prev = cursor, cursor = cursor->next) {
+                if (cursor != &node) {
+                    continue;
+                }
+
+                if (prev == nullptr) {
+                    m_head = node.next;
+                } else {
+                    prev->next = node.next;
+                }
+
+                if (m_tail == &node) {
+                    m_tail = prev;
+                }
+
+                node.next = nullptr;
+                return true;
+            }
+
+            return false;
+        }
+
+        void append(slist&& rhs) noexcept {
+            assert_state();
+            rhs.assert_state();
+
+            if (rhs.m_head == nullptr) {
+                return;
+            }
+
+            if (m_head == nullptr) {
+                m_head = rhs.m_head;
+            } else {
+                m_tail->next = rhs.m_head;
+            }
+
+            m_tail = rhs.m_tail;
+            rhs.m_head = nullptr;
+            rhs.m_tail = nullptr;
+        }
     };
 }  // namespace concurrencpp::details
 
@@ -0,0 +1,130 @@
+#include "concurrencpp/task.h"
+#include "concurrencpp/errors.h"
+#include "concurrencpp/algorithms/constants.h"
+#include "concurrencpp/algorithms/impl/fork_join.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/executors/thread_pool_executor.h"
+
+#include <thread>
+#include <utility>
+
+using concurrencpp::details::fork_join_child;
+
+namespace concurrencpp::details {
+    namespace {
+        class fork_join_task {
+
+           private:
+            fork_join_child* m_child;
+            fork_join_child::invoke_fn m_invoke;
+            void* m_callable;
+
+           public:
+            fork_join_task(fork_join_child& child, fork_join_child::invoke_fn invoke, void* callable) noexcept :
+                m_child(&child), m_invoke(invoke), m_callable(callable) {}
+
+            fork_join_task(fork_join_task&& rhs) noexcept :
+                m_child(std::exchange(rhs.m_child, nullptr)), m_invoke(rhs.m_invoke), m_callable(rhs.m_callable) {}
+
+            ~fork_join_task() noexcept {
+                if (m_child == nullptr) {
+                    return;
+                }
+
+                // the task was destroyed without running, e.g. by the shutdown of the pool
+                const auto child = std::exchange(m_child, nullptr);
+                child->complete(std::make_exception_ptr(errors::broken_task(consts::k_fork_join_broken_task_err_msg)));
+            }
+
+            void operator()() noexcept {
+                const auto child = std::exchange(m_child, nullptr);
+                std::exception_ptr exception;
+
+                try {
+                    m_invoke(m_callable);
+                } catch (...) {
+                    exception = std::current_exception();
+                }
+
+                child->complete(std::move(exception));
+            }
+        };
+    }  // namespace
+}  // namespace concurrencpp::details
+
+bool fork_join_child::is_done(const void* context) noexcept {
+    return static_cast<const fork_join_child*>(context)->m_released.load(std::memory_order_acquire);
+}
+
+bool fork_join_child::try_fork(thread_pool_executor& executor, invoke_fn invoke, void* callable) noexcept {
+    const auto worker_index = executor.acquire_idle_worker();
+    if (worker_index == static_cast<size_t>(-1)) {
+        return false;
+    }
+
+    m_forked = true;
+
+    concurrencpp::task task(fork_join_task(*this, invoke, callable));
+
+    try {
+        executor.enqueue_to_worker(worker_index, task);
+    } catch (...) {
+        // the pool is shut down, the task completes the child with an error when it's destroyed
+    }
+
+    return true;
+}
+
+bool fork_join_child::try_fork(executor& executor, invoke_fn invoke, void* callable) noexcept {
+    m_forked = true;
+
+    try {
+        executor.enqueue(concurrencpp::task(fork_join_task(*this, invoke, callable)));
+    } catch (...) {
+        // the executor is shut down, the task completed the child with an error when it was destroyed
+    }
+
+    return true;
+}
+
+void fork_join_child::complete(std::exception_ptr exception) noexcept {
+    m_exception = std::move(exception);
+    m_done.store(true, std::memory_order_release);
+    m_done.notify_one();
+
+    // the last access to the child: the joiner may leave the scope of the child as soon as it sees this store
+    m_released.store(true, std::memory_order_release);
+}
+
+void fork_join_child::join() {
+    if (!m_forked || m_released.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    if (details::help_thread_pool_until(is_done, this)) {
+        return;
+    }
+
+    m_done.wait(false, std::memory_order_acquire);
+
+    // the completer is between notifying and releasing the child, which takes a moment at most
+    while (!m_released.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+}
+
+void fork_join_child::join_all(fork_join_child* children, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        children[i].join();
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        children[i].rethrow_if_failed();
+    }
+}
+
+void fork_join_child::rethrow_if_failed() const {
+    if (static_cast<bool>(m_exception)) {
+        std::rethrow_exception(m_exception);
+    }
+}
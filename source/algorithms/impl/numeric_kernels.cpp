@@ -0,0 +1,220 @@
+#include "concurrencpp/algorithms/impl/numeric_kernels.h"
+
+#include <algorithm>
+
+#if defined(CRCPP_NUMERIC_X86_KERNELS) && defined(CRCPP_MSVC_COMPILER)
+#    include <intrin.h>
+#endif
+
+using concurrencpp::numeric::instruction_set;
+using concurrencpp::details::numeric_kernels;
+
+namespace {
+    // four independent accumulators, so additions of consecutive elements don't wait on each other
+    template<class type>
+    double scalar_sum(const type* data, size_t size) noexcept {
+        double partials[4] = {};
+        size_t i = 0;
+
+        for (; i + 4 <= size; i += 4) {
+            partials[0] += static_cast<double>(data[i]);
+            partials[1] += static_cast<double>(data[i + 1]);
+            partials[2] += static_cast<double>(data[i + 2]);
+            partials[3] += static_cast<double>(data[i + 3]);
+        }
+
+        for (; i < size; i++) {
+            partials[0] += static_cast<double>(data[i]);
+        }
+
+        return (partials[0] + partials[1]) + (partials[2] + partials[3]);
+    }
+
+    double scalar_sum_f32(const float* data, size_t size) noexcept {
+        return scalar_sum(data, size);
+    }
+
+    double scalar_sum_f64(const double* data, size_t size) noexcept {
+        return scalar_sum(data, size);
+    }
+
+    int64_t scalar_sum_i32(const int32_t* data, size_t size) noexcept {
+        int64_t result = 0;
+        for (size_t i = 0; i < size; i++) {
+            result += data[i];
+        }
+
+        return result;
+    }
+
+    template<class type>
+    void scalar_min_max(const type* data, size_t size, type& min, type& max) noexcept {
+        for (size_t i = 0; i < size; i++) {
+            min = std::min(min, data[i]);
+            max = std::max(max, data[i]);
+        }
+    }
+
+    void scalar_min_max_f32(const float* data, size_t size, float& min, float& max) noexcept {
+        scalar_min_max(data, size, min, max);
+    }
+
+    void scalar_min_max_f64(const double* data, size_t size, double& min, double& max) noexcept {
+        scalar_min_max(data, size, min, max);
+    }
+
+    void scalar_min_max_i32(const int32_t* data, size_t size, int32_t& min, int32_t& max) noexcept {
+        scalar_min_max(data, size, min, max);
+    }
+
+    template<class type>
+    double scalar_dot(const type* lhs, const type* rhs, size_t size) noexcept {
+        double partials[4] = {};
+        size_t i = 0;
+
+        for (; i + 4 <= size; i += 4) {
+            partials[0] += static_cast<double>(lhs[i]) * static_cast<double>(rhs[i]);
+            partials[1] += static_cast<double>(lhs[i + 1]) * static_cast<double>(rhs[i + 1]);
+            partials[2] += static_cast<double>(lhs[i + 2]) * static_cast<double>(rhs[i + 2]);
+            partials[3] += static_cast<double>(lhs[i + 3]) * static_cast<double>(rhs[i + 3]);
+        }
+
+        for (; i < size; i++) {
+            partials[0] += static_cast<double>(lhs[i]) * static_cast<double>(rhs[i]);
+        }
+
+        return (partials[0] + partials[1]) + (partials[2] + partials[3]);
+    }
+
+    double scalar_dot_f32(const float* lhs, const float* rhs, size_t size) noexcept {
+        return scalar_dot(lhs, rhs, size);
+    }
+
+    double scalar_dot_f64(const double* lhs, const double* rhs, size_t size) noexcept {
+        return scalar_dot(lhs, rhs, size);
+    }
+
+    void
+    scalar_histogram_f32(const float* data, size_t size, float low, float high, float scale, uint64_t* bins, size_t bin_count) noexcept {
+        for (size_t i = 0; i < size; i++) {
+            const auto value = data[i];
+            if (!(value >= low && value < high)) {
+                continue;
+            }
+
+            ++bins[concurrencpp::details::histogram_bin((value - low) * scale, bin_count)];
+        }
+    }
+}  // namespace
+
+namespace concurrencpp::details {
+    // shared by all the instruction sets: a vector gains nothing on the 64 bit division that maps a value to its bin.
+    void scalar_histogram_i32(const int32_t* data, size_t size, int32_t low, int32_t high, uint64_t* bins, size_t bin_count) noexcept {
+        const auto range = static_cast<uint64_t>(int64_t(high) - int64_t(low));
+
+        for (size_t i = 0; i < size; i++) {
+            const auto value = data[i];
+            if (value < low || value >= high) {
+                continue;
+            }
+
+            // offset < range <= 2^32 and bin_count <= 2^24, the product can't overflow
+            const auto offset = static_cast<uint64_t>(int64_t(value) - int64_t(low));
+            ++bins[offset * bin_count / range];
+        }
+    }
+}  // namespace concurrencpp::details
+
+const numeric_kernels& concurrencpp::details::scalar_numeric_kernels() noexcept {
+    static constexpr numeric_kernels kernels {instruction_set::scalar,
+                                              scalar_sum_f32,
+                                              scalar_sum_f64,
+                                              scalar_sum_i32,
+                                              scalar_min_max_f32,
+                                              scalar_min_max_f64,
+                                              scalar_min_max_i32,
+                                              scalar_dot_f32,
+                                              scalar_dot_f64,
+                                              scalar_histogram_f32,
+                                              scalar_histogram_i32};
+    return kernels;
+}
+
+instruction_set concurrencpp::details::detect_instruction_set() noexcept {
+#if defined(CRCPP_NUMERIC_X86_KERNELS) && defined(CRCPP_MSVC_COMPILER)
+    int info[4];
+    ::__cpuid(info, 0);
+    if (info[0] < 7) {
+        return instruction_set::scalar;
+    }
+
+    ::__cpuid(info, 1);
+    const bool fma = (info[2] & (1 << 12)) != 0;
+    const bool osxsave = (info[2] & (1 << 27)) != 0;  // the os saves the extended registers on context switches
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx) {
+        return instruction_set::scalar;
+    }
+
+    const auto xcr0 = ::_xgetbv(0);
+    ::__cpuidex(info, 7, 0);
+    const bool avx2 = (info[1] & (1 << 5)) != 0;
+    const bool avx512f = (info[1] & (1 << 16)) != 0;
+
+    if (avx512f && (xcr0 & 0xe6) == 0xe6) {
+        return instruction_set::avx512;
+    }
+
+    if (avx2 && fma && (xcr0 & 0x6) == 0x6) {
+        return instruction_set::avx2;
+    }
+#elif defined(CRCPP_NUMERIC_X86_KERNELS)
+    __builtin_cpu_init();
+
+    // checks the os saves the wide registers as well
+    if (__builtin_cpu_supports("avx512f")) {
+        return instruction_set::avx512;
+    }
+
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return instruction_set::avx2;
+    }
+#elif defined(CRCPP_NUMERIC_NEON_KERNELS)
+    return instruction_set::neon;  // part of every aarch64 cpu
+#endif
+
+    return instruction_set::scalar;
+}
+
+const numeric_kernels* concurrencpp::details::numeric_kernels_of(instruction_set isa) noexcept {
+    static const auto best = detect_instruction_set();
+
+    switch (isa) {
+        case instruction_set::scalar: {
+            return &scalar_numeric_kernels();
+        }
+
+#if defined(CRCPP_NUMERIC_X86_KERNELS)
+        case instruction_set::avx2: {
+            return (best == instruction_set::avx2 || best == instruction_set::avx512) ? &avx2_numeric_kernels() : nullptr;
+        }
+
+        case instruction_set::avx512: {
+            return (best == instruction_set::avx512) ? &avx512_numeric_kernels() : nullptr;
+        }
+#elif defined(CRCPP_NUMERIC_NEON_KERNELS)
+        case instruction_set::neon: {
+            return &neon_numeric_kernels();
+        }
+#endif
+
+        default: {
+            return nullptr;
+        }
+    }
+}
+
+const numeric_kernels& concurrencpp::details::active_numeric_kernels() noexcept {
+    static const auto& kernels = *numeric_kernels_of(detect_instruction_set());
+    return kernels;
+}
@@ -0,0 +1,250 @@
+#include "concurrencpp/algorithms/impl/numeric_kernels.h"
+
+#if defined(CRCPP_NUMERIC_NEON_KERNELS)
+
+#    include <algorithm>
+
+#    include <arm_neon.h>
+
+/*
+    NEON is part of every aarch64 cpu, so the kernels are compiled for the baseline of the build.
+    Every loop keeps four independent accumulators, enough to hide the latency of an add or a fused multiply-add.
+*/
+
+using concurrencpp::numeric::instruction_set;
+using concurrencpp::details::numeric_kernels;
+
+namespace {
+    double neon_sum_f32(const float* data, size_t size) noexcept {
+        float64x2_t acc0 = vdupq_n_f64(0), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+        size_t i = 0;
+
+        for (; i + 8 <= size; i += 8) {
+            const auto lhs = vld1q_f32(data + i);
+            const auto rhs = vld1q_f32(data + i + 4);
+            acc0 = vaddq_f64(acc0, vcvt_f64_f32(vget_low_f32(lhs)));
+            acc1 = vaddq_f64(acc1, vcvt_high_f64_f32(lhs));
+            acc2 = vaddq_f64(acc2, vcvt_f64_f32(vget_low_f32(rhs)));
+            acc3 = vaddq_f64(acc3, vcvt_high_f64_f32(rhs));
+        }
+
+        auto result = vaddvq_f64(vaddq_f64(vaddq_f64(acc0, acc1), vaddq_f64(acc2, acc3)));
+        for (; i < size; i++) {
+            result += static_cast<double>(data[i]);
+        }
+
+        return result;
+    }
+
+    double neon_sum_f64(const double* data, size_t size) noexcept {
+        float64x2_t acc0 = vdupq_n_f64(0), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+        size_t i = 0;
+
+        for (; i + 8 <= size; i += 8) {
+            acc0 = vaddq_f64(acc0, vld1q_f64(data + i));
+            acc1 = vaddq_f64(acc1, vld1q_f64(data + i + 2));
+            acc2 = vaddq_f64(acc2, vld1q_f64(data + i + 4));
+            acc3 = vaddq_f64(acc3, vld1q_f64(data + i + 6));
+        }
+
+        auto result = vaddvq_f64(vaddq_f64(vaddq_f64(acc0, acc1), vaddq_f64(acc2, acc3)));
+        for (; i < size; i++) {
+            result += data[i];
+        }
+
+        return result;
+    }
+
+    int64_t neon_sum_i32(const int32_t* data, size_t size) noexcept {
+        int64x2_t acc0 = vdupq_n_s64(0), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+        size_t i = 0;
+
+        for (; i + 8 <= size; i += 8) {
+            const auto lhs = vld1q_s32(data + i);
+            const auto rhs = vld1q_s32(data + i + 4);
+            acc0 = vaddw_s32(acc0, vget_low_s32(lhs));
+            acc1 = vaddw_high_s32(acc1, lhs);
+            acc2 = vaddw_s32(acc2, vget_low_s32(rhs));
+            acc3 = vaddw_high_s32(acc3, rhs);
+        }
+
+        int64_t result = vaddvq_s64(vaddq_s64(vaddq_s64(acc0, acc1), vaddq_s64(acc2, acc3)));
+        for (; i < size; i++) {
+            result += data[i];
+        }
+
+        return result;
+    }
+
+    void neon_min_max_f32(const float* data, size_t size, float& min, float& max) noexcept {
+        size_t i = 0;
+
+        if (size >= 8) {
+            float32x4_t min0 = vdupq_n_f32(min), min1 = min0;
+            float32x4_t max0 = vdupq_n_f32(max), max1 = max0;
+
+            for (; i + 8 <= size; i += 8) {
+                const auto lhs = vld1q_f32(data + i);
+                const auto rhs = vld1q_f32(data + i + 4);
+                min0 = vminq_f32(min0, lhs);
+                min1 = vminq_f32(min1, rhs);
+                max0 = vmaxq_f32(max0, lhs);
+                max1 = vmaxq_f32(max1, rhs);
+            }
+
+            min = vminvq_f32(vminq_f32(min0, min1));
+            max = vmaxvq_f32(vmaxq_f32(max0, max1));
+        }
+
+        for (; i < size; i++) {
+            min = std::min(min, data[i]);
+            max = std::max(max, data[i]);
+        }
+    }
+
+    void neon_min_max_f64(const double* data, size_t size, double& min, double& max) noexcept {
+        size_t i = 0;
+
+        if (size >= 4) {
+            float64x2_t min0 = vdupq_n_f64(min), min1 = min0;
+            float64x2_t max0 = vdupq_n_f64(max), max1 = max0;
+
+            for (; i + 4 <= size; i += 4) {
+                const auto lhs = vld1q_f64(data + i);
+                const auto rhs = vld1q_f64(data + i + 2);
+                min0 = vminq_f64(min0, lhs);
+                min1 = vminq_f64(min1, rhs);
+                max0 = vmaxq_f64(max0, lhs);
+                max1 = vmaxq_f64(max1, rhs);
+            }
+
+            min = vminvq_f64(vminq_f64(min0, min1));
+            max = vmaxvq_f64(vmaxq_f64(max0, max1));
+        }
+
+        for (; i < size; i++) {
+            min = std::min(min, data[i]);
+            max = std::max(max, data[i]);
+        }
+    }
+
+    void neon_min_max_i32(const int32_t* data, size_t size, int32_t& min, int32_t& max) noexcept {
+        size_t i = 0;
+
+        if (size >= 8) {
+            int32x4_t min0 = vdupq_n_s32(min), min1 = min0;
+            int32x4_t max0 = vdupq_n_s32(max), max1 = max0;
+
+            for (; i + 8 <= size; i += 8) {
+                const auto lhs = vld1q_s32(data + i);
+                const auto rhs = vld1q_s32(data + i + 4);
+                min0 = vminq_s32(min0, lhs);
+                min1 = vminq_s32(min1, rhs);
+                max0 = vmaxq_s32(max0, lhs);
+                max1 = vmaxq_s32(max1, rhs);
+            }
+
+            min = vminvq_s32(vminq_s32(min0, min1));
+            max = vmaxvq_s32(vmaxq_s32(max0, max1));
+        }
+
+        for (; i < size; i++) {
+            min = std::min(min, data[i]);
+            max = std::max(max, data[i]);
+        }
+    }
+
+    double neon_dot_f32(const float* lhs, const float* rhs, size_t size) noexcept {
+        float64x2_t acc0 = vdupq_n_f64(0), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+        size_t i = 0;
+
+        for (; i + 8 <= size; i += 8) {
+            const auto lhs0 = vld1q_f32(lhs + i), lhs1 = vld1q_f32(lhs + i + 4);
+            const auto rhs0 = vld1q_f32(rhs + i), rhs1 = vld1q_f32(rhs + i + 4);
+            acc0 = vfmaq_f64(acc0, vcvt_f64_f32(vget_low_f32(lhs0)), vcvt_f64_f32(vget_low_f32(rhs0)));
+            acc1 = vfmaq_f64(acc1, vcvt_high_f64_f32(lhs0), vcvt_high_f64_f32(rhs0));
+            acc2 = vfmaq_f64(acc2, vcvt_f64_f32(vget_low_f32(lhs1)), vcvt_f64_f32(vget_low_f32(rhs1)));
+            acc3 = vfmaq_f64(acc3, vcvt_high_f64_f32(lhs1), vcvt_high_f64_f32(rhs1));
+        }
+
+        auto result = vaddvq_f64(vaddq_f64(vaddq_f64(acc0, acc1), vaddq_f64(acc2, acc3)));
+        for (; i < size; i++) {
+            result += static_cast<double>(lhs[i]) * static_cast<double>(rhs[i]);
+        }
+
+        return result;
+    }
+
+    double neon_dot_f64(const double* lhs, const double* rhs, size_t size) noexcept {
+        float64x2_t acc0 = vdupq_n_f64(0), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+        size_t i = 0;
+
+        for (; i + 8 <= size; i += 8) {
+            acc0 = vfmaq_f64(acc0, vld1q_f64(lhs + i), vld1q_f64(rhs + i));
+            acc1 = vfmaq_f64(acc1, vld1q_f64(lhs + i + 2), vld1q_f64(rhs + i + 2));
+            acc2 = vfmaq_f64(acc2, vld1q_f64(lhs + i + 4), vld1q_f64(rhs + i + 4));
+            acc3 = vfmaq_f64(acc3, vld1q_f64(lhs + i + 6), vld1q_f64(rhs + i + 6));
+        }
+
+        auto result = vaddvq_f64(vaddq_f64(vaddq_f64(acc0, acc1), vaddq_f64(acc2, acc3)));
+        for (; i < size; i++) {
+            result += lhs[i] * rhs[i];
+        }
+
+        return result;
+    }
+
+    // the bin positions are computed 4 at a time, only the counting itself is scalar
+    void
+    neon_histogram_f32(const float* data, size_t size, float low, float high, float scale, uint64_t* bins, size_t bin_count) noexcept {
+        const auto low_vector = vdupq_n_f32(low);
+        const auto high_vector = vdupq_n_f32(high);
+        const auto scale_vector = vdupq_n_f32(scale);
+        const auto last_bin = vdupq_n_f32(static_cast<float>(bin_count - 1));
+        const auto first_bin = vdupq_n_f32(0.0f);
+        size_t i = 0;
+
+        for (; i + 4 <= size; i += 4) {
+            const auto values = vld1q_f32(data + i);
+            const auto in_range = vandq_u32(vcgeq_f32(values, low_vector), vcltq_f32(values, high_vector));
+            const auto positions = vmulq_f32(vsubq_f32(values, low_vector), scale_vector);
+
+            // clamped before the conversion: vmaxnmq_f32 returns the number for a NaN position
+            const auto clamped = vminq_f32(vmaxnmq_f32(positions, first_bin), last_bin);
+
+            uint32_t indices[4], masks[4];
+            vst1q_u32(indices, vcvtq_u32_f32(clamped));
+            vst1q_u32(masks, in_range);
+
+            for (size_t j = 0; j < 4; j++) {
+                if (masks[j] != 0) {
+                    ++bins[indices[j]];
+                }
+            }
+        }
+
+        for (; i < size; i++) {
+            const auto value = data[i];
+            if (value >= low && value < high) {
+                ++bins[concurrencpp::details::histogram_bin((value - low) * scale, bin_count)];
+            }
+        }
+    }
+}  // namespace
+
+const numeric_kernels& concurrencpp::details::neon_numeric_kernels() noexcept {
+    static constexpr numeric_kernels kernels {instruction_set::neon,
+                                              neon_sum_f32,
+                                              neon_sum_f64,
+                                              neon_sum_i32,
+                                              neon_min_max_f32,
+                                              neon_min_max_f64,
+                                              neon_min_max_i32,
+                                              neon_dot_f32,
+                                              neon_dot_f64,
+                                              neon_histogram_f32,
+                                              scalar_histogram_i32};
+    return kernels;
+}
+
+#endif
@@ -0,0 +1,509 @@
+#include "concurrencpp/algorithms/impl/numeric_kernels.h"
+
+#if defined(CRCPP_NUMERIC_X86_KERNELS)
+
+#    include <bit>
+#    include <algorithm>
+
+#    include <immintrin.h>
+
+/*
+    The kernels are compiled for their instruction set function by function, the rest of the library keeps the baseline
+    the build targets. They are only called after detect_instruction_set() found the instruction set on the cpu.
+    Every loop keeps four independent accumulators, enough to hide the latency of an add or a fused multiply-add.
+*/
+#    if defined(CRCPP_MSVC_COMPILER)
+#        define CRCPP_AVX2_TARGET
+#        define CRCPP_AVX512_TARGET
+#    else
+#        define CRCPP_AVX2_TARGET   __attribute__((target("avx2,fma")))
+#        define CRCPP_AVX512_TARGET __attribute__((target("avx2,fma,avx512f")))
+#    endif
+
+using concurrencpp::numeric::instruction_set;
+using concurrencpp::details::numeric_kernels;
+
+namespace {
+    /*
+        AVX2
+    */
+    CRCPP_AVX2_TARGET inline double avx2_reduce_add(__m256d value) noexcept {
+        const __m128d half = _mm_add_pd(_mm256_castpd256_pd128(value), _mm256_extractf128_pd(value, 1));
+        return _mm_cvtsd_f64(_mm_add_sd(half, _mm_unpackhi_pd(half, half)));
+    }
+
+    CRCPP_AVX2_TARGET inline int64_t avx2_reduce_add(__m256i value) noexcept {
+        const __m128i half = _mm_add_epi64(_mm256_castsi256_si128(value), _mm256_extracti128_si256(value, 1));
+        return _mm_cvtsi128_si64(_mm_add_epi64(half, _mm_unpackhi_epi64(half, half)));
+    }
+
+    CRCPP_AVX2_TARGET double avx2_sum_f32(const float* data, size_t size) noexcept {
+        __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd(), acc2 = _mm256_setzero_pd(), acc3 = _mm256_setzero_pd();
+        size_t i = 0;
+
+        for (; i + 16 <= size; i += 16) {
+            acc0 = _mm256_add_pd(acc0, _mm256_cvtps_pd(_mm_loadu_ps(data + i)));
+            acc1 = _mm256_add_pd(acc1, _mm256_cvtps_pd(_mm_loadu_ps(data + i + 4)));
+            acc2 = _mm256_add_pd(acc2, _mm256_cvtps_pd(_mm_loadu_ps(data + i + 8)));
+            acc3 = _mm256_add_pd(acc3, _mm256_cvtps_pd(_mm_loadu_ps(data + i + 12)));
+        }
+
+        auto result = avx2_reduce_add(_mm256_add_pd(_mm256_add_pd(acc0, acc1), _mm256_add_pd(acc2, acc3)));
+        for (; i < size; i++) {
+            result += static_cast<double>(data[i]);
+        }
+
+        return result;
+    }
+
+    CRCPP_AVX2_TARGET double avx2_sum_f64(const double* data, size_t size) noexcept {
+        __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd(), acc2 = _mm256_setzero_pd(), acc3 = _mm256_setzero_pd();
+        size_t i = 0;
+
+        for (; i + 16 <= size; i += 16) {
+            acc0 = _mm256_add_pd(acc0, _mm256_loadu_pd(data + i));
+            acc1 = _mm256_add_pd(acc1, _mm256_loadu_pd(data + i + 4));
+            acc2 = _mm256_add_pd(acc2, _mm256_loadu_pd(data + i + 8));
+            acc3 = _mm256_add_pd(acc3, _mm256_loadu_pd(data + i + 12));
+        }
+
+        auto result = avx2_reduce_add(_mm256_add_pd(_mm256_add_pd(acc0, acc1), _mm256_add_pd(acc2, acc3)));
+        for (; i < size; i++) {
+            result += data[i];
+        }
+
+        return result;
+    }
+
+    CRCPP_AVX2_TARGET int64_t avx2_sum_i32(const int32_t* data, size_t size) noexcept {
+        __m256i acc0 = _mm256_setzero_si256(), acc1 = _mm256_setzero_si256(), acc2 = _mm256_setzero_si256(),
+                acc3 = _mm256_setzero_si256();
+        size_t i = 0;
+
+        for (; i + 16 <= size; i += 16) {
+            const auto* const block = reinterpret_cast<const __m128i*>(data + i);
+            acc0 = _mm256_add_epi64(acc0, _mm256_cvtepi32_epi64(_mm_loadu_si128(block)));
+            acc1 = _mm256_add_epi64(acc1, _mm256_cvtepi32_epi64(_mm_loadu_si128(block + 1)));
+            acc2 = _mm256_add_epi64(acc2, _mm256_cvtepi32_epi64(_mm_loadu_si128(block + 2)));
+            acc3 = _mm256_add_epi64(acc3, _mm256_cvtepi32_epi64(_mm_loadu_si128(block + 3)));
+        }
+
+        auto result = avx2_reduce_add(_mm256_add_epi64(_mm256_add_epi64(acc0, acc1), _mm256_add_epi64(acc2, acc3)));
+        for (; i < size; i++) {
+            result += data[i];
+        }
+
+        return result;
+    }
+
+    CRCPP_AVX2_TARGET void avx2_min_max_f32(const float* data, size_t size, float& min, float& max) noexcept {
+        size_t i = 0;
+
+        if (size >= 16) {
+            __m256 min0 = _mm256_set1_ps(min), min1 = min0;
+            __m256 max0 = _mm256_set1_ps(max), max1 = max0;
+
+            for (; i + 16 <= size; i += 16) {
+                const auto lhs = _mm256_loadu_ps(data + i);
+                const auto rhs = _mm256_loadu_ps(data + i + 8);
+                min0 = _mm256_min_ps(min0, lhs);
+                min1 = _mm256_min_ps(min1, rhs);
+                max0 = _mm256_max_ps(max0, lhs);
+                max1 = _mm256_max_ps(max1, rhs);
+            }
+
+            alignas(32) float mins[8], maxs[8];
+            _mm256_store_ps(mins, _mm256_min_ps(min0, min1));
+            _mm256_store_ps(maxs, _mm256_max_ps(max0, max1));
+            min = *std::min_element(mins, mins + 8);
+            max = *std::max_element(maxs, maxs + 8);
+        }
+
+        for (; i < size; i++) {
+            min = std::min(min, data[i]);
+            max = std::max(max, data[i]);
+        }
+    }
+
+    CRCPP_AVX2_TARGET void avx2_min_max_f64(const double* data, size_t size, double& min, double& max) noexcept {
+        size_t i = 0;
+
+        if (size >= 8) {
+            __m256d min0 = _mm256_set1_pd(min), min1 = min0;
+            __m256d max0 = _mm256_set1_pd(max), max1 = max0;
+
+            for (; i + 8 <= size; i += 8) {
+                const auto lhs = _mm256_loadu_pd(data + i);
+                const auto rhs = _mm256_loadu_pd(data + i + 4);
+                min0 = _mm256_min_pd(min0, lhs);
+                min1 = _mm256_min_pd(min1, rhs);
+                max0 = _mm256_max_pd(max0, lhs);
+                max1 = _mm256_max_pd(max1, rhs);
+            }
+
+            alignas(32) double mins[4], maxs[4];
+            _mm256_store_pd(mins, _mm256_min_pd(min0, min1));
+            _mm256_store_pd(maxs, _mm256_max_pd(max0, max1));
+            min = *std::min_element(mins, mins + 4);
+            max = *std::max_element(maxs, maxs + 4);
+        }
+
+        for (; i < size; i++) {
+            min = std::min(min, data[i]);
+            max = std::max(max, data[i]);
+        }
+    }
+
+    CRCPP_AVX2_TARGET void avx2_min_max_i32(const int32_t* data, size_t size, int32_t& min, int32_t& max) noexcept {
+        size_t i = 0;
+
+        if (size >= 16) {
+            __m256i min0 = _mm256_set1_epi32(min), min1 = min0;
+            __m256i max0 = _mm256_set1_epi32(max), max1 = max0;
+
+            for (; i + 16 <= size; i += 16) {
+                const auto* const block = reinterpret_cast<const __m256i*>(data + i);
+                const auto lhs = _mm256_loadu_si256(block);
+                const auto rhs = _mm256_loadu_si256(block + 1);
+                min0 = _mm256_min_epi32(min0, lhs);
+                min1 = _mm256_min_epi32(min1, rhs);
+                max0 = _mm256_max_epi32(max0, lhs);
+                max1 = _mm256_max_epi32(max1, rhs);
+            }
+
+            alignas(32) int32_t mins[8], maxs[8];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(mins), _mm256_min_epi32(min0, min1));
+            _mm256_store_si256(reinterpret_cast<__m256i*>(maxs), _mm256_max_epi32(max0, max1));
+            min = *std::min_element(mins, mins + 8);
+            max = *std::max_element(maxs, maxs + 8);
+        }
+
+        for (; i < size; i++) {
+            min = std::min(min, data[i]);
+            max = std::max(max, data[i]);
+        }
+    }
+
+    CRCPP_AVX2_TARGET double avx2_dot_f32(const float* lhs, const float* rhs, size_t size) noexcept {
+        __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd(), acc2 = _mm256_setzero_pd(), acc3 = _mm256_setzero_pd();
+        size_t i = 0;
+
+        for (; i + 16 <= size; i += 16) {
+            acc0 = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(lhs + i)), _mm256_cvtps_pd(_mm_loadu_ps(rhs + i)), acc0);
+            acc1 = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(lhs + i + 4)), _mm256_cvtps_pd(_mm_loadu_ps(rhs + i + 4)), acc1);
+            acc2 = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(lhs + i + 8)), _mm256_cvtps_pd(_mm_loadu_ps(rhs + i + 8)), acc2);
+            acc3 = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(lhs + i + 12)), _mm256_cvtps_pd(_mm_loadu_ps(rhs + i + 12)), acc3);
+        }
+
+        auto result = avx2_reduce_add(_mm256_add_pd(_mm256_add_pd(acc0, acc1), _mm256_add_pd(acc2, acc3)));
+        for (; i < size; i++) {
+            result += static_cast<double>(lhs[i]) * static_cast<double>(rhs[i]);
+        }
+
+        return result;
+    }
+
+    CRCPP_AVX2_TARGET double avx2_dot_f64(const double* lhs, const double* rhs, size_t size) noexcept {
+        __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd(), acc2 = _mm256_setzero_pd(), acc3 = _mm256_setzero_pd();
+        size_t i = 0;
+
+        for (; i + 16 <= size; i += 16) {
+            acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(lhs + i), _mm256_loadu_pd(rhs + i), acc0);
+            acc1 = _mm256_fmadd_pd(_mm256_loadu_pd(lhs + i + 4), _mm256_loadu_pd(rhs + i + 4), acc1);
+            acc2 = _mm256_fmadd_pd(_mm256_loadu_pd(lhs + i + 8), _mm256_loadu_pd(rhs + i + 8), acc2);
+            acc3 = _mm256_fmadd_pd(_mm256_loadu_pd(lhs + i + 12), _mm256_loadu_pd(rhs + i + 12), acc3);
+        }
+
+        auto result = avx2_reduce_add(_mm256_add_pd(_mm256_add_pd(acc0, acc1), _mm256_add_pd(acc2, acc3)));
+        for (; i < size; i++) {
+            result += lhs[i] * rhs[i];
+        }
+
+        return result;
+    }
+
+    // the bin positions are computed 8 at a time, only the counting itself is scalar
+    CRCPP_AVX2_TARGET void
+    avx2_histogram_f32(const float* data, size_t size, float low, float high, float scale, uint64_t* bins, size_t bin_count) noexcept {
+        const auto low_vector = _mm256_set1_ps(low);
+        const auto high_vector = _mm256_set1_ps(high);
+        const auto scale_vector = _mm256_set1_ps(scale);
+        const auto last_bin = _mm256_set1_ps(static_cast<float>(bin_count - 1));
+        const auto first_bin = _mm256_setzero_ps();
+        size_t i = 0;
+
+        for (; i + 8 <= size; i += 8) {
+            const auto values = _mm256_loadu_ps(data + i);
+            const auto at_least_low = _mm256_cmp_ps(values, low_vector, _CMP_GE_OQ);
+            const auto in_range = _mm256_and_ps(at_least_low, _mm256_cmp_ps(values, high_vector, _CMP_LT_OQ));
+            const auto positions = _mm256_mul_ps(_mm256_sub_ps(values, low_vector), scale_vector);
+
+            // clamped before the conversion: _mm256_max_ps returns its second operand for a NaN position
+            const auto clamped = _mm256_min_ps(_mm256_max_ps(positions, first_bin), last_bin);
+
+            alignas(32) int32_t indices[8];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(indices), _mm256_cvttps_epi32(clamped));
+
+            for (auto mask = static_cast<unsigned>(_mm256_movemask_ps(in_range)); mask != 0; mask &= mask - 1) {
+                ++bins[indices[std::countr_zero(mask)]];
+            }
+        }
+
+        for (; i < size; i++) {
+            const auto value = data[i];
+            if (value >= low && value < high) {
+                ++bins[concurrencpp::details::histogram_bin((value - low) * scale, bin_count)];
+            }
+        }
+    }
+
+    /*
+        AVX-512
+    */
+    CRCPP_AVX512_TARGET double avx512_sum_f32(const float* data, size_t size) noexcept {
+        __m512d acc0 = _mm512_setzero_pd(), acc1 = _mm512_setzero_pd(), acc2 = _mm512_setzero_pd(), acc3 = _mm512_setzero_pd();
+        size_t i = 0;
+
+        for (; i + 32 <= size; i += 32) {
+            acc0 = _mm512_add_pd(acc0, _mm512_cvtps_pd(_mm256_loadu_ps(data + i)));
+            acc1 = _mm512_add_pd(acc1, _mm512_cvtps_pd(_mm256_loadu_ps(data + i + 8)));
+            acc2 = _mm512_add_pd(acc2, _mm512_cvtps_pd(_mm256_loadu_ps(data + i + 16)));
+            acc3 = _mm512_add_pd(acc3, _mm512_cvtps_pd(_mm256_loadu_ps(data + i + 24)));
+        }
+
+        auto result = _mm512_reduce_add_pd(_mm512_add_pd(_mm512_add_pd(acc0, acc1), _mm512_add_pd(acc2, acc3)));
+        for (; i < size; i++) {
+            result += static_cast<double>(data[i]);
+        }
+
+        return result;
+    }
+
+    CRCPP_AVX512_TARGET double avx512_sum_f64(const double* data, size_t size) noexcept {
+        __m512d acc0 = _mm512_setzero_pd(), acc1 = _mm512_setzero_pd(), acc2 = _mm512_setzero_pd(), acc3 = _mm512_setzero_pd();
+        size_t i = 0;
+
+        for (; i + 32 <= size; i += 32) {
+            acc0 = _mm512_add_pd(acc0, _mm512_loadu_pd(data + i));
+            acc1 = _mm512_add_pd(acc1, _mm512_loadu_pd(data + i + 8));
+            acc2 = _mm512_add_pd(acc2, _mm512_loadu_pd(data + i + 16));
+            acc3 = _mm512_add_pd(acc3, _mm512_loadu_pd(data + i + 24));
+        }
+
+        auto result = _mm512_reduce_add_pd(_mm512_add_pd(_mm512_add_pd(acc0, acc1), _mm512_add_pd(acc2, acc3)));
+        for (; i < size; i++) {
+            result += data[i];
+        }
+
+        return result;
+    }
+
+    CRCPP_AVX512_TARGET int64_t avx512_sum_i32(const int32_t* data, size_t size) noexcept {
+        __m512i acc0 = _mm512_setzero_si512(), acc1 = _mm512_setzero_si512(), acc2 = _mm512_setzero_si512(),
+                acc3 = _mm512_setzero_si512();
+        size_t i = 0;
+
+        for (; i + 32 <= size; i += 32) {
+            const auto* const block = reinterpret_cast<const __m256i*>(data + i);
+            acc0 = _mm512_add_epi64(acc0, _mm512_cvtepi32_epi64(_mm256_loadu_si256(block)));
+            acc1 = _mm512_add_epi64(acc1, _mm512_cvtepi32_epi64(_mm256_loadu_si256(block + 1)));
+            acc2 = _mm512_add_epi64(acc2, _mm512_cvtepi32_epi64(_mm256_loadu_si256(block + 2)));
+            acc3 = _mm512_add_epi64(acc3, _mm512_cvtepi32_epi64(_mm256_loadu_si256(block + 3)));
+        }
+
+        int64_t result = _mm512_reduce_add_epi64(_mm512_add_epi64(_mm512_add_epi64(acc0, acc1), _mm512_add_epi64(acc2, acc3)));
+        for (; i < size; i++) {
+            result += data[i];
+        }
+
+        return result;
+    }
+
+    CRCPP_AVX512_TARGET void avx512_min_max_f32(const float* data, size_t size, float& min, float& max) noexcept {
+        size_t i = 0;
+
+        if (size >= 32) {
+            __m512 min0 = _mm512_set1_ps(min), min1 = min0;
+            __m512 max0 = _mm512_set1_ps(max), max1 = max0;
+
+            for (; i + 32 <= size; i += 32) {
+                const auto lhs = _mm512_loadu_ps(data + i);
+                const auto rhs = _mm512_loadu_ps(data + i + 16);
+                min0 = _mm512_min_ps(min0, lhs);
+                min1 = _mm512_min_ps(min1, rhs);
+                max0 = _mm512_max_ps(max0, lhs);
+                max1 = _mm512_max_ps(max1, rhs);
+            }
+
+            min = _mm512_reduce_min_ps(_mm512_min_ps(min0, min1));
+            max = _mm512_reduce_max_ps(_mm512_max_ps(max0, max1));
+        }
+
+        for (; i < size; i++) {
+            min = std::min(min, data[i]);
+            max = std::max(max, data[i]);
+        }
+    }
+
+    CRCPP_AVX512_TARGET void avx512_min_max_f64(const double* data, size_t size, double& min, double& max) noexcept {
+        size_t i = 0;
+
+        if (size >= 16) {
+            __m512d min0 = _mm512_set1_pd(min), min1 = min0;
+            __m512d max0 = _mm512_set1_pd(max), max1 = max0;
+
+            for (; i + 16 <= size; i += 16) {
+                const auto lhs = _mm512_loadu_pd(data + i);
+                const auto rhs = _mm512_loadu_pd(data + i + 8);
+                min0 = _mm512_min_pd(min0, lhs);
+                min1 = _mm512_min_pd(min1, rhs);
+                max0 = _mm512_max_pd(max0, lhs);
+                max1 = _mm512_max_pd(max1, rhs);
+            }
+
+            min = _mm512_reduce_min_pd(_mm512_min_pd(min0, min1));
+            max = _mm512_reduce_max_pd(_mm512_max_pd(max0, max1));
+        }
+
+        for (; i < size; i++) {
+            min = std::min(min, data[i]);
+            max = std::max(max, data[i]);
+        }
+    }
+
+    CRCPP_AVX512_TARGET void avx512_min_max_i32(const int32_t* data, size_t size, int32_t& min, int32_t& max) noexcept {
+        size_t i = 0;
+
+        if (size >= 32) {
+            __m512i min0 = _mm512_set1_epi32(min), min1 = min0;
+            __m512i max0 = _mm512_set1_epi32(max), max1 = max0;
+
+            for (; i + 32 <= size; i += 32) {
+                const auto lhs = _mm512_loadu_si512(data + i);
+                const auto rhs = _mm512_loadu_si512(data + i + 16);
+                min0 = _mm512_min_epi32(min0, lhs);
+                min1 = _mm512_min_epi32(min1, rhs);
+                max0 = _mm512_max_epi32(max0, lhs);
+                max1 = _mm512_max_epi32(max1, rhs);
+            }
+
+            min = _mm512_reduce_min_epi32(_mm512_min_epi32(min0, min1));
+            max = _mm512_reduce_max_epi32(_mm512_max_epi32(max0, max1));
+        }
+
+        for (; i < size; i++) {
+            min = std::min(min, data[i]);
+            max = std::max(max, data[i]);
+        }
+    }
+
+    CRCPP_AVX512_TARGET double avx512_dot_f32(const float* lhs, const float* rhs, size_t size) noexcept {
+        __m512d acc0 = _mm512_setzero_pd(), acc1 = _mm512_setzero_pd(), acc2 = _mm512_setzero_pd(), acc3 = _mm512_setzero_pd();
+        size_t i = 0;
+
+        for (; i + 32 <= size; i += 32) {
+            acc0 = _mm512_fmadd_pd(_mm512_cvtps_pd(_mm256_loadu_ps(lhs + i)), _mm512_cvtps_pd(_mm256_loadu_ps(rhs + i)), acc0);
+            acc1 = _mm512_fmadd_pd(_mm512_cvtps_pd(_mm256_loadu_ps(lhs + i + 8)),
+                                   _mm512_cvtps_pd(_mm256_loadu_ps(rhs + i + 8)),
+                                   acc1);
+            acc2 = _mm512_fmadd_pd(_mm512_cvtps_pd(_mm256_loadu_ps(lhs + i + 16)),
+                                   _mm512_cvtps_pd(_mm256_loadu_ps(rhs + i + 16)),
+                                   acc2);
+            acc3 = _mm512_fmadd_pd(_mm512_cvtps_pd(_mm256_loadu_ps(lhs + i + 24)),
+                                   _mm512_cvtps_pd(_mm256_loadu_ps(rhs + i + 24)),
+                                   acc3);
+        }
+
+        auto result = _mm512_reduce_add_pd(_mm512_add_pd(_mm512_add_pd(acc0, acc1), _mm512_add_pd(acc2, acc3)));
+        for (; i < size; i++) {
+            result += static_cast<double>(lhs[i]) * static_cast<double>(rhs[i]);
+        }
+
+        return result;
+    }
+
+    CRCPP_AVX512_TARGET double avx512_dot_f64(const double* lhs, const double* rhs, size_t size) noexcept {
+        __m512d acc0 = _mm512_setzero_pd(), acc1 = _mm512_setzero_pd(), acc2 = _mm512_setzero_pd(), acc3 = _mm512_setzero_pd();
+        size_t i = 0;
+
+        for (; i + 32 <= size; i += 32) {
+            acc0 = _mm512_fmadd_pd(_mm512_loadu_pd(lhs + i), _mm512_loadu_pd(rhs + i), acc0);
+            acc1 = _mm512_fmadd_pd(_mm512_loadu_pd(lhs + i + 8), _mm512_loadu_pd(rhs + i + 8), acc1);
+            acc2 = _mm512_fmadd_pd(_mm512_loadu_pd(lhs + i + 16), _mm512_loadu_pd(rhs + i + 16), acc2);
+            acc3 = _mm512_fmadd_pd(_mm512_loadu_pd(lhs + i + 24), _mm512_loadu_pd(rhs + i + 24), acc3);
+        }
+
+        auto result = _mm512_reduce_add_pd(_mm512_add_pd(_mm512_add_pd(acc0, acc1), _mm512_add_pd(acc2, acc3)));
+        for (; i < size; i++) {
+            result += lhs[i] * rhs[i];
+        }
+
+        return result;
+    }
+
+    CRCPP_AVX512_TARGET void
+    avx512_histogram_f32(const float* data, size_t size, float low, float high, float scale, uint64_t* bins, size_t bin_count) noexcept {
+        const auto low_vector = _mm512_set1_ps(low);
+        const auto high_vector = _mm512_set1_ps(high);
+        const auto scale_vector = _mm512_set1_ps(scale);
+        const auto last_bin = _mm512_set1_ps(static_cast<float>(bin_count - 1));
+        const auto first_bin = _mm512_setzero_ps();
+        size_t i = 0;
+
+        for (; i + 16 <= size; i += 16) {
+            const auto values = _mm512_loadu_ps(data + i);
+            const auto at_least_low = _mm512_cmp_ps_mask(values, low_vector, _CMP_GE_OQ);
+            const auto in_range = at_least_low & _mm512_cmp_ps_mask(values, high_vector, _CMP_LT_OQ);
+            const auto positions = _mm512_mul_ps(_mm512_sub_ps(values, low_vector), scale_vector);
+
+            // clamped before the conversion: _mm512_max_ps returns its second operand for a NaN position
+            const auto clamped = _mm512_min_ps(_mm512_max_ps(positions, first_bin), last_bin);
+
+            alignas(64) int32_t indices[16];
+            _mm512_store_si512(indices, _mm512_cvttps_epi32(clamped));
+
+            for (auto mask = static_cast<unsigned>(in_range); mask != 0; mask &= mask - 1) {
+                ++bins[indices[std::countr_zero(mask)]];
+            }
+        }
+
+        for (; i < size; i++) {
+            const auto value = data[i];
+            if (value >= low && value < high) {
+                ++bins[concurrencpp::details::histogram_bin((value - low) * scale, bin_count)];
+            }
+        }
+    }
+}  // namespace
+
+const numeric_kernels& concurrencpp::details::avx2_numeric_kernels() noexcept {
+    static constexpr numeric_kernels kernels {instruction_set::avx2,
+                                              avx2_sum_f32,
+                                              avx2_sum_f64,
+                                              avx2_sum_i32,
+                                              avx2_min_max_f32,
+                                              avx2_min_max_f64,
+                                              avx2_min_max_i32,
+                                              avx2_dot_f32,
+                                              avx2_dot_f64,
+                                              avx2_histogram_f32,
+                                              scalar_histogram_i32};
+    return kernels;
+}
+
+const numeric_kernels& concurrencpp::details::avx512_numeric_kernels() noexcept {
+    static constexpr numeric_kernels kernels {instruction_set::avx512,
+                                              avx512_sum_f32,
+                                              avx512_sum_f64,
+                                              avx512_sum_i32,
+                                              avx512_min_max_f32,
+                                              avx512_min_max_f64,
+                                              avx512_min_max_i32,
+                                              avx512_dot_f32,
+                                              avx512_dot_f64,
+                                              avx512_histogram_f32,
+                                              scalar_histogram_i32};
+    return kernels;
+}
+
+#endif
@@ -0,0 +1,269 @@
+#include "concurrencpp/algorithms/numeric.h"
+#include "concurrencpp/algorithms/constants.h"
+#include "concurrencpp/algorithms/impl/lazy_split.h"
+#include "concurrencpp/algorithms/impl/numeric_kernels.h"
+#include "concurrencpp/executors/thread_pool_executor.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+
+using concurrencpp::thread_pool_executor;
+using concurrencpp::numeric::instruction_set;
+using concurrencpp::numeric::min_max_result;
+
+namespace {
+    void throw_if_null(const std::shared_ptr<thread_pool_executor>& executor, const char* error_message) {
+        if (!static_cast<bool>(executor)) {
+            throw std::invalid_argument(error_message);
+        }
+    }
+
+    /*
+        Splits [0, size) to blocks of k_numeric_block_bytes and reduces chunks of whole blocks in parallel.
+        A chunk is a contiguous run of whole blocks, so every kernel call streams through memory in order and a chunk is
+        big enough for the hardware prefetcher to keep up. kernel(first, last) returns the partial value of [first, last).
+    */
+    template<class element_type, class value_type, class kernel_type, class combine_type>
+    value_type reduce_blocks(thread_pool_executor& executor,
+                             size_t size,
+                             value_type identity,
+                             kernel_type kernel,
+                             combine_type combine,
+                             size_t min_chunk_size = 0) {
+        if (size == 0) {
+            return identity;
+        }
+
+        constexpr size_t block_size = concurrencpp::details::consts::k_numeric_block_bytes / sizeof(element_type);
+        const auto block_count = (size + block_size - 1) / block_size;
+        const auto grain_size = std::max(concurrencpp::details::range_grain_size(block_count, executor, 0),
+                                         (min_chunk_size + block_size - 1) / block_size);
+
+        auto body = [&kernel, size](size_t first_block, size_t last_block) {
+            const auto first = first_block * block_size;
+            return kernel(first, std::min(last_block * block_size, size));
+        };
+
+        return concurrencpp::details::lazy_split_run<size_t, value_type>(executor, size_t(0), block_count, grain_size, body, combine);
+    }
+
+    template<class type>
+    min_max_result<type> min_max_impl(thread_pool_executor& executor,
+                                      std::span<const type> values,
+                                      void (*kernel)(const type*, size_t, type&, type&) noexcept) {
+        const min_max_result<type> identity {std::numeric_limits<type>::max(), std::numeric_limits<type>::lowest()};
+
+        return reduce_blocks<type>(
+            executor,
+            values.size(),
+            identity,
+            [values, kernel, identity](size_t first, size_t last) {
+                auto partial = identity;
+                kernel(values.data() + first, last - first, partial.min, partial.max);
+                return partial;
+            },
+            [](const min_max_result<type>& lhs, const min_max_result<type>& rhs) {
+                return min_max_result<type> {std::min(lhs.min, rhs.min), std::max(lhs.max, rhs.max)};
+            });
+    }
+
+    template<class type, class kernel_type>
+    void histogram_impl(thread_pool_executor& executor, std::span<const type> values, std::span<uint64_t> bins, kernel_type kernel) {
+        using histogram_type = std::vector<uint64_t>;
+
+        const auto bin_count = bins.size();
+        auto counts = reduce_blocks<type>(
+            executor,
+            values.size(),
+            histogram_type(bin_count),
+            [values, bin_count, &kernel](size_t first, size_t last) {
+                histogram_type partial(bin_count);
+                kernel(values.data() + first, last - first, partial.data(), bin_count);
+                return partial;
+            },
+            [](histogram_type lhs, const histogram_type& rhs) {
+                std::transform(lhs.begin(), lhs.end(), rhs.begin(), lhs.begin(), std::plus<> {});
+                return lhs;
+            },
+            bin_count * concurrencpp::details::consts::k_numeric_histogram_elements_per_bin);  // merging stays cheap next to counting
+
+        std::copy(counts.begin(), counts.end(), bins.begin());
+    }
+
+    void check_histogram_bins(std::span<uint64_t> bins) {
+        if (bins.empty() || bins.size() > concurrencpp::details::consts::k_numeric_histogram_max_bins) {
+            throw std::invalid_argument(concurrencpp::details::consts::k_numeric_histogram_bin_count_err_msg);
+        }
+    }
+}  // namespace
+
+instruction_set concurrencpp::numeric::active_instruction_set() noexcept {
+    return details::active_numeric_kernels().isa;
+}
+
+const char* concurrencpp::numeric::instruction_set_name(instruction_set isa) noexcept {
+    switch (isa) {
+        case instruction_set::scalar: {
+            return "scalar";
+        }
+        case instruction_set::neon: {
+            return "neon";
+        }
+        case instruction_set::avx2: {
+            return "avx2";
+        }
+        case instruction_set::avx512: {
+            return "avx512";
+        }
+    }
+
+    return "unknown";
+}
+
+double concurrencpp::numeric::sum(const std::shared_ptr<thread_pool_executor>& executor, std::span<const float> values) {
+    throw_if_null(executor, details::consts::k_numeric_sum_null_executor_err_msg);
+
+    const auto kernel = details::active_numeric_kernels().sum_f32;
+    return reduce_blocks<float>(
+        *executor,
+        values.size(),
+        0.0,
+        [values, kernel](size_t first, size_t last) {
+            return kernel(values.data() + first, last - first);
+        },
+        std::plus<> {});
+}
+
+double concurrencpp::numeric::sum(const std::shared_ptr<thread_pool_executor>& executor, std::span<const double> values) {
+    throw_if_null(executor, details::consts::k_numeric_sum_null_executor_err_msg);
+
+    const auto kernel = details::active_numeric_kernels().sum_f64;
+    return reduce_blocks<double>(
+        *executor,
+        values.size(),
+        0.0,
+        [values, kernel](size_t first, size_t last) {
+            return kernel(values.data() + first, last - first);
+        },
+        std::plus<> {});
+}
+
+int64_t concurrencpp::numeric::sum(const std::shared_ptr<thread_pool_executor>& executor, std::span<const int32_t> values) {
+    throw_if_null(executor, details::consts::k_numeric_sum_null_executor_err_msg);
+
+    const auto kernel = details::active_numeric_kernels().sum_i32;
+    return reduce_blocks<int32_t>(
+        *executor,
+        values.size(),
+        int64_t(0),
+        [values, kernel](size_t first, size_t last) {
+            return kernel(values.data() + first, last - first);
+        },
+        std::plus<> {});
+}
+
+min_max_result<float> concurrencpp::numeric::min_max(const std::shared_ptr<thread_pool_executor>& executor,
+                                                     std::span<const float> values) {
+    throw_if_null(executor, details::consts::k_numeric_min_max_null_executor_err_msg);
+    return min_max_impl(*executor, values, details::active_numeric_kernels().min_max_f32);
+}
+
+min_max_result<double> concurrencpp::numeric::min_max(const std::shared_ptr<thread_pool_executor>& executor,
+                                                      std::span<const double> values) {
+    throw_if_null(executor, details::consts::k_numeric_min_max_null_executor_err_msg);
+    return min_max_impl(*executor, values, details::active_numeric_kernels().min_max_f64);
+}
+
+min_max_result<int32_t> concurrencpp::numeric::min_max(const std::shared_ptr<thread_pool_executor>& executor,
+                                                       std::span<const int32_t> values) {
+    throw_if_null(executor, details::consts::k_numeric_min_max_null_executor_err_msg);
+    return min_max_impl(*executor, values, details::active_numeric_kernels().min_max_i32);
+}
+
+double concurrencpp::numeric::dot(const std::shared_ptr<thread_pool_executor>& executor,
+                                  std::span<const float> lhs,
+                                  std::span<const float> rhs) {
+    throw_if_null(executor, details::consts::k_numeric_dot_null_executor_err_msg);
+
+    if (lhs.size() != rhs.size()) {
+        throw std::invalid_argument(details::consts::k_numeric_dot_size_mismatch_err_msg);
+    }
+
+    const auto kernel = details::active_numeric_kernels().dot_f32;
+    return reduce_blocks<float>(
+        *executor,
+        lhs.size(),
+        0.0,
+        [lhs, rhs, kernel](size_t first, size_t last) {
+            return kernel(lhs.data() + first, rhs.data() + first, last - first);
+        },
+        std::plus<> {});
+}
+
+double concurrencpp::numeric::dot(const std::shared_ptr<thread_pool_executor>& executor,
+                                  std::span<const double> lhs,
+                                  std::span<const double> rhs) {
+    throw_if_null(executor, details::consts::k_numeric_dot_null_executor_err_msg);
+
+    if (lhs.size() != rhs.size()) {
+        throw std::invalid_argument(details::consts::k_numeric_dot_size_mismatch_err_msg);
+    }
+
+    const auto kernel = details::active_numeric_kernels().dot_f64;
+    return reduce_blocks<double>(
+        *executor,
+        lhs.size(),
+        0.0,
+        [lhs, rhs, kernel](size_t first, size_t last) {
+            return kernel(lhs.data() + first, rhs.data() + first, last - first);
+        },
+        std::plus<> {});
+}
+
+void concurrencpp::numeric::histogram(const std::shared_ptr<thread_pool_executor>& executor,
+                                      std::span<const float> values,
+                                      float low,
+                                      float high,
+                                      std::span<uint64_t> bins) {
+    throw_if_null(executor, details::consts::k_numeric_histogram_null_executor_err_msg);
+    check_histogram_bins(bins);
+
+    if (!(low < high)) {
+        throw std::invalid_argument(details::consts::k_numeric_histogram_range_err_msg);
+    }
+
+    // a range wider than FLT_MAX, or too narrow for bins.size() bins, makes the positions infinite or NaN
+    const auto width = high - low;
+    const auto scale = static_cast<float>(bins.size()) / width;
+    if (!std::isfinite(width) || !std::isfinite(scale)) {
+        throw std::invalid_argument(details::consts::k_numeric_histogram_scale_err_msg);
+    }
+
+    const auto kernel = details::active_numeric_kernels().histogram_f32;
+
+    histogram_impl(*executor, values, bins, [kernel, low, high, scale](const float* data, size_t size, uint64_t* counts, size_t count) {
+        kernel(data, size, low, high, scale, counts, count);
+    });
+}
+
+void concurrencpp::numeric::histogram(const std::shared_ptr<thread_pool_executor>& executor,
+                                      std::span<const int32_t> values,
+                                      int32_t low,
+                                      int32_t high,
+                                      std::span<uint64_t> bins) {
+    throw_if_null(executor, details::consts::k_numeric_histogram_null_executor_err_msg);
+    check_histogram_bins(bins);
+
+    if (!(low < high)) {
+        throw std::invalid_argument(details::consts::k_numeric_histogram_range_err_msg);
+    }
+
+    const auto kernel = details::active_numeric_kernels().histogram_i32;
+    histogram_impl(*executor, values, bins, [kernel, low, high](const int32_t* data, size_t size, uint64_t* counts, size_t count) {
+        kernel(data, size, low, high, counts, count);
+    });
+}
@@ -0,0 +1,309 @@
+#include "concurrencpp/task.h"
+#include "concurrencpp/errors.h"
+#include "concurrencpp/algorithms/constants.h"
+#include "concurrencpp/algorithms/task_graph.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/results/make_result.h"
+
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+
+using concurrencpp::task_graph;
+
+namespace {
+    constexpr auto k_no_node = std::numeric_limits<task_graph::node_id>::max();
+}  // namespace
+
+/*
+    task_graph::node_task
+*/
+
+class task_graph::node_task {
+
+   private:
+    task_graph* m_graph;
+    node_id m_node;
+
+   public:
+    node_task(task_graph& graph, node_id node) noexcept : m_graph(&graph), m_node(node) {}
+
+    node_task(node_task&& rhs) noexcept : m_graph(std::exchange(rhs.m_graph, nullptr)), m_node(rhs.m_node) {}
+
+    ~node_task() noexcept {
+        if (m_graph == nullptr) {
+            return;
+        }
+
+        // the task was destroyed without running, e.g. by the shutdown of the executor
+        const auto graph = std::exchange(m_graph, nullptr);
+        graph->fail(std::make_exception_ptr(errors::broken_task(details::consts::k_task_graph_broken_task_err_msg)));
+        graph->skip_nodes(m_node);
+    }
+
+    void operator()() noexcept {
+        const auto graph = std::exchange(m_graph, nullptr);
+        graph->run_nodes(m_node);
+    }
+};
+
+/*
+    task_graph
+*/
+
+task_graph::node_id task_graph::add_node_impl(std::unique_ptr<details::task_graph_callable> callable) {
+    throw_if_running();
+
+    m_callables.emplace_back(std::move(callable));
+    m_compiled = false;
+    return m_callables.size() - 1;
+}
+
+void task_graph::add_edge(node_id from, node_id to) {
+    throw_if_running();
+
+    if (from >= m_callables.size() || to >= m_callables.size()) {
+        throw std::invalid_argument(details::consts::k_task_graph_unknown_node_err_msg);
+    }
+
+    m_edges.emplace_back(from, to);
+    m_compiled = false;
+}
+
+size_t task_graph::size() const noexcept {
+    return m_callables.size();
+}
+
+size_t task_graph::edge_count() const noexcept {
+    return m_edges.size();
+}
+
+bool task_graph::running() const noexcept {
+    return m_running.load(std::memory_order_acquire);
+}
+
+void task_graph::throw_if_running() const {
+    if (running()) {
+        throw std::system_error(static_cast<int>(std::errc::operation_not_permitted),
+                                std::system_category(),
+                                details::consts::k_task_graph_running_err_msg);
+    }
+}
+
+void task_graph::compile() {
+    if (m_compiled) {
+        return;
+    }
+
+    const auto node_count = m_callables.size();
+    std::vector<size_t> successor_offsets(node_count + 1, 0);
+    std::vector<node_id> successors(m_edges.size());
+    std::vector<size_t> in_degrees(node_count, 0);
+
+    for (const auto& edge : m_edges) {
+        ++successor_offsets[edge.first + 1];
+        ++in_degrees[edge.second];
+    }
+
+    for (size_t i = 0; i < node_count; i++) {
+        successor_offsets[i + 1] += successor_offsets[i];
+    }
+
+    std::vector<size_t> positions(successor_offsets.begin(), successor_offsets.end() - 1);
+    for (const auto& edge : m_edges) {
+        successors[positions[edge.first]++] = edge.second;
+    }
+
+    std::vector<node_id> roots;
+    for (size_t i = 0; i < node_count; i++) {
+        if (in_degrees[i] == 0) {
+            roots.emplace_back(i);
+        }
+    }
+
+    // Kahn's algorithm: every node is reached from the roots only if no edge closes a cycle
+    auto pending = in_degrees;
+    auto ready = roots;
+    size_t visited = 0;
+
+    while (!ready.empty()) {
+        const auto node = ready.back();
+        ready.pop_back();
+        ++visited;
+
+        for (auto i = successor_offsets[node]; i < successor_offsets[node + 1]; i++) {
+            if (--pending[successors[i]] == 0) {
+                ready.emplace_back(successors[i]);
+            }
+        }
+    }
+
+    if (visited != node_count) {
+        throw std::invalid_argument(details::consts::k_task_graph_cycle_err_msg);
+    }
+
+    m_pending = std::make_unique<std::atomic_size_t[]>(node_count);
+    m_skip_links.assign(node_count, k_no_node);
+    m_successor_offsets = std::move(successor_offsets);
+    m_successors = std::move(successors);
+    m_in_degrees = std::move(in_degrees);
+    m_roots = std::move(roots);
+    m_compiled = true;
+}
+
+concurrencpp::result<void> task_graph::run(std::shared_ptr<executor> executor) {
+    if (!static_cast<bool>(executor)) {
+        throw std::invalid_argument(details::consts::k_task_graph_null_executor_err_msg);
+    }
+
+    if (m_running.exchange(true, std::memory_order_acq_rel)) {
+        throw std::system_error(static_cast<int>(std::errc::operation_not_permitted),
+                                std::system_category(),
+                                details::consts::k_task_graph_running_err_msg);
+    }
+
+    try {
+        compile();
+
+        if (m_callables.empty()) {
+            m_running.store(false, std::memory_order_release);
+            return make_ready_result<void>();
+        }
+
+        m_promise.emplace();
+    } catch (...) {
+        m_running.store(false, std::memory_order_release);
+        throw;
+    }
+
+    const auto node_count = m_callables.size();
+    for (size_t i = 0; i < node_count; i++) {
+        m_pending[i].store(m_in_degrees[i], std::memory_order_relaxed);
+    }
+
+    // one more than the nodes: the run can't complete, and the graph can't go away, before every root is enqueued
+    m_remaining.store(node_count + 1, std::memory_order_relaxed);
+    m_failed.store(false, std::memory_order_relaxed);
+    m_exception = nullptr;
+    m_executor = std::move(executor);
+
+    auto result = m_promise->get_result();
+
+    for (const auto root : m_roots) {
+        schedule(root);
+    }
+
+    if (finish_node()) {
+        complete_run();
+    }
+
+    return result;
+}
+
+void task_graph::schedule(node_id node) noexcept {
+    try {
+        m_executor->enqueue(concurrencpp::task(node_task(*this, node)));
+    } catch (...) {
+        // the executor is shut down, the task skipped the node and its successors when it was destroyed
+    }
+}
+
+void task_graph::run_nodes(node_id node) noexcept {
+    while (true) {
+        if (m_failed.load(std::memory_order_acquire)) {
+            skip_nodes(node);
+            return;
+        }
+
+        try {
+            m_callables[node]->invoke();
+        } catch (...) {
+            fail(std::current_exception());
+            skip_nodes(node);
+            return;
+        }
+
+        // the first released successor continues on this thread, the rest are enqueued
+        auto next = k_no_node;
+        const auto has_next = release_successors(node, next);
+
+        if (finish_node()) {
+            complete_run();
+            return;
+        }
+
+        if (!has_next) {
+            return;
+        }
+
+        node = next;
+    }
+}
+
+bool task_graph::release_successors(node_id node, node_id& next) noexcept {
+    bool has_next = false;
+
+    for (auto i = m_successor_offsets[node]; i < m_successor_offsets[node + 1]; i++) {
+        const auto successor = m_successors[i];
+        if (m_pending[successor].fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            continue;
+        }
+
+        if (!has_next) {
+            next = successor;
+            has_next = true;
+        } else {
+            schedule(successor);
+        }
+    }
+
+    return has_next;
+}
+
+void task_graph::skip_nodes(node_id node) noexcept {
+    // every node is released by exactly one thread, so its link is written by that thread alone
+    auto head = node;
+    m_skip_links[node] = k_no_node;
+
+    while (head != k_no_node) {
+        const auto current = head;
+        head = m_skip_links[current];
+
+        for (auto i = m_successor_offsets[current]; i < m_successor_offsets[current + 1]; i++) {
+            const auto successor = m_successors[i];
+            if (m_pending[successor].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                m_skip_links[successor] = head;
+                head = successor;
+            }
+        }
+
+        if (finish_node()) {
+            complete_run();
+            return;
+        }
+    }
+}
+
+bool task_graph::finish_node() noexcept {
+    return m_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1;
+}
+
+void task_graph::fail(std::exception_ptr exception) noexcept {
+    if (!m_failed.exchange(true, std::memory_order_acq_rel)) {
+        m_exception = std::move(exception);
+    }
+}
+
+void task_graph::complete_run() noexcept {
+    // nothing of the graph is touched once it stops running, the consumer of the result may destroy it right away
+    auto promise = std::move(*m_promise);
+    auto exception = std::move(m_exception);
+    m_promise.reset();
+    m_running.store(false, std::memory_order_release);
+
+    if (static_cast<bool>(exception)) {
+        promise.set_exception(std::move(exception));
+    } else {
+        promise.set_result();
+    }
+}
@@ -0,0 +1,151 @@
+#include "concurrencpp/executors/constants.h"
+#include "concurrencpp/executors/busy_poll_executor.h"
+
+namespace concurrencpp::details {
+    static thread_local busy_poll_executor* s_tl_this_busy_poller = nullptr;
+}  // namespace concurrencpp::details
+
+using concurrencpp::busy_poll_executor;
+
+busy_poll_executor::busy_poll_executor(std::optional<size_t> core,
+                                       std::chrono::nanoseconds low_power_spin_after,
+                                       const std::function<void(std::string_view thread_name)>& thread_started_callback,
+                                       const std::function<void(std::string_view thread_name)>& thread_terminated_callback) :
+    derivable_executor<concurrencpp::busy_poll_executor>(details::consts::k_busy_poll_executor_name),
+    m_private_atomic_abort(false), m_atomic_abort(false), m_pinned(false), m_core(core), m_low_power_spin_after(low_power_spin_after) {
+    m_thread = details::thread(
+        details::make_executor_worker_name(name),
+        [this] {
+            work_loop();
+        },
+        thread_started_callback,
+        thread_terminated_callback);
+}
+
+busy_poll_executor::~busy_poll_executor() noexcept {
+    shutdown();  // the thread polls this object, it can't outlive it
+}
+
+bool busy_poll_executor::drain_queue() {
+    m_public_queue.pop_all(m_private_queue);
+
+    while (!m_private_queue.empty()) {
+        auto task = std::move(m_private_queue.front());
+        m_private_queue.pop_front();
+
+        if (m_private_atomic_abort.load(std::memory_order_relaxed)) {
+            return false;
+        }
+
+        task();
+    }
+
+    return true;
+}
+
+void busy_poll_executor::work_loop() {
+    details::s_tl_this_busy_poller = this;
+
+    if (m_core.has_value()) {
+        m_pinned.store(details::thread::pin_current_to_core(*m_core), std::memory_order_relaxed);
+    }
+
+    using clock_type = std::chrono::steady_clock;
+    auto idle_since = clock_type::now();
+    bool low_power = false;
+    size_t idle_polls = 0;
+
+    while (!m_atomic_abort.load(std::memory_order_relaxed)) {
+        if (!m_public_queue.empty()) {
+            if (!drain_queue()) {
+                return;
+            }
+
+            idle_since = clock_type::now();
+            low_power = false;
+            idle_polls = 0;
+            continue;
+        }
+
+        if (low_power) {
+            details::thread::cpu_relax();
+            continue;
+        }
+
+        // reading the clock on every poll would slow the polling down, check it every now and then.
+        if ((++idle_polls % details::consts::k_busy_poll_executor_clock_check_interval) == 0) {
+            low_power = (clock_type::now() - idle_since) >= m_low_power_spin_after;
+        }
+    }
+}
+
+void busy_poll_executor::enqueue(concurrencpp::task task) {
+    if (details::s_tl_this_busy_poller == this) {
+        if (m_private_atomic_abort.load(std::memory_order_relaxed)) {
+            details::throw_runtime_shutdown_exception(name);
+        }
+
+        m_private_queue.emplace_back(std::move(task));
+        return;
+    }
+
+    if (m_atomic_abort.load(std::memory_order_relaxed)) {
+        details::throw_runtime_shutdown_exception(name);
+    }
+
+    m_public_queue.push(task);
+}
+
+void busy_poll_executor::enqueue(std::span<concurrencpp::task> tasks) {
+    if (details::s_tl_this_busy_poller == this) {
+        if (m_private_atomic_abort.load(std::memory_order_relaxed)) {
+            details::throw_runtime_shutdown_exception(name);
+        }
+
+        m_private_queue.insert(m_private_queue.end(), std::make_move_iterator(tasks.begin()), std::make_move_iterator(tasks.end()));
+        return;
+    }
+
+    if (m_atomic_abort.load(std::memory_order_relaxed)) {
+        details::throw_runtime_shutdown_exception(name);
+    }
+
+    m_public_queue.push(tasks);
+}
+
+int busy_poll_executor::max_concurrency_level() const noexcept {
+    return details::consts::k_busy_poll_executor_max_concurrency_level;
+}
+
+bool busy_poll_executor::shutdown_requested() const {
+    return m_atomic_abort.load(std::memory_order_relaxed);
+}
+
+void busy_poll_executor::shutdown() {
+    const auto abort = m_atomic_abort.exchange(true, std::memory_order_relaxed);
+    if (abort) {
+        return;  // shutdown had been called before.
+    }
+
+    m_private_atomic_abort.store(true, std::memory_order_relaxed);
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    auto private_queue = std::move(m_private_queue);
+    private_queue.clear();
+    m_public_queue.clear();
+}
+
+std::optional<size_t> busy_poll_executor::core() const noexcept {
+    return m_core;
+}
+
+bool busy_poll_executor::pinned() const noexcept {
+    return m_pinned.load(std::memory_order_relaxed);
+}
+
+std::chrono::nanoseconds busy_poll_executor::low_power_spin_after() const noexcept {
+    return m_low_power_spin_after;
+}
@@ -0,0 +1,102 @@
+#include "concurrencpp/executors/impl/keyed_lane_table.h"
+
+#include <thread>
+
+#include <cassert>
+#include <cstdint>
+
+using concurrencpp::details::keyed_lane_table;
+using concurrencpp::details::keyed_lane_ticket;
+
+keyed_lane_table::keyed_lane_table(size_t lane_count, size_t buckets_per_lane) :
+    m_lane_count(lane_count), m_buckets(std::make_unique<bucket[]>(lane_count * buckets_per_lane)),
+    m_bucket_count(lane_count * buckets_per_lane), m_lanes(std::make_unique<lane[]>(lane_count)) {
+    assert(lane_count != 0);
+    assert(buckets_per_lane != 0);
+
+    // buckets start out spread evenly over the lanes
+    for (size_t i = 0; i < m_bucket_count; i++) {
+        m_buckets[i].lane.store(i % m_lane_count, std::memory_order_relaxed);
+    }
+}
+
+size_t keyed_lane_table::bucket_of(size_t hash) const noexcept {
+    // std::hash is the identity for integers on most implementations, mix the bits so sequential keys spread out.
+    uint64_t mixed = hash;
+    mixed ^= mixed >> 33;
+    mixed *= 0xff51afd7ed558ccdULL;
+    mixed ^= mixed >> 33;
+    return static_cast<size_t>(mixed % m_bucket_count);
+}
+
+size_t keyed_lane_table::lane_of_bucket(size_t bucket_index) const noexcept {
+    assert(bucket_index < m_bucket_count);
+    return m_buckets[bucket_index].lane.load(std::memory_order_acquire);
+}
+
+size_t keyed_lane_table::lane_depth(size_t lane_index) const noexcept {
+    assert(lane_index < m_lane_count);
+    return m_lanes[lane_index].depth.load(std::memory_order_relaxed);
+}
+
+size_t keyed_lane_table::acquire(size_t bucket_index) noexcept {
+    assert(bucket_index < m_bucket_count);
+    auto& bucket = m_buckets[bucket_index];
+
+    auto state = bucket.state.fetch_add(1, std::memory_order_acq_rel);
+    while ((state & k_migrating_bit) != 0) {
+        std::this_thread::yield();  // the migration is a single store, it's over in no time.
+        state = bucket.state.load(std::memory_order_acquire);
+    }
+
+    bucket.load.fetch_add(1, std::memory_order_relaxed);
+
+    const auto lane_index = bucket.lane.load(std::memory_order_relaxed);
+    m_lanes[lane_index].depth.fetch_add(1, std::memory_order_relaxed);
+    return lane_index;
+}
+
+void keyed_lane_table::release(size_t bucket_index, size_t lane_index) noexcept {
+    assert(bucket_index < m_bucket_count);
+    assert(lane_index < m_lane_count);
+
+    m_lanes[lane_index].depth.fetch_sub(1, std::memory_order_relaxed);
+    m_buckets[bucket_index].state.fetch_sub(1, std::memory_order_release);
+}
+
+bool keyed_lane_table::try_migrate(size_t bucket_index, size_t lane_index) noexcept {
+    assert(bucket_index < m_bucket_count);
+    assert(lane_index < m_lane_count);
+    auto& bucket = m_buckets[bucket_index];
+
+    size_t expected = 0;
+    if (!bucket.state.compare_exchange_strong(expected, k_migrating_bit, std::memory_order_acquire, std::memory_order_relaxed)) {
+        return false;
+    }
+
+    bucket.lane.store(lane_index, std::memory_order_relaxed);
+
+    // producers that arrived meanwhile have added their tasks to the state, only the bit is cleared.
+    bucket.state.fetch_sub(k_migrating_bit, std::memory_order_release);
+    return true;
+}
+
+std::vector<size_t> keyed_lane_table::take_loads() {
+    std::vector<size_t> loads(m_bucket_count);
+    for (size_t i = 0; i < m_bucket_count; i++) {
+        loads[i] = m_buckets[i].load.exchange(0, std::memory_order_relaxed);
+    }
+
+    return loads;
+}
+
+keyed_lane_ticket::keyed_lane_ticket(std::shared_ptr<keyed_lane_table> table, size_t bucket_index) noexcept :
+    m_table(std::move(table)), m_bucket_index(bucket_index) {
+    m_lane_index = m_table->acquire(bucket_index);
+}
+
+keyed_lane_ticket::~keyed_lane_ticket() noexcept {
+    if (static_cast<bool>(m_table)) {
+        m_table->release(m_bucket_index, m_lane_index);
+    }
+}
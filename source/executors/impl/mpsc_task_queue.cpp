@@ -0,0 +1,111 @@
+#include "concurrencpp/executors/impl/mpsc_task_queue.h"
+
+#include <memory>
+
+#include <cassert>
+
+using concurrencpp::details::mpsc_task_queue;
+
+mpsc_task_queue::~mpsc_task_queue() noexcept {
+    clear();
+}
+
+void mpsc_task_queue::delete_chain(node* head) noexcept {
+    while (head != nullptr) {
+        const auto next = head->next;
+        delete head;
+        head = next;
+    }
+}
+
+void mpsc_task_queue::push_chain(node* first, node* last) noexcept {
+    assert(first != nullptr);
+    assert(last != nullptr);
+
+    auto head = m_head.load(std::memory_order_relaxed);
+    do {
+        last->next = head;
+    } while (!m_head.compare_exchange_weak(head, first, std::memory_order_seq_cst, std::memory_order_relaxed));
+}
+
+void mpsc_task_queue::push(task& task) {
+    auto new_node = std::make_unique<node>();
+    new_node->value = std::move(task);
+    push_chain(new_node.get(), new_node.get());
+    new_node.release();
+}
+
+void mpsc_task_queue::push(std::span<task> tasks) {
+    if (tasks.empty()) {
+        return;
+    }
+
+    // the stack is popped in reverse, so the chain is linked last task first.
+    node* first = nullptr;
+    node* last = nullptr;
+
+    try {
+        for (size_t i = 0; i < tasks.size(); i++) {
+            const auto new_node = new node();
+            new_node->next = first;
+            first = new_node;
+
+            if (last == nullptr) {
+                last = new_node;
+            }
+        }
+    } catch (...) {
+        delete_chain(first);
+        throw;
+    }
+
+    auto cursor = first;
+    for (size_t i = tasks.size(); i != 0; i--) {
+        cursor->value = std::move(tasks[i - 1]);
+        cursor = cursor->next;
+    }
+
+    push_chain(first, last);
+}
+
+bool mpsc_task_queue::empty() const noexcept {
+    return m_head.load(std::memory_order_seq_cst) == nullptr;
+}
+
+size_t mpsc_task_queue::pop_all(std::deque<task>& queue) {
+    auto head = m_head.exchange(nullptr, std::memory_order_seq_cst);
+    if (head == nullptr) {
+        return 0;
+    }
+
+    // reverse the stack into push order
+    node* reversed = nullptr;
+    while (head != nullptr) {
+        const auto next = head->next;
+        head->next = reversed;
+        reversed = head;
+        head = next;
+    }
+
+    size_t count = 0;
+    while (reversed != nullptr) {
+        std::unique_ptr<node> current(reversed);
+        reversed = reversed->next;
+
+        try {
+            queue.emplace_back(std::move(current->value));
+        } catch (...) {
+            // the rest of the tasks are dropped, like the tasks of an executor that was shut down.
+            delete_chain(reversed);
+            throw;
+        }
+
+        ++count;
+    }
+
+    return count;
+}
+
+void mpsc_task_queue::clear() noexcept {
+    delete_chain(m_head.exchange(nullptr, std::memory_order_seq_cst));
+}
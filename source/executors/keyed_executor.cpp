@@ -0,0 +1,116 @@
+#include "concurrencpp/executors/constants.h"
+#include "concurrencpp/executors/keyed_executor.h"
+
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+
+using concurrencpp::keyed_executor;
+
+keyed_executor::keyed_executor(std::shared_ptr<executor> underlying_executor, size_t lane_count, size_t max_batch_size) :
+    m_underlying_executor(std::move(underlying_executor)),
+    m_table(std::make_shared<details::keyed_lane_table>(std::max<size_t>(lane_count, 1), details::consts::k_keyed_executor_buckets_per_lane)),
+    m_atomic_abort(false) {
+    if (!static_cast<bool>(m_underlying_executor)) {
+        throw std::invalid_argument(details::consts::k_keyed_executor_null_executor_err_msg);
+    }
+
+    if (lane_count == 0) {
+        throw std::invalid_argument(details::consts::k_keyed_executor_zero_lane_count_err_msg);
+    }
+
+    m_lanes.reserve(lane_count);
+    for (size_t i = 0; i < lane_count; i++) {
+        m_lanes.emplace_back(std::make_shared<strand_executor>(m_underlying_executor, max_batch_size));
+    }
+}
+
+keyed_executor::~keyed_executor() noexcept {
+    shutdown();
+}
+
+concurrencpp::details::keyed_lane_ticket keyed_executor::make_ticket(size_t bucket_index) const {
+    if (shutdown_requested()) {
+        details::throw_runtime_shutdown_exception(details::consts::k_keyed_executor_name);
+    }
+
+    return {m_table, bucket_index};
+}
+
+size_t keyed_executor::lane_count() const noexcept {
+    return m_lanes.size();
+}
+
+std::vector<size_t> keyed_executor::lane_depths() const {
+    std::vector<size_t> depths(m_lanes.size());
+    for (size_t i = 0; i < depths.size(); i++) {
+        depths[i] = m_table->lane_depth(i);
+    }
+
+    return depths;
+}
+
+size_t keyed_executor::rebalance() {
+    std::unique_lock<std::mutex> lock(m_rebalance_lock);
+
+    auto bucket_loads = m_table->take_loads();
+    std::vector<size_t> lane_loads(m_lanes.size(), 0);
+    for (size_t i = 0; i < bucket_loads.size(); i++) {
+        lane_loads[m_table->lane_of_bucket(i)] += bucket_loads[i];
+    }
+
+    // greedily move the busiest bucket of the heaviest lane that still narrows its gap to the lightest lane.
+    // every move lowers the spread of the loads, and a bucket that can't move is dropped, so this terminates.
+    size_t moved = 0;
+    while (true) {
+        const auto [lightest, heaviest] = std::minmax_element(lane_loads.begin(), lane_loads.end());
+        const auto gap = *heaviest - *lightest;
+        const auto heaviest_index = static_cast<size_t>(heaviest - lane_loads.begin());
+        const auto lightest_index = static_cast<size_t>(lightest - lane_loads.begin());
+
+        auto candidate = bucket_loads.size();
+        for (size_t i = 0; i < bucket_loads.size(); i++) {
+            if (bucket_loads[i] == 0 || bucket_loads[i] >= gap || m_table->lane_of_bucket(i) != heaviest_index) {
+                continue;
+            }
+
+            if (candidate == bucket_loads.size() || bucket_loads[i] > bucket_loads[candidate]) {
+                candidate = i;
+            }
+        }
+
+        if (candidate == bucket_loads.size()) {
+            break;
+        }
+
+        const auto load = std::exchange(bucket_loads[candidate], 0);
+        if (!m_table->try_migrate(candidate, lightest_index)) {
+            continue;  // the bucket has tasks in flight, it stays where it is.
+        }
+
+        lane_loads[heaviest_index] -= load;
+        lane_loads[lightest_index] += load;
+        ++moved;
+    }
+
+    return moved;
+}
+
+std::shared_ptr<concurrencpp::executor> keyed_executor::underlying_executor() const noexcept {
+    return m_underlying_executor;
+}
+
+void keyed_executor::shutdown() {
+    const auto abort = m_atomic_abort.exchange(true, std::memory_order_relaxed);
+    if (abort) {
+        return;  // shutdown had been called before.
+    }
+
+    for (auto& lane : m_lanes) {
+        lane->shutdown();
+    }
+}
+
+bool keyed_executor::shutdown_requested() const noexcept {
+    return m_atomic_abort.load(std::memory_order_relaxed);
+}
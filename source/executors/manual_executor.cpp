@@ -4,31 +4,143 @@
 using concurrencpp::manual_executor;
 
 manual_executor::manual_executor() :
-    derivable_executor<concurrencpp::manual_executor>(details::consts::k_manual_executor_name), m_abort(false), m_atomic_abort(false) {
+    derivable_executor<concurrencpp::manual_executor>(details::consts::k_manual_executor_name), m_abort(false), m_atomic_abort(false),
+    m_waiters(0) {}
+
+void manual_executor::notify_waiters() {
+    // a waiter registers itself before it checks for tasks, so either it sees the pushed tasks or we see the waiter.
+    if (m_waiters.load(std::memory_order_seq_cst) == 0) {
+        return;
+    }
+
+    // a waiter that has registered but hasn't blocked yet holds m_lock, this makes sure it won't miss the notification.
+    {
+        std::unique_lock<decltype(m_lock)> lock(m_lock);
+    }
+
+    m_condition.notify_all();
 }
 
-void manual_executor::enqueue(concurrencpp::task task) {
+size_t manual_executor::collect_tasks() const {
+    m_pushed_tasks.pop_all(m_tasks);
+    return m_tasks.size();
+}
+
+void manual_executor::take_batch(std::deque<task>& batch, size_t max_count) {
+    assert(batch.empty());
+    assert(!m_tasks.empty());
+
+    if (m_tasks.size() <= max_count) {
+        std::swap(batch, m_tasks);
+        return;
+    }
+
+    const auto batch_end = m_tasks.begin() + max_count;
+    batch.insert(batch.end(), std::make_move_iterator(m_tasks.begin()), std::make_move_iterator(batch_end));
+    m_tasks.erase(m_tasks.begin(), batch_end);
+}
+
+void manual_executor::return_batch(std::deque<task>& batch) {
+    // the tasks that weren't executed go back to the front of the queue, like they were never taken.
     std::unique_lock<decltype(m_lock)> lock(m_lock);
-    if (m_abort) {
+    if (!m_abort) {
+        m_tasks.insert(m_tasks.begin(), std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
+    }
+
+    batch.clear();
+}
+
+size_t manual_executor::execute_batch(std::deque<task>& batch, time_point deadline) {
+    const auto has_deadline = (deadline != time_point::max());
+    size_t executed = 0;
+
+    while (!batch.empty()) {
+        if (shutdown_requested()) {
+            batch.clear();  // the rest of the batch is dropped like the tasks that were still enqueued.
+            break;
+        }
+
+        // the caller checked the deadline before taking the batch, the following tasks are checked one by one
+        if (has_deadline && executed != 0 && std::chrono::steady_clock::now() >= deadline) {
+            return_batch(batch);
+            break;
+        }
+
+        auto task = std::move(batch.front());
+        batch.pop_front();
+
+        try {
+            task();
+        } catch (...) {
+            return_batch(batch);
+            throw;
+        }
+
+        ++executed;
+    }
+
+    return executed;
+}
+
+template<class predicate_type>
+void manual_executor::wait(std::unique_lock<std::mutex>& lock, predicate_type predicate) {
+    m_waiters.fetch_add(1, std::memory_order_seq_cst);
+    try {
+        m_condition.wait(lock, predicate);
+    } catch (...) {
+        m_waiters.fetch_sub(1, std::memory_order_relaxed);
+        throw;
+    }
+
+    m_waiters.fetch_sub(1, std::memory_order_relaxed);
+}
+
+template<class predicate_type>
+bool manual_executor::wait_until(std::unique_lock<std::mutex>& lock, time_point deadline, predicate_type predicate) {
+    m_waiters.fetch_add(1, std::memory_order_seq_cst);
+    bool satisfied = false;
+
+    try {
+        satisfied = m_condition.wait_until(lock, deadline, predicate);
+    } catch (...) {
+        m_waiters.fetch_sub(1, std::memory_order_relaxed);
+        throw;
+    }
+
+    m_waiters.fetch_sub(1, std::memory_order_relaxed);
+    return satisfied;
+}
+
+void manual_executor::enqueue(concurrencpp::task task) {
+    if (shutdown_requested()) {
         details::throw_runtime_shutdown_exception(name);
     }
 
-    m_tasks.emplace_back(std::move(task));
-    lock.unlock();
+    m_pushed_tasks.push(task);
 
-    m_condition.notify_all();
+    // pairs with the exchange in shutdown: either we see the abort flag or shutdown clears m_pushed_tasks after us.
+    if (m_atomic_abort.load(std::memory_order_seq_cst)) {
+        m_pushed_tasks.clear();
+        details::throw_runtime_shutdown_exception(name);
+    }
+
+    notify_waiters();
 }
 
 void manual_executor::enqueue(std::span<concurrencpp::task> tasks) {
-    std::unique_lock<decltype(m_lock)> lock(m_lock);
-    if (m_abort) {
+    if (shutdown_requested()) {
         details::throw_runtime_shutdown_exception(name);
     }
 
-    m_tasks.insert(m_tasks.end(), std::make_move_iterator(tasks.begin()), std::make_move_iterator(tasks.end()));
-    lock.unlock();
+    m_pushed_tasks.push(tasks);
 
-    m_condition.notify_all();
+    // pairs with the exchange in shutdown: either we see the abort flag or shutdown clears m_pushed_tasks after us.
+    if (m_atomic_abort.load(std::memory_order_seq_cst)) {
+        m_pushed_tasks.clear();
+        details::throw_runtime_shutdown_exception(name);
+    }
+
+    notify_waiters();
 }
 
 int manual_executor::max_concurrency_level() const noexcept {
@@ -37,7 +149,7 @@ int manual_executor::max_concurrency_level() const noexcept {
 
 size_t manual_executor::size() const {
     std::unique_lock<std::mutex> lock(m_lock);
-    return m_tasks.size();
+    return collect_tasks();
 }
 
 bool manual_executor::empty() const {
@@ -50,27 +162,23 @@ size_t manual_executor::loop_impl(size_t max_count) {
     }
 
     size_t executed = 0;
+    std::deque<task> batch;
 
-    while (true) {
-        if (executed == max_count) {
-            break;
-        }
+    while (executed != max_count) {
+        {
+            std::unique_lock<decltype(m_lock)> lock(m_lock);
+            if (m_abort) {
+                break;
+            }
 
-        std::unique_lock<decltype(m_lock)> lock(m_lock);
-        if (m_abort) {
-            break;
-        }
+            if (collect_tasks() == 0) {
+                break;
+            }
 
-        if (m_tasks.empty()) {
-            break;
+            take_batch(batch, max_count - executed);
         }
 
-        auto task = std::move(m_tasks.front());
-        m_tasks.pop_front();
-        lock.unlock();
-
-        task();
-        ++executed;
+        executed += execute_batch(batch);
     }
 
     if (shutdown_requested()) {
@@ -80,44 +188,39 @@ size_t manual_executor::loop_impl(size_t max_count) {
     return executed;
 }
 
-size_t manual_executor::loop_until_impl(size_t max_count, std::chrono::time_point<std::chrono::system_clock> deadline) {
+size_t manual_executor::loop_until_impl(size_t max_count, time_point deadline) {
     if (max_count == 0) {
         return 0;
     }
 
     size_t executed = 0;
+    std::deque<task> batch;
     deadline += std::chrono::milliseconds(1);
 
-    while (true) {
-        if (executed == max_count) {
-            break;
-        }
-
-        const auto now = std::chrono::system_clock::now();
+    while (executed != max_count) {
+        const auto now = std::chrono::steady_clock::now();
         if (now >= deadline) {
             break;
         }
 
-        std::unique_lock<decltype(m_lock)> lock(m_lock);
-        const auto found_task = m_condition.wait_until(lock, deadline, [this] {
-            return !m_tasks.empty() || m_abort;
-        });
+        {
+            std::unique_lock<decltype(m_lock)> lock(m_lock);
+            const auto found_task = wait_until(lock, deadline, [this] {
+                return (collect_tasks() != 0) || m_abort;
+            });
 
-        if (m_abort) {
-            break;
-        }
+            if (m_abort) {
+                break;
+            }
 
-        if (!found_task) {
-            break;
-        }
+            if (!found_task) {
+                break;
+            }
 
-        assert(!m_tasks.empty());
-        auto task = std::move(m_tasks.front());
-        m_tasks.pop_front();
-        lock.unlock();
+            take_batch(batch, max_count - executed);
+        }
 
-        task();
-        ++executed;
+        executed += execute_batch(batch, deadline);
     }
 
     if (shutdown_requested()) {
@@ -136,8 +239,8 @@ void manual_executor::wait_for_tasks_impl(size_t count) {
     }
 
     std::unique_lock<decltype(m_lock)> lock(m_lock);
-    m_condition.wait(lock, [this, count] {
-        return (m_tasks.size() >= count) || m_abort;
+    wait(lock, [this, count] {
+        return (collect_tasks() >= count) || m_abort;
     });
 
     if (m_abort) {
@@ -147,12 +250,12 @@ void manual_executor::wait_for_tasks_impl(size_t count) {
     assert(m_tasks.size() >= count);
 }
 
-size_t manual_executor::wait_for_tasks_impl(size_t count, std::chrono::time_point<std::chrono::system_clock> deadline) {
+size_t manual_executor::wait_for_tasks_impl(size_t count, time_point deadline) {
     deadline += std::chrono::milliseconds(1);
 
     std::unique_lock<decltype(m_lock)> lock(m_lock);
-    m_condition.wait_until(lock, deadline, [this, count] {
-        return (m_tasks.size() >= count) || m_abort;
+    wait_until(lock, deadline, [this, count] {
+        return (collect_tasks() >= count) || m_abort;
     });
 
     if (m_abort) {
@@ -196,6 +299,7 @@ size_t manual_executor::clear() {
         details::throw_runtime_shutdown_exception(name);
     }
 
+    collect_tasks();
     const auto tasks = std::move(m_tasks);
     lock.unlock();
     return tasks.size();
@@ -218,7 +322,7 @@ size_t manual_executor::wait_for_tasks_for(size_t count, std::chrono::millisecon
 }
 
 void manual_executor::shutdown() {
-    const auto abort = m_atomic_abort.exchange(true, std::memory_order_relaxed);
+    const auto abort = m_atomic_abort.exchange(true, std::memory_order_seq_cst);
     if (abort) {
         return;  // shutdown had been called before.
     }
@@ -234,8 +338,11 @@ void manual_executor::shutdown() {
     m_condition.notify_all();
 
     tasks.clear();
+
+    // a producer that pushes after this clear sees the abort flag and clears the queue on its own.
+    m_pushed_tasks.clear();
 }
 
 bool manual_executor::shutdown_requested() const {
     return m_atomic_abort.load(std::memory_order_relaxed);
-}
\ No newline at end of file
+}
@@ -0,0 +1,183 @@
+#include "concurrencpp/executors/constants.h"
+#include "concurrencpp/executors/strand_executor.h"
+
+#include <stdexcept>
+
+using concurrencpp::strand_executor;
+
+/*
+    strand_executor::drain_task
+*/
+
+class strand_executor::drain_task {
+
+   private:
+    std::shared_ptr<strand_executor> m_self;
+
+   public:
+    drain_task(std::shared_ptr<strand_executor> self) noexcept : m_self(std::move(self)) {}
+    drain_task(drain_task&& rhs) noexcept = default;
+
+    ~drain_task() noexcept {
+        if (static_cast<bool>(m_self)) {
+            // the task was destroyed without running, e.g. by the shutdown of the underlying executor
+            m_self->abandon();
+        }
+    }
+
+    void operator()() {
+        const auto self = std::move(m_self);
+        self->drain();
+    }
+};
+
+/*
+    strand_executor
+*/
+
+strand_executor::strand_executor(std::shared_ptr<executor> underlying_executor, size_t max_batch_size) :
+    derivable_executor<concurrencpp::strand_executor>(details::consts::k_strand_executor_name),
+    m_underlying_executor(std::move(underlying_executor)), m_max_batch_size(max_batch_size), m_pending(0), m_atomic_abort(false) {
+    if (!static_cast<bool>(m_underlying_executor)) {
+        throw std::invalid_argument(details::consts::k_strand_executor_null_executor_err_msg);
+    }
+
+    if (max_batch_size == 0) {
+        throw std::invalid_argument(details::consts::k_strand_executor_zero_batch_size_err_msg);
+    }
+}
+
+void strand_executor::schedule() {
+    m_underlying_executor->enqueue(concurrencpp::task(drain_task(shared_from_this())));
+}
+
+void strand_executor::discard_tasks() noexcept {
+    // m_pending is left as is, so the strand stays owned and is never scheduled again.
+    m_batch.clear();
+    m_queue.clear();
+}
+
+void strand_executor::abandon() noexcept {
+    // called by the owner of the strand when no drain can be scheduled. the strand can't execute tasks anymore, so it
+    // shuts down rather than accept tasks nothing would ever execute.
+    m_atomic_abort.store(true, std::memory_order_relaxed);
+    discard_tasks();
+}
+
+void strand_executor::drain() {
+    if (shutdown_requested()) {
+        discard_tasks();
+        return;
+    }
+
+    m_queue.pop_all(m_batch);
+
+    size_t executed = 0;
+    std::exception_ptr task_exception;
+
+    while (executed < m_max_batch_size && !m_batch.empty()) {
+        if (shutdown_requested()) {
+            discard_tasks();
+            return;
+        }
+
+        auto task = std::move(m_batch.front());
+        m_batch.pop_front();
+        ++executed;
+
+        try {
+            task();
+        } catch (...) {
+            // the strand has to be handed over before the exception propagates, or the rest of the tasks are stuck.
+            task_exception = std::current_exception();
+            break;
+        }
+    }
+
+    // tasks pushed meanwhile (or not yet pushed by a producer that has already counted them) are drained by the next
+    // scheduling, which also lets other work of the underlying executor run in between.
+    if (m_pending.fetch_sub(executed, std::memory_order_acq_rel) != executed) {
+        try {
+            schedule();
+        } catch (...) {
+            // the underlying executor was shut down, or the drain task abandoned the strand when it was destroyed
+            abandon();
+        }
+    }
+
+    if (static_cast<bool>(task_exception)) {
+        std::rethrow_exception(task_exception);
+    }
+}
+
+void strand_executor::enqueue(concurrencpp::task task) {
+    enqueue(std::span<concurrencpp::task>(&task, 1));
+}
+
+void strand_executor::enqueue(std::span<concurrencpp::task> tasks) {
+    if (shutdown_requested()) {
+        details::throw_runtime_shutdown_exception(name);
+    }
+
+    if (tasks.empty()) {
+        return;
+    }
+
+    // tasks are counted before they're pushed, so a drain can never execute a task it hasn't counted.
+    const auto count = tasks.size();
+    const auto previous = m_pending.fetch_add(count, std::memory_order_acq_rel);
+
+    try {
+        m_queue.push(tasks);
+    } catch (...) {
+        const auto remaining = m_pending.fetch_sub(count, std::memory_order_acq_rel) - count;
+        if (previous == 0 && remaining != 0) {
+            try {
+                schedule();  // other producers counted on this one to schedule the strand.
+            } catch (...) {
+                abandon();
+            }
+        }
+
+        throw;
+    }
+
+    if (previous != 0) {
+        return;  // the strand is already scheduled or running
+    }
+
+    try {
+        schedule();
+    } catch (...) {
+        abandon();
+        throw;
+    }
+}
+
+int strand_executor::max_concurrency_level() const noexcept {
+    return details::consts::k_strand_executor_max_concurrency_level;
+}
+
+bool strand_executor::shutdown_requested() const {
+    return m_atomic_abort.load(std::memory_order_relaxed);
+}
+
+void strand_executor::shutdown() {
+    const auto abort = m_atomic_abort.exchange(true, std::memory_order_relaxed);
+    if (abort) {
+        return;  // shutdown had been called before.
+    }
+
+    // take the ownership of an idle strand so no drain is scheduled anymore. an owning drain discards the tasks itself.
+    if (m_pending.fetch_add(1, std::memory_order_acq_rel) == 0) {
+        discard_tasks();
+    }
+}
+
+std::shared_ptr<concurrencpp::executor> strand_executor::underlying_executor() const noexcept {
+    return m_underlying_executor;
+}
+
+size_t strand_executor::max_batch_size() const noexcept {
+    return m_max_batch_size;
+}
@@ -4,28 +4,46 @@
 using concurrencpp::thread_executor;
 
 thread_executor::thread_executor(const std::function<void(std::string_view thread_name)>& thread_started_callback,
-                                 const std::function<void(std::string_view thread_name)>& thread_terminated_callback) :
+                                 const std::function<void(std::string_view thread_name)>& thread_terminated_callback,
+                                 size_t max_cached_threads,
+                                 std::chrono::milliseconds max_idle_time) :
     derivable_executor<concurrencpp::thread_executor>(details::consts::k_thread_executor_name),
-    m_abort(false), m_atomic_abort(false), m_thread_started_callback(thread_started_callback),
-    m_thread_terminated_callback(thread_terminated_callback) {}
+    m_abort(false), m_atomic_abort(false), m_max_cached_threads(max_cached_threads), m_max_idle_time(max_idle_time),
+    m_thread_started_callback(thread_started_callback), m_thread_terminated_callback(thread_terminated_callback) {}
 
 thread_executor::~thread_executor() noexcept {
     assert(m_workers.empty());
+    assert(m_parked_workers.empty());
     assert(m_last_retired.empty());
 }
 
 void thread_executor::enqueue_impl(std::unique_lock<std::mutex>& lock, concurrencpp::task& task) {
     assert(lock.owns_lock());
 
-    auto& new_thread = m_workers.emplace_front();
-    new_thread = details::thread(
-        details::make_executor_worker_name(name),
-        [this, self_it = m_workers.begin(), task = std::move(task)]() mutable {
-            task();
-            retire_worker(self_it);
-        },
-        m_thread_started_callback,
-        m_thread_terminated_callback);
+    if (!m_parked_workers.empty()) {
+        // the most recently parked thread is handed the task, the least recently parked ones are left to expire.
+        const auto it = m_parked_workers.begin();
+        it->next_task = std::move(task);
+        it->has_task = true;
+        m_workers.splice(m_workers.begin(), m_parked_workers, it);
+        it->condition.notify_one();
+        return;
+    }
+
+    auto& new_worker = m_workers.emplace_front();
+
+    try {
+        new_worker.thread = details::thread(
+            details::make_executor_worker_name(name),
+            [this, self_it = m_workers.begin(), task = std::move(task)]() mutable {
+                work_loop(self_it, std::move(task));
+            },
+            m_thread_started_callback,
+            m_thread_terminated_callback);
+    } catch (...) {
+        m_workers.pop_front();
+        throw;
+    }
 }
 
 void thread_executor::enqueue(concurrencpp::task task) {
@@ -64,8 +82,13 @@ void thread_executor::shutdown() {
 
     std::unique_lock<std::mutex> lock(m_lock);
     m_abort = true;
+
+    for (auto& worker : m_parked_workers) {
+        worker.condition.notify_one();
+    }
+
     m_condition.wait(lock, [this] {
-        return m_workers.empty();
+        return m_workers.empty() && m_parked_workers.empty();
     });
 
     if (m_last_retired.empty()) {
@@ -73,14 +96,64 @@ void thread_executor::shutdown() {
     }
 
     assert(m_last_retired.size() == 1);
-    m_last_retired.front().join();
+    m_last_retired.front().thread.join();
     m_last_retired.clear();
 }
 
-void thread_executor::retire_worker(std::list<details::thread>::iterator it) {
-    std::unique_lock<std::mutex> lock(m_lock);
+size_t thread_executor::max_cached_threads() const noexcept {
+    return m_max_cached_threads;
+}
+
+std::chrono::milliseconds thread_executor::max_worker_idle_time() const noexcept {
+    return m_max_idle_time;
+}
+
+void thread_executor::work_loop(worker_list::iterator self_it, concurrencpp::task first_task) {
+    auto task = std::move(first_task);
+
+    while (true) {
+        task();
+        task.clear();  // a parked thread must not keep the captures of its last task alive
+
+        std::unique_lock<std::mutex> lock(m_lock);
+        if (!park_worker(lock, self_it)) {
+            return;
+        }
+
+        task = std::move(self_it->next_task);
+    }
+}
+
+bool thread_executor::park_worker(std::unique_lock<std::mutex>& lock, worker_list::iterator self_it) {
+    assert(lock.owns_lock());
+
+    if (m_abort || m_parked_workers.size() >= m_max_cached_threads) {
+        retire_worker(lock, m_workers, self_it);
+        return false;
+    }
+
+    auto& self = *self_it;
+    m_parked_workers.splice(m_parked_workers.begin(), m_workers, self_it);
+
+    self.condition.wait_for(lock, m_max_idle_time, [this, &self] {
+        return self.has_task || m_abort;
+    });
+
+    // tasks that were handed over before shutdown are still executed
+    if (self.has_task) {
+        self.has_task = false;  // enqueue_impl has moved us back to m_workers
+        return true;
+    }
+
+    retire_worker(lock, m_parked_workers, self_it);
+    return false;
+}
+
+void thread_executor::retire_worker(std::unique_lock<std::mutex>& lock, worker_list& list, worker_list::iterator it) {
+    assert(lock.owns_lock());
+
     auto last_retired = std::move(m_last_retired);
-    m_last_retired.splice(m_last_retired.begin(), m_workers, it);
+    m_last_retired.splice(m_last_retired.begin(), list, it);
 
     lock.unlock();
     m_condition.notify_one();
@@ -90,5 +163,5 @@ void thread_executor::retire_worker(std::list<details::thread>::iterator it) {
     }
 
     assert(last_retired.size() == 1);
-    last_retired.front().join();
-}
\ No newline at end of file
+    last_retired.front().thread.join();
+}
@@ -1,5 +1,7 @@
+#include "concurrencpp/executors/constants.h"
 #include "concurrencpp/executors/thread_pool_executor.h"
 
+#include <thread>
 #include <semaphore>
 #include <algorithm>
 
@@ -79,9 +81,15 @@ namespace concurrencpp::details {
 
         void shutdown();
 
+        // runs one task instead of blocking the calling worker: a private one, a public one or one stolen from another
+        // worker. returns false if there was no task to run.
+        bool help_once();
+        bool try_steal(concurrencpp::task& task);
+
         std::chrono::milliseconds max_worker_idle_time() const noexcept;
 
         bool appears_empty() const noexcept;
+        bool appears_aborted() const noexcept;
     };
 }  // namespace concurrencpp::details
 
@@ -507,6 +515,43 @@ void thread_pool_worker::shutdown() {
     private_queue.clear();
 }
 
+bool thread_pool_worker::help_once() {
+    if (m_atomic_abort.load(std::memory_order_relaxed)) {
+        return false;
+    }
+
+    if (m_private_queue.empty()) {
+        std::unique_lock<std::mutex> lock(m_lock);
+        m_private_queue.insert(m_private_queue.end(),
+                               std::make_move_iterator(m_public_queue.begin()),
+                               std::make_move_iterator(m_public_queue.end()));
+        m_public_queue.clear();
+    }
+
+    concurrencpp::task task;
+    if (!m_private_queue.empty()) {
+        task = std::move(m_private_queue.back());
+        m_private_queue.pop_back();
+    } else if (!m_parent_pool.steal_task(m_index, task)) {
+        return false;
+    }
+
+    task();
+    return true;
+}
+
+bool thread_pool_worker::try_steal(concurrencpp::task& task) {
+    std::unique_lock<std::mutex> lock(m_lock);
+    if (m_abort || m_public_queue.empty()) {
+        return false;
+    }
+
+    // the oldest task, the owner executes its tasks from the back
+    task = std::move(m_public_queue.front());
+    m_public_queue.pop_front();
+    return true;
+}
+
 std::chrono::milliseconds thread_pool_worker::max_worker_idle_time() const noexcept {
     return m_max_idle_time;
 }
@@ -515,6 +560,10 @@ bool thread_pool_worker::appears_empty() const noexcept {
     return m_private_queue.empty() && !m_task_found_or_abort.load(std::memory_order_relaxed);
 }
 
+bool thread_pool_worker::appears_aborted() const noexcept {
+    return m_atomic_abort.load(std::memory_order_relaxed);
+}
+
 thread_pool_executor::thread_pool_executor(std::string_view pool_name,
                                            size_t pool_size,
                                            std::chrono::milliseconds max_idle_time,
@@ -544,6 +593,25 @@ thread_pool_worker& thread_pool_executor::worker_at(size_t index) noexcept {
     return m_workers[index];
 }
 
+bool thread_pool_executor::steal_task(size_t caller_index, concurrencpp::task& task) {
+    for (size_t i = 1; i < m_workers.size(); i++) {
+        if (m_workers[(caller_index + i) % m_workers.size()].try_steal(task)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+size_t thread_pool_executor::acquire_idle_worker() noexcept {
+    return m_idle_workers.find_idle_worker(details::s_tl_thread_pool_data.this_thread_index);
+}
+
+void thread_pool_executor::enqueue_to_worker(size_t index, concurrencpp::task& task) {
+    assert(index < m_workers.size());
+    m_workers[index].enqueue_foreign(task);
+}
+
 void thread_pool_executor::mark_worker_idle(size_t index) noexcept {
     assert(index < m_workers.size());
     m_idle_workers.set_idle(index);
@@ -641,3 +709,34 @@ void thread_pool_executor::shutdown() {
 std::chrono::milliseconds thread_pool_executor::max_worker_idle_time() const noexcept {
     return m_workers[0].max_worker_idle_time();
 }
+
+bool concurrencpp::details::help_thread_pool_until(bool (*ready)(const void* context) noexcept, const void* context) {
+    const auto this_worker = details::s_tl_thread_pool_data.this_worker;
+    if (this_worker == nullptr) {
+        return false;
+    }
+
+    // the worker never blocks while it waits: it runs whatever task it can find, and backs off while there is none.
+    size_t idle_rounds = 0;
+    while (!ready(context)) {
+        if (this_worker->help_once()) {
+            idle_rounds = 0;
+            continue;
+        }
+
+        if (this_worker->appears_aborted()) {
+            return false;
+        }
+
+        if (idle_rounds < consts::k_thread_pool_help_yield_rounds) {
+            std::this_thread::yield();
+        } else {
+            const auto shift = std::min<size_t>(idle_rounds - consts::k_thread_pool_help_yield_rounds, 10);
+            std::this_thread::sleep_for(std::chrono::microseconds(size_t(1) << shift));
+        }
+
+        ++idle_rounds;
+    }
+
+    return true;
+}
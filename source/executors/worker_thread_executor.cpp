@@ -11,7 +11,7 @@ using concurrencpp::worker_thread_executor;
 worker_thread_executor::worker_thread_executor(const std::function<void(std::string_view thread_name)>& thread_started_callback,
                                                const std::function<void(std::string_view thread_name)>& thread_terminated_callback) :
     derivable_executor<concurrencpp::worker_thread_executor>(details::consts::k_worker_thread_executor_name),
-    m_private_atomic_abort(false), m_semaphore(0), m_atomic_abort(false), m_abort(false),
+    m_private_atomic_abort(false), m_thread_started(false), m_atomic_abort(false), m_abort(false),
     m_thread_started_callback(thread_started_callback), m_thread_terminated_callback(thread_terminated_callback) {}
 
 void concurrencpp::worker_thread_executor::make_os_worker_thread() {
@@ -39,38 +39,42 @@ bool worker_thread_executor::drain_queue_impl() {
     return true;
 }
 
-void worker_thread_executor::wait_for_task(std::unique_lock<std::mutex>& lock) {
-    assert(lock.owns_lock());
-    if (!m_public_queue.empty() || m_abort) {
+void worker_thread_executor::ensure_worker_thread() {
+    std::unique_lock<std::mutex> lock(m_lock);
+    if (m_abort || m_thread.joinable()) {
         return;
     }
 
-    while (true) {
-        lock.unlock();
+    make_os_worker_thread();
+    m_thread_started.store(true, std::memory_order_release);
+}
 
-        m_semaphore.acquire();
+bool worker_thread_executor::wait_for_task() {
+    while (m_public_queue.empty()) {
+        if (m_atomic_abort.load(std::memory_order_relaxed)) {
+            return false;
+        }
 
-        lock.lock();
-        if (!m_public_queue.empty() || m_abort) {
-            break;
+        // a producer that pushes after prepare_wait sees us waiting and notifies, one that pushed before is seen here.
+        const auto key = m_event_count.prepare_wait();
+        if (!m_public_queue.empty() || m_atomic_abort.load(std::memory_order_seq_cst)) {
+            m_event_count.cancel_wait();
+            continue;
         }
+
+        m_event_count.wait(key);
     }
+
+    return !m_atomic_abort.load(std::memory_order_relaxed);
 }
 
 bool worker_thread_executor::drain_queue() {
-    std::unique_lock<std::mutex> lock(m_lock);
-    wait_for_task(lock);
-
-    assert(lock.owns_lock());
-    assert(!m_public_queue.empty() || m_abort);
-
-    if (m_abort) {
+    if (!wait_for_task()) {
         return false;
     }
 
     assert(m_private_queue.empty());
-    std::swap(m_private_queue, m_public_queue);  // reuse underlying allocations.
-    lock.unlock();
+    m_public_queue.pop_all(m_private_queue);  // reuse underlying allocations.
 
     return drain_queue_impl();
 }
@@ -102,43 +106,45 @@ void worker_thread_executor::enqueue_local(std::span<concurrencpp::task> tasks)
 }
 
 void worker_thread_executor::enqueue_foreign(concurrencpp::task& task) {
-    std::unique_lock<std::mutex> lock(m_lock);
-    if (m_abort) {
+    if (m_atomic_abort.load(std::memory_order_relaxed)) {
         details::throw_runtime_shutdown_exception(name);
     }
 
-    const auto is_empty = m_public_queue.empty();
-    m_public_queue.emplace_back(std::move(task));
+    m_public_queue.push(task);
 
-    if (!m_thread.joinable()) {
-        return make_os_worker_thread();
+    // pairs with the exchange in shutdown: either we see the abort flag or shutdown clears the queue after the worker is joined.
+    if (m_atomic_abort.load(std::memory_order_seq_cst)) {
+        m_public_queue.clear();
+        details::throw_runtime_shutdown_exception(name);
     }
 
-    lock.unlock();
-
-    if (is_empty) {
-        m_semaphore.release();
+    // the thread may have been started by another producer that hasn't published it yet, and already be waiting.
+    if (!m_thread_started.load(std::memory_order_acquire)) {
+        ensure_worker_thread();
     }
+
+    m_event_count.notify_one();
 }
 
 void worker_thread_executor::enqueue_foreign(std::span<concurrencpp::task> tasks) {
-    std::unique_lock<std::mutex> lock(m_lock);
-    if (m_abort) {
+    if (m_atomic_abort.load(std::memory_order_relaxed)) {
         details::throw_runtime_shutdown_exception(name);
     }
 
-    const auto is_empty = m_public_queue.empty();
-    m_public_queue.insert(m_public_queue.end(), std::make_move_iterator(tasks.begin()), std::make_move_iterator(tasks.end()));
+    m_public_queue.push(tasks);
 
-    if (!m_thread.joinable()) {
-        return make_os_worker_thread();
+    // pairs with the exchange in shutdown: either we see the abort flag or shutdown clears the queue after the worker is joined.
+    if (m_atomic_abort.load(std::memory_order_seq_cst)) {
+        m_public_queue.clear();
+        details::throw_runtime_shutdown_exception(name);
     }
 
-    lock.unlock();
-
-    if (is_empty) {
-        m_semaphore.release();
+    // the thread may have been started by another producer that hasn't published it yet, and already be waiting.
+    if (!m_thread_started.load(std::memory_order_acquire)) {
+        ensure_worker_thread();
     }
+
+    m_event_count.notify_one();
 }
 
 void worker_thread_executor::enqueue(concurrencpp::task task) {
@@ -166,7 +172,8 @@ bool worker_thread_executor::shutdown_requested() const {
 }
 
 void worker_thread_executor::shutdown() {
-    const auto abort = m_atomic_abort.exchange(true, std::memory_order_relaxed);
+    // pairs with the worker checking the flag after prepare_wait: either it sees the flag or we see it waiting.
+    const auto abort = m_atomic_abort.exchange(true, std::memory_order_seq_cst);
     if (abort) {
         return;  // shutdown had been called before.
     }
@@ -177,21 +184,13 @@ void worker_thread_executor::shutdown() {
     }
 
     m_private_atomic_abort.store(true, std::memory_order_relaxed);
-    m_semaphore.release();
+    m_event_count.notify_all();
 
     if (m_thread.joinable()) {
         m_thread.join();
     }
 
-    decltype(m_private_queue) private_queue;
-    decltype(m_public_queue) public_queue;
-
-    {
-        std::unique_lock<std::mutex> lock(m_lock);
-        private_queue = std::move(m_private_queue);
-        public_queue = std::move(m_public_queue);
-    }
-
+    auto private_queue = std::move(m_private_queue);
     private_queue.clear();
-    public_queue.clear();
+    m_public_queue.clear();
 }
@@ -2,6 +2,7 @@
 
 #include "concurrencpp/executors/executor.h"
 #include "concurrencpp/results/impl/shared_result_state.h"
+#include "concurrencpp/results/impl/result_timeout_context.h"
 
 using concurrencpp::details::when_any_context;
 using concurrencpp::details::consumer_context;
@@ -172,6 +173,10 @@ void consumer_context::destroy() noexcept {
         case consumer_status::shared: {
             return details::destroy(m_storage.shared_ctx);
         }
+
+        case consumer_status::timeout: {
+            return;
+        }
     }
 
     assert(false);
@@ -206,6 +211,12 @@ void concurrencpp::details::consumer_context::set_shared_context(const std::shar
     details::build(m_storage.shared_ctx, shared_ctx);
 }
 
+void consumer_context::set_timeout_context(result_timeout_context& timeout_ctx) noexcept {
+    assert(m_status == consumer_status::idle);
+    m_status = consumer_status::timeout;
+    m_storage.timeout_ctx = &timeout_ctx;
+}
+
 void consumer_context::resume_consumer(result_state_base& self) const {
     switch (m_status) {
         case consumer_status::idle: {
@@ -238,6 +249,10 @@ void consumer_context::resume_consumer(result_state_base& self) const {
             }
             return;
         }
+
+        case consumer_status::timeout: {
+            return m_storage.timeout_ctx->on_result_finished();
+        }
     }
 
     assert(false);
@@ -1,5 +1,6 @@
 #include "concurrencpp/results/impl/result_state.h"
 #include "concurrencpp/results/impl/shared_result_state.h"
+#include "concurrencpp/executors/thread_pool_executor.h"
 
 using concurrencpp::details::result_state_base;
 
@@ -13,6 +14,18 @@ void result_state_base::wait() {
         return;
     }
 
+    // a thread pool worker executes other tasks while it waits, the consumer state is left idle meanwhile.
+    const auto helped = details::help_thread_pool_until(
+        [](const void* context) noexcept {
+            const auto self = static_cast<const result_state_base*>(context);
+            return self->m_pc_state.load(std::memory_order_acquire) == pc_state::producer_done;
+        },
+        this);
+
+    if (helped) {
+        return;
+    }
+
     auto expected_state = pc_state::idle;
     const auto idle = m_pc_state.compare_exchange_strong(expected_state,
                                                          pc_state::consumer_waiting,
@@ -99,10 +112,32 @@ void concurrencpp::details::result_state_base::share(const std::shared_ptr<share
     shared_result_state->on_result_finished();
 }
 
-void result_state_base::try_rewind_consumer() noexcept {
+bool result_state_base::await_with_timeout(result_timeout_context& timeout_ctx) noexcept {
+    const auto state = m_pc_state.load(std::memory_order_acquire);
+    if (state == pc_state::producer_done) {
+        return false;
+    }
+
+    m_consumer.set_timeout_context(timeout_ctx);
+
+    auto expected_state = pc_state::idle;
+    const auto idle = m_pc_state.compare_exchange_strong(expected_state,
+                                                         pc_state::consumer_set,
+                                                         std::memory_order_acq_rel,
+                                                         std::memory_order_acquire);
+
+    if (!idle) {
+        assert_done();
+        m_consumer.clear();
+    }
+
+    return idle;
+}
+
+bool result_state_base::try_rewind_consumer() noexcept {
     const auto pc_state = m_pc_state.load(std::memory_order_acquire);
     if (pc_state != pc_state::consumer_set) {
-        return;
+        return false;
     }
 
     auto expected_consumer_state = pc_state::consumer_set;
@@ -113,8 +148,9 @@ void result_state_base::try_rewind_consumer() noexcept {
 
     if (!consumer) {
         assert_done();
-        return;
+        return false;
     }
 
     m_consumer.clear();
+    return true;
 }
@@ -0,0 +1,100 @@
+#include "concurrencpp/results/impl/result_timeout_context.h"
+
+#include "concurrencpp/errors.h"
+#include "concurrencpp/results/constants.h"
+#include "concurrencpp/results/impl/result_state.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/timers/timer_queue.h"
+
+using concurrencpp::details::result_timeout_context;
+
+result_timeout_context::result_timeout_context(result_state_base& state,
+                                               std::shared_ptr<concurrencpp::timer_queue> timer_queue,
+                                               duration timeout,
+                                               std::shared_ptr<concurrencpp::executor> executor) noexcept :
+    m_state(state),
+    m_timer_queue(std::move(timer_queue)), m_executor(std::move(executor)), m_timeout(timeout) {
+    assert(static_cast<bool>(m_timer_queue));
+    assert(static_cast<bool>(m_executor));
+}
+
+result_timeout_context::~result_timeout_context() noexcept {
+    disarm();
+}
+
+void result_timeout_context::resume_caller() noexcept {
+    try {
+        m_executor->post(await_via_functor {m_caller_handle, &m_interrupted});
+    } catch (...) {
+        // the exception caused the enqeueud task to be broken and resumed with an interrupt, no need to do anything here.
+    }
+}
+
+void result_timeout_context::on_timeout() noexcept {
+    // if the consumer can't be rewound the producer has completed the result and is about to resume the caller.
+    if (!m_state.try_rewind_consumer()) {
+        return;
+    }
+
+    const auto stage_before = m_stage.exchange(stage::timed_out, std::memory_order_acq_rel);
+    if (stage_before == stage::suspending) {
+        return;  // await_suspend will find out
+    }
+
+    assert(stage_before == stage::suspended);
+    resume_caller();
+}
+
+void result_timeout_context::on_result_finished() noexcept {
+    const auto stage_before = m_stage.exchange(stage::result_ready, std::memory_order_acq_rel);
+    if (stage_before == stage::suspending) {
+        return;  // await_suspend will find out
+    }
+
+    assert(stage_before == stage::suspended);
+
+    // waits for a timeout that is racing us, it can't rewind the consumer anymore
+    disarm();
+    resume_caller();
+}
+
+bool result_timeout_context::await_suspend(coroutine_handle<void> caller_handle) noexcept {
+    m_caller_handle = caller_handle;
+
+    if (!m_state.await_with_timeout(*this)) {
+        return false;  // the result is ready
+    }
+
+    try {
+        arm(*m_timer_queue, m_timeout);
+    } catch (...) {
+        if (m_state.try_rewind_consumer()) {
+            m_error = std::current_exception();
+            return false;
+        }
+
+        // the producer has completed the result in the meantime, it's reported as usual
+    }
+
+    const auto stage_before = m_stage.exchange(stage::suspended, std::memory_order_acq_rel);
+    if (stage_before == stage::suspending) {
+        return true;
+    }
+
+    // the result was completed or the timeout has passed before the caller was suspended
+    disarm();
+    m_stage.store(stage_before, std::memory_order_relaxed);
+    return false;
+}
+
+bool result_timeout_context::await_resume() const {
+    if (m_interrupted) {
+        throw errors::broken_task(consts::k_broken_task_exception_error_msg);
+    }
+
+    if (static_cast<bool>(m_error)) {
+        std::rethrow_exception(m_error);
+    }
+
+    return m_stage.load(std::memory_order_acquire) != stage::timed_out;
+}
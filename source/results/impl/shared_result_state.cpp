@@ -1,4 +1,5 @@
 #include "concurrencpp/results/impl/shared_result_state.h"
+#include "concurrencpp/executors/thread_pool_executor.h"
 
 using concurrencpp::details::shared_result_state_base;
 
@@ -26,7 +27,17 @@ bool shared_result_state_base::await(shared_await_context& awaiter) noexcept {
 }
 
 void concurrencpp::details::shared_result_state_base::wait() noexcept {
-    if (status() == result_status::idle) {
+    if (status() != result_status::idle) {
+        return;
+    }
+
+    const auto helped = details::help_thread_pool_until(
+        [](const void* context) noexcept {
+            return static_cast<const shared_result_state_base*>(context)->status() != result_status::idle;
+        },
+        this);
+
+    if (!helped) {
         m_status.wait(result_status::idle, std::memory_order_acquire);
     }
 }
@@ -22,6 +22,11 @@ namespace concurrencpp::details {
             return static_cast<size_t>(thread::hardware_concurrency() * consts::k_background_threadpool_worker_count_factor);
         }
 
+        size_t default_timer_queue_shard_count() noexcept {
+            const auto hardware_concurrency = thread::hardware_concurrency();
+            return (hardware_concurrency + consts::k_timer_queue_cores_per_shard - 1) / consts::k_timer_queue_cores_per_shard;
+        }
+
         constexpr auto k_default_max_worker_wait_time = std::chrono::seconds(consts::k_max_threadpool_worker_waiting_time_sec);
     }  // namespace
 }  // namespace concurrencpp::details
@@ -61,7 +66,10 @@ runtime_options::runtime_options() noexcept :
     max_thread_pool_executor_waiting_time(details::k_default_max_worker_wait_time),
     max_background_threads(details::default_max_background_workers()),
     max_background_executor_waiting_time(details::k_default_max_worker_wait_time),
-    max_timer_queue_waiting_time(std::chrono::seconds(details::consts::k_max_timer_queue_worker_waiting_time_sec)) {}
+    max_thread_executor_cached_threads(details::consts::k_thread_executor_default_max_cached_threads),
+    max_thread_executor_waiting_time(details::consts::k_thread_executor_default_max_idle_time_ms),
+    max_timer_queue_waiting_time(std::chrono::seconds(details::consts::k_max_timer_queue_worker_waiting_time_sec)),
+    timer_queue_shard_count(details::default_timer_queue_shard_count()), timer_backend(timer_queue_backend::condition_variable) {}
 
 /*
         runtime
@@ -72,7 +80,9 @@ runtime::runtime() : runtime(runtime_options()) {}
 runtime::runtime(const runtime_options& options) {
     m_timer_queue = std::make_shared<::concurrencpp::timer_queue>(options.max_timer_queue_waiting_time,
                                                                   options.thread_started_callback,
-                                                                  options.thread_terminated_callback);
+                                                                  options.thread_terminated_callback,
+                                                                  options.timer_queue_shard_count,
+                                                                  options.timer_backend);
 
     m_inline_executor = std::make_shared<::concurrencpp::inline_executor>();
     m_registered_executors.register_executor(m_inline_executor);
@@ -91,8 +101,10 @@ runtime::runtime(const runtime_options& options) {
                                                                                    options.thread_terminated_callback);
     m_registered_executors.register_executor(m_background_executor);
 
-    m_thread_executor =
-        std::make_shared<::concurrencpp::thread_executor>(options.thread_started_callback, options.thread_terminated_callback);
+    m_thread_executor = std::make_shared<::concurrencpp::thread_executor>(options.thread_started_callback,
+                                                                          options.thread_terminated_callback,
+                                                                          options.max_thread_executor_cached_threads,
+                                                                          options.max_thread_executor_waiting_time);
     m_registered_executors.register_executor(m_thread_executor);
 }
 
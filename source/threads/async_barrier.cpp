@@ -0,0 +1,100 @@
+#include "concurrencpp/threads/constants.h"
+#include "concurrencpp/threads/async_barrier.h"
+#include "concurrencpp/results/constants.h"
+#include "concurrencpp/errors.h"
+
+using concurrencpp::async_barrier;
+using concurrencpp::details::async_barrier_awaitable;
+
+/*
+    async_barrier_awaitable
+*/
+
+async_barrier_awaitable::async_barrier_awaitable(async_barrier& parent, std::shared_ptr<executor> resume_executor) noexcept :
+    m_parent(parent), m_resume_executor(std::move(resume_executor)), m_waiter(*m_resume_executor) {}
+
+bool async_barrier_awaitable::await_suspend(coroutine_handle<void> caller_handle) {
+    m_waiter.set_caller_handle(caller_handle);
+    return m_parent.arrive(&m_waiter, 0);
+}
+
+void async_barrier_awaitable::await_resume() const {
+    if (m_waiter.interrupted()) {
+        throw errors::broken_task(consts::k_broken_task_exception_error_msg);
+    }
+}
+
+/*
+    async_barrier
+*/
+
+async_barrier::async_barrier(size_t expected, std::function<void()> completion) :
+    m_expected(expected), m_completion(std::move(completion)) {
+    if (expected == 0) {
+        throw std::invalid_argument(details::consts::k_async_barrier_invalid_expected_err_msg);
+    }
+}
+
+async_barrier::~async_barrier() noexcept {
+#ifdef CRCPP_DEBUG_MODE
+    std::unique_lock<std::mutex> lock(m_lock);
+    assert(m_waiters.empty() && "concurrencpp::async_barrier is deleted while being used.");
+#endif
+}
+
+bool async_barrier::arrive(details::async_waiter* waiter, size_t drop_count) {
+    std::unique_lock<std::mutex> lock(m_lock);
+    if (m_expected == 0) {
+        throw std::system_error(static_cast<int>(std::errc::operation_not_permitted),
+                                std::system_category(),
+                                details::consts::k_async_barrier_arrive_no_participants_err_msg);
+    }
+
+    ++m_arrived;
+    m_pending_drops += drop_count;
+
+    if (m_arrived < m_expected) {
+        if (waiter == nullptr) {
+            return false;
+        }
+
+        m_waiters.push_back(*waiter);
+        return true;
+    }
+
+    // phase completion, dropped participants stop being expected from the next phase on.
+    auto waiters = std::move(m_waiters);
+    m_expected -= std::exchange(m_pending_drops, 0);
+    m_arrived = 0;
+    ++m_phase;
+    lock.unlock();
+
+    if (static_cast<bool>(m_completion)) {
+        try {
+            m_completion();
+        } catch (...) {
+            details::async_waiter::resume_all(waiters);
+            throw;
+        }
+    }
+
+    details::async_waiter::resume_all(waiters);
+    return false;
+}
+
+concurrencpp::details::async_barrier_awaitable async_barrier::arrive_and_wait(std::shared_ptr<executor> resume_executor) {
+    if (!static_cast<bool>(resume_executor)) {
+        throw std::invalid_argument(details::consts::k_async_barrier_arrive_and_wait_null_resume_executor_err_msg);
+    }
+
+    return {*this, std::move(resume_executor)};
+}
+
+void async_barrier::arrive_and_drop() {
+    arrive(nullptr, 1);
+}
+
+size_t async_barrier::phase() const {
+    std::unique_lock<std::mutex> lock(m_lock);
+    return m_phase;
+}
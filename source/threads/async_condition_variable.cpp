@@ -1,6 +1,7 @@
-#include "concurrencpp/results/resume_on.h"
 #include "concurrencpp/threads/constants.h"
 #include "concurrencpp/threads/async_condition_variable.h"
+#include "concurrencpp/timers/timer_queue.h"
+#include "concurrencpp/executors/inline_executor.h"
 
 using concurrencpp::executor;
 using concurrencpp::lazy_result;
@@ -9,25 +10,96 @@ using concurrencpp::async_condition_variable;
 
 using concurrencpp::details::cv_awaiter;
 
+namespace concurrencpp::details {
+    namespace {
+        class cv_timeout_callback {
+
+           private:
+            cv_awaiter& m_awaiter;
+            std::atomic_bool m_claimed;
+
+           public:
+            cv_timeout_callback(cv_awaiter& awaiter) noexcept : m_awaiter(awaiter), m_claimed(false) {}
+
+            cv_timeout_callback(cv_timeout_callback&& rhs) noexcept :
+                m_awaiter(rhs.m_awaiter), m_claimed(rhs.m_claimed.load(std::memory_order_relaxed)) {}
+
+            std::atomic_bool& claim_flag() noexcept {
+                return m_claimed;
+            }
+
+            void operator()() noexcept {
+                if (m_claimed.exchange(true, std::memory_order_acq_rel)) {
+                    return;  // notified first, the awaiter might not exist anymore.
+                }
+
+                m_awaiter.on_timeout();
+            }
+        };
+
+        std::shared_ptr<concurrencpp::executor> timeout_executor() {
+            // the timeout callback only re-queues the awaiter on its lock, it is cheap enough to run inside the timer_queue thread.
+            static const auto s_executor = std::make_shared<concurrencpp::inline_executor>();
+            return s_executor;
+        }
+    }  // namespace
+}  // namespace concurrencpp::details
+
 /*
     cv_awaiter
 */
 
-cv_awaiter::cv_awaiter(async_condition_variable& parent, scoped_async_lock& lock) noexcept : m_parent(parent), m_lock(lock) {}
+cv_awaiter::cv_awaiter(async_condition_variable& parent, scoped_async_lock& lock) noexcept :
+    m_parent(parent), m_lock(lock), m_lock_awaiter(*lock.mutex()) {}
+
+cv_awaiter::cv_awaiter(async_condition_variable& parent,
+                       scoped_async_lock& lock,
+                       concurrencpp::timer_queue& timer_queue,
+                       std::chrono::nanoseconds timeout) noexcept :
+    m_parent(parent),
+    m_lock(lock), m_lock_awaiter(*lock.mutex()), m_timer_queue(&timer_queue), m_timeout(timeout) {}
 
 void cv_awaiter::await_suspend(details::coroutine_handle<void> caller_handle) {
-    m_caller_handle = caller_handle;
+    m_lock_awaiter.set_resume_handle(caller_handle);
 
     std::unique_lock<std::mutex> lock(m_parent.m_lock);
-    m_lock.unlock();
 
+    if (m_timer_queue != nullptr) {
+        // armed under the cv lock, so an early timeout can't run before we're enqueued.
+        // if arming throws, nothing has changed yet and the caller still owns the lock.
+        auto state = m_timer_queue->make_timer_impl(m_timeout,
+                                                    std::chrono::nanoseconds::zero(),
+                                                    timeout_executor(),
+                                                    true,
+                                                    cv_timeout_callback(*this));
+
+        m_timeout_claim = &static_cast<timer_state<cv_timeout_callback>&>(*state).get_callable().claim_flag();
+        m_timer = timer(std::move(state));
+    }
+
+    m_lock.unlock();
     m_parent.m_awaiters.push_back(*this);
 }
 
-void cv_awaiter::resume() noexcept {
-    assert(static_cast<bool>(m_caller_handle));
-    assert(!m_caller_handle.done());
-    m_caller_handle();
+bool cv_awaiter::try_claim() noexcept {
+    if (m_timeout_claim == nullptr) {
+        return true;
+    }
+
+    return !m_timeout_claim->exchange(true, std::memory_order_acq_rel);
+}
+
+void cv_awaiter::on_timeout() noexcept {
+    // we own the awaiter now, a notifier that dequeued it in the meantime has dropped it.
+    {
+        std::unique_lock<std::mutex> lock(m_parent.m_lock);
+        m_parent.m_awaiters.remove(*this);
+        m_timed_out = true;
+    }
+
+    details::slist<async_lock_awaiter> awaiters;
+    awaiters.push_back(m_lock_awaiter);
+    m_lock_awaiter.m_parent.enqueue_awaiters(awaiters);
 }
 
 /*
@@ -51,11 +123,24 @@ void async_condition_variable::verify_await_params(const std::shared_ptr<executo
     }
 }
 
+void async_condition_variable::verify_await_for_params(const std::shared_ptr<timer_queue>& timer_queue,
+                                                       const std::shared_ptr<executor>& resume_executor,
+                                                       const scoped_async_lock& lock) {
+    if (!static_cast<bool>(timer_queue)) {
+        throw std::invalid_argument(details::consts::k_async_condition_variable_await_for_null_timer_queue_err_msg);
+    }
+
+    verify_await_params(resume_executor, lock);
+}
+
 lazy_result<void> async_condition_variable::await_impl(std::shared_ptr<executor> resume_executor, scoped_async_lock& lock) {
     co_await details::cv_awaiter(*this, lock);
     assert(!lock.owns_lock());
-    co_await resume_on(resume_executor);  // TODO: optimize this when get_current_executor is available
-    co_await lock.lock(resume_executor);
+
+    // we were notified and retried as a waiter of the async_lock, inside the thread of the notifier or of an unlocker.
+    // lock it from here and continue inside resume_executor.
+    auto guard = co_await lock.mutex()->lock_impl(std::move(resume_executor), true, false);
+    lock.swap(guard);
 }
 
 lazy_result<void> async_condition_variable::await(std::shared_ptr<executor> resume_executor, scoped_async_lock& lock) {
@@ -63,27 +148,100 @@ lazy_result<void> async_condition_variable::await(std::shared_ptr<executor> resu
     return await_impl(std::move(resume_executor), lock);
 }
 
-void async_condition_variable::notify_one() {
-    std::unique_lock<std::mutex> lock(m_lock);
-    const auto awaiter = m_awaiters.pop_front();
-    lock.unlock();
+lazy_result<std::cv_status> async_condition_variable::await_for_impl(std::shared_ptr<timer_queue> timer_queue,
+                                                                     std::shared_ptr<executor> resume_executor,
+                                                                     scoped_async_lock& lock,
+                                                                     std::chrono::nanoseconds timeout) {
+    const auto timed_out = co_await details::cv_awaiter(*this, lock, *timer_queue, std::max(timeout, std::chrono::nanoseconds(0)));
+    assert(!lock.owns_lock());
 
-    if (awaiter != nullptr) {
-        awaiter->resume();
-    }
+    auto guard = co_await lock.mutex()->lock_impl(std::move(resume_executor), true, false);
+    lock.swap(guard);
+
+    co_return timed_out ? std::cv_status::timeout : std::cv_status::no_timeout;
 }
 
-void async_condition_variable::notify_all() {
-    std::unique_lock<std::mutex> lock(m_lock);
-    auto awaiters = std::move(m_awaiters);
-    lock.unlock();
+lazy_result<std::cv_status> async_condition_variable::await_for(std::shared_ptr<timer_queue> timer_queue,
+                                                                std::shared_ptr<executor> resume_executor,
+                                                                scoped_async_lock& lock,
+                                                                std::chrono::nanoseconds timeout) {
+    verify_await_for_params(timer_queue, resume_executor, lock);
+    return await_for_impl(std::move(timer_queue), std::move(resume_executor), lock, timeout);
+}
+
+void async_condition_variable::move_to_lock_awaiters(details::slist<details::cv_awaiter>& awaiters) {
+    // wait morphing: notified awaiters are not resumed only to contend on the lock, they are queued on it instead.
+    // awaiters are grouped by the async_lock they wait on, every group is queued at once.
+    details::slist<details::async_lock_awaiter> group;
+    async_lock* group_lock = nullptr;
 
     while (true) {
         const auto awaiter = awaiters.pop_front();
         if (awaiter == nullptr) {
-            return;  // no more awaiters
+            break;
+        }
+
+        try {
+            awaiter->m_timer.cancel();
+        } catch (...) {
+            // the timer will fire, find the awaiter claimed and do nothing.
         }
 
-        awaiter->resume();
+        auto& lock_awaiter = awaiter->m_lock_awaiter;  // the cv_awaiter may be gone once its group is queued
+        if (group_lock != &lock_awaiter.m_parent) {
+            if (group_lock != nullptr) {
+                group_lock->enqueue_awaiters(group);
+            }
+
+            group_lock = &lock_awaiter.m_parent;
+        }
+
+        group.push_back(lock_awaiter);
     }
+
+    if (group_lock != nullptr) {
+        group_lock->enqueue_awaiters(group);
+    }
+}
+
+void async_condition_variable::notify_one() {
+    details::slist<details::cv_awaiter> awaiters;
+
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        while (true) {
+            const auto awaiter = m_awaiters.pop_front();
+            if (awaiter == nullptr) {
+                return;
+            }
+
+            // an awaiter whose timer claimed it is dropped, the timer resumes it.
+            if (awaiter->try_claim()) {
+                awaiters.push_back(*awaiter);
+                break;
+            }
+        }
+    }
+
+    move_to_lock_awaiters(awaiters);
+}
+
+void async_condition_variable::notify_all() {
+    details::slist<details::cv_awaiter> awaiters;
+
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        while (true) {
+            const auto awaiter = m_awaiters.pop_front();
+            if (awaiter == nullptr) {
+                break;
+            }
+
+            if (awaiter->try_claim()) {
+                awaiters.push_back(*awaiter);
+            }
+        }
+    }
+
+    move_to_lock_awaiters(awaiters);
 }
\ No newline at end of file
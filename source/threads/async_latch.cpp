@@ -0,0 +1,92 @@
+#include "concurrencpp/threads/constants.h"
+#include "concurrencpp/threads/async_latch.h"
+#include "concurrencpp/results/constants.h"
+#include "concurrencpp/errors.h"
+
+using concurrencpp::async_latch;
+using concurrencpp::details::async_latch_awaitable;
+
+/*
+    async_latch_awaitable
+*/
+
+async_latch_awaitable::async_latch_awaitable(async_latch& parent, std::shared_ptr<executor> resume_executor) noexcept :
+    m_parent(parent), m_resume_executor(std::move(resume_executor)), m_waiter(*m_resume_executor) {}
+
+bool async_latch_awaitable::await_ready() const noexcept {
+    return m_parent.try_wait();
+}
+
+bool async_latch_awaitable::await_suspend(coroutine_handle<void> caller_handle) {
+    m_waiter.set_caller_handle(caller_handle);
+    return m_parent.enqueue_waiter(m_waiter);
+}
+
+void async_latch_awaitable::await_resume() const {
+    if (m_waiter.interrupted()) {
+        throw errors::broken_task(consts::k_broken_task_exception_error_msg);
+    }
+}
+
+/*
+    async_latch
+*/
+
+async_latch::async_latch(size_t expected) noexcept : m_counter(expected) {}
+
+async_latch::~async_latch() noexcept {
+#ifdef CRCPP_DEBUG_MODE
+    std::unique_lock<std::mutex> lock(m_lock);
+    assert(m_waiters.empty() && "concurrencpp::async_latch is deleted while being used.");
+#endif
+}
+
+bool async_latch::enqueue_waiter(details::async_waiter& waiter) {
+    std::unique_lock<std::mutex> lock(m_lock);
+    if (m_counter.load(std::memory_order_acquire) == 0) {
+        return false;  // released between await_ready and now
+    }
+
+    m_waiters.push_back(waiter);
+    return true;
+}
+
+void async_latch::count_down(size_t update) {
+    auto counter = m_counter.load(std::memory_order_relaxed);
+    do {
+        if (update > counter) {
+            throw std::invalid_argument(details::consts::k_async_latch_count_down_invalid_update_err_msg);
+        }
+    } while (!m_counter.compare_exchange_weak(counter, counter - update, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+    if (counter != update || update == 0) {
+        return;  // the latch wasn't released by this call
+    }
+
+    std::unique_lock<std::mutex> lock(m_lock);
+    auto waiters = std::move(m_waiters);
+    lock.unlock();
+
+    details::async_waiter::resume_all(waiters);
+}
+
+bool async_latch::try_wait() const noexcept {
+    return m_counter.load(std::memory_order_acquire) == 0;
+}
+
+concurrencpp::details::async_latch_awaitable async_latch::wait(std::shared_ptr<executor> resume_executor) {
+    if (!static_cast<bool>(resume_executor)) {
+        throw std::invalid_argument(details::consts::k_async_latch_wait_null_resume_executor_err_msg);
+    }
+
+    return {*this, std::move(resume_executor)};
+}
+
+concurrencpp::details::async_latch_awaitable async_latch::arrive_and_wait(std::shared_ptr<executor> resume_executor, size_t update) {
+    if (!static_cast<bool>(resume_executor)) {
+        throw std::invalid_argument(details::consts::k_async_latch_wait_null_resume_executor_err_msg);
+    }
+
+    count_down(update);
+    return {*this, std::move(resume_executor)};
+}
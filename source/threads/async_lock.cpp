@@ -14,6 +14,8 @@ using concurrencpp::details::async_lock_awaiter;
 async_lock_awaiter::async_lock_awaiter(async_lock& parent, std::unique_lock<std::mutex>& lock) noexcept :
     m_parent(parent), m_lock(std::move(lock)) {}
 
+async_lock_awaiter::async_lock_awaiter(async_lock& parent) noexcept : m_parent(parent) {}
+
 void async_lock_awaiter::await_suspend(coroutine_handle<void> handle) {
     assert(static_cast<bool>(handle));
     assert(!handle.done());
@@ -26,6 +28,12 @@ void async_lock_awaiter::await_suspend(coroutine_handle<void> handle) {
     auto lock = std::move(m_lock);  // will unlock underlying lock
 }
 
+void async_lock_awaiter::set_resume_handle(coroutine_handle<void> handle) noexcept {
+    assert(static_cast<bool>(handle));
+    assert(!handle.done());
+    m_resume_handle = handle;
+}
+
 void async_lock_awaiter::retry() noexcept {
     m_resume_handle.resume();
 }
@@ -41,8 +49,11 @@ async_lock::~async_lock() noexcept {
 #endif
 }
 
-concurrencpp::lazy_result<scoped_async_lock> async_lock::lock_impl(std::shared_ptr<executor> resume_executor, bool with_raii_guard) {
-    auto resume_synchronously = true;  // indicates if the locking coroutine managed to lock the lock on first attempt
+concurrencpp::lazy_result<scoped_async_lock> async_lock::lock_impl(std::shared_ptr<executor> resume_executor,
+                                                                   bool with_raii_guard,
+                                                                   bool resume_inline_if_free) {
+    // indicates if the locking coroutine managed to lock the lock on first attempt and may continue in the calling thread
+    auto resume_synchronously = resume_inline_if_free;
 
     while (true) {
         std::unique_lock<std::mutex> lock(m_awaiter_lock);
@@ -88,6 +99,24 @@ concurrencpp::lazy_result<scoped_async_lock> async_lock::lock_impl(std::shared_p
     co_return scoped_async_lock(*this, std::defer_lock);
 }
 
+void async_lock::enqueue_awaiters(details::slist<details::async_lock_awaiter>& awaiters) {
+    std::unique_lock<std::mutex> lock(m_awaiter_lock);
+    if (m_locked) {
+        // the current owner (or the owners after it) will retry them on unlock
+        m_awaiters.append(std::move(awaiters));
+        return;
+    }
+
+    // nobody is going to unlock *this, so one awaiter has to be retried now. the rest are retried by the following unlocks.
+    const auto awaiter = awaiters.pop_front();
+    m_awaiters.append(std::move(awaiters));
+    lock.unlock();
+
+    if (awaiter != nullptr) {
+        awaiter->retry();
+    }
+}
+
 concurrencpp::lazy_result<scoped_async_lock> async_lock::lock(std::shared_ptr<executor> resume_executor) {
     if (!static_cast<bool>(resume_executor)) {
         throw std::invalid_argument(details::consts::k_async_lock_null_resume_executor_err_msg);
@@ -0,0 +1,123 @@
+#include "concurrencpp/threads/constants.h"
+#include "concurrencpp/threads/async_semaphore.h"
+#include "concurrencpp/results/constants.h"
+#include "concurrencpp/errors.h"
+
+#include <limits>
+#include <algorithm>
+
+using concurrencpp::async_semaphore;
+using concurrencpp::details::async_semaphore_awaitable;
+
+/*
+    async_semaphore_awaitable
+*/
+
+async_semaphore_awaitable::async_semaphore_awaitable(async_semaphore& parent, std::shared_ptr<executor> resume_executor) noexcept :
+    m_parent(parent), m_resume_executor(std::move(resume_executor)), m_waiter(*m_resume_executor) {}
+
+bool async_semaphore_awaitable::await_ready() noexcept {
+    // reserves a permit, or a place in line if none is available.
+    return m_parent.m_count.fetch_sub(1, std::memory_order_acq_rel) > 0;
+}
+
+bool async_semaphore_awaitable::await_suspend(coroutine_handle<void> caller_handle) {
+    m_waiter.set_caller_handle(caller_handle);
+    return m_parent.enqueue_waiter(m_waiter);
+}
+
+void async_semaphore_awaitable::await_resume() {
+    if (!m_waiter.interrupted()) {
+        return;
+    }
+
+    // the permit was granted to us, but the resume executor couldn't schedule us. give it back before throwing.
+    m_parent.release(1);
+    throw errors::broken_task(consts::k_broken_task_exception_error_msg);
+}
+
+/*
+    async_semaphore
+*/
+
+async_semaphore::async_semaphore(size_t initial_count) : m_count(static_cast<intptr_t>(initial_count)) {
+    if (initial_count > static_cast<size_t>(std::numeric_limits<intptr_t>::max())) {
+        throw std::invalid_argument(details::consts::k_async_semaphore_invalid_count_err_msg);
+    }
+}
+
+async_semaphore::~async_semaphore() noexcept {
+#ifdef CRCPP_DEBUG_MODE
+    std::unique_lock<std::mutex> lock(m_lock);
+    assert(m_waiters.empty() && "concurrencpp::async_semaphore is deleted while being used.");
+#endif
+}
+
+bool async_semaphore::enqueue_waiter(details::async_waiter& waiter) {
+    std::unique_lock<std::mutex> lock(m_lock);
+    if (m_pending_grants != 0) {
+        // a releaser has already counted us in, take the permit without suspending.
+        --m_pending_grants;
+        return false;
+    }
+
+    m_waiters.push_back(waiter);
+    return true;
+}
+
+concurrencpp::details::async_semaphore_awaitable async_semaphore::acquire(std::shared_ptr<executor> resume_executor) {
+    if (!static_cast<bool>(resume_executor)) {
+        throw std::invalid_argument(details::consts::k_async_semaphore_acquire_null_resume_executor_err_msg);
+    }
+
+    return {*this, std::move(resume_executor)};
+}
+
+bool async_semaphore::try_acquire() noexcept {
+    auto count = m_count.load(std::memory_order_relaxed);
+    while (count > 0) {
+        if (m_count.compare_exchange_weak(count, count - 1, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void async_semaphore::release(size_t count) {
+    if (count == 0) {
+        return;
+    }
+
+    if (count > static_cast<size_t>(std::numeric_limits<intptr_t>::max())) {
+        throw std::invalid_argument(details::consts::k_async_semaphore_invalid_count_err_msg);
+    }
+
+    const auto before = m_count.fetch_add(static_cast<intptr_t>(count), std::memory_order_acq_rel);
+    if (before >= 0) {
+        return;  // nobody is waiting
+    }
+
+    auto to_wake = std::min(count, static_cast<size_t>(-before));
+    details::slist<details::async_waiter> waiters;
+
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        for (; to_wake != 0; --to_wake) {
+            const auto waiter = m_waiters.pop_front();
+            if (waiter == nullptr) {
+                break;
+            }
+
+            waiters.push_back(*waiter);
+        }
+
+        m_pending_grants += to_wake;
+    }
+
+    details::async_waiter::resume_all(waiters);
+}
+
+size_t async_semaphore::approx_available() const noexcept {
+    return static_cast<size_t>(std::max<intptr_t>(m_count.load(std::memory_order_relaxed), 0));
+}
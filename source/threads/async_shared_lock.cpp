@@ -0,0 +1,345 @@
+#include "concurrencpp/threads/constants.h"
+#include "concurrencpp/threads/async_shared_lock.h"
+#include "concurrencpp/results/impl/consumer_context.h"
+#include "concurrencpp/executors/executor.h"
+
+#include <vector>
+
+using concurrencpp::task;
+using concurrencpp::async_shared_lock;
+using concurrencpp::scoped_async_shared_lock;
+using concurrencpp::scoped_async_exclusive_lock;
+using concurrencpp::details::async_shared_lock_awaiter;
+
+/*
+    async_shared_lock_awaiter
+*/
+
+async_shared_lock_awaiter::async_shared_lock_awaiter(async_shared_lock& parent,
+                                                     std::unique_lock<std::mutex>& lock,
+                                                     executor& resume_executor,
+                                                     bool shared) noexcept :
+    m_parent(parent),
+    m_lock(std::move(lock)), m_resume_executor(resume_executor), m_shared(shared) {}
+
+void async_shared_lock_awaiter::await_suspend(coroutine_handle<void> handle) {
+    assert(static_cast<bool>(handle));
+    assert(!handle.done());
+    assert(!static_cast<bool>(m_resume_handle));
+    assert(m_lock.owns_lock());
+
+    m_resume_handle = handle;
+
+    if (m_shared) {
+        m_parent.m_waiting_readers.push_back(*this);
+        ++m_parent.m_waiting_reader_count;
+    } else {
+        m_parent.m_waiting_writers.push_back(*this);
+    }
+
+    auto lock = std::move(m_lock);  // will unlock underlying lock
+}
+
+void async_shared_lock_awaiter::await_resume() {
+    if (!m_interrupted) {
+        return;
+    }
+
+    // ownership was handed to us, but the resume executor couldn't schedule us. pass it on before throwing.
+    if (m_shared) {
+        m_parent.unlock_shared();
+    } else {
+        m_parent.unlock();
+    }
+
+    throw errors::broken_task(details::consts::k_broken_task_exception_error_msg);
+}
+
+task async_shared_lock_awaiter::make_resume_task() noexcept {
+    return details::await_via_functor {m_resume_handle, &m_interrupted};
+}
+
+void async_shared_lock_awaiter::resume() {
+    m_resume_executor.enqueue(make_resume_task());
+}
+
+/*
+    async_shared_lock
+*/
+
+async_shared_lock::~async_shared_lock() noexcept {
+#ifdef CRCPP_DEBUG_MODE
+    std::unique_lock<std::mutex> lock(m_awaiter_lock);
+    assert(!m_writer && m_reader_count == 0 && "async_shared_lock is destroyed while it's locked.");
+#endif
+}
+
+void async_shared_lock::resume_readers(details::slist<details::async_shared_lock_awaiter>& readers) {
+    std::vector<task> batch;
+    executor* batch_executor = nullptr;
+
+    const auto flush = [&batch, &batch_executor] {
+        if (batch.empty()) {
+            return;
+        }
+
+        try {
+            batch_executor->enqueue(std::span<task>(batch));
+        } catch (...) {
+            // tasks that weren't scheduled resume their coroutines as interrupted when destroyed.
+        }
+
+        batch.clear();
+    };
+
+    while (true) {
+        const auto reader = readers.pop_front();
+        if (reader == nullptr) {
+            break;
+        }
+
+        if (batch_executor != &reader->m_resume_executor) {
+            flush();
+            batch_executor = &reader->m_resume_executor;
+        }
+
+        batch.emplace_back(reader->make_resume_task());
+    }
+
+    flush();
+}
+
+concurrencpp::lazy_result<scoped_async_shared_lock> async_shared_lock::lock_shared_impl(std::shared_ptr<executor> resume_executor) {
+    std::unique_lock<std::mutex> lock(m_awaiter_lock);
+    if (!m_writer && m_waiting_writers.empty()) {
+        ++m_reader_count;
+        lock.unlock();
+        co_return scoped_async_shared_lock(*this, std::adopt_lock);
+    }
+
+    // shared ownership is granted by the releasing writer before we're resumed.
+    co_await details::async_shared_lock_awaiter(*this, lock, *resume_executor, true);
+    co_return scoped_async_shared_lock(*this, std::adopt_lock);
+}
+
+concurrencpp::lazy_result<scoped_async_exclusive_lock> async_shared_lock::lock_impl(std::shared_ptr<executor> resume_executor) {
+    std::unique_lock<std::mutex> lock(m_awaiter_lock);
+    if (!m_writer && m_reader_count == 0) {
+        m_writer = true;
+        lock.unlock();
+        co_return scoped_async_exclusive_lock(*this, std::adopt_lock);
+    }
+
+    // exclusive ownership is granted by the last releasing owner before we're resumed.
+    co_await details::async_shared_lock_awaiter(*this, lock, *resume_executor, false);
+    co_return scoped_async_exclusive_lock(*this, std::adopt_lock);
+}
+
+concurrencpp::lazy_result<scoped_async_shared_lock> async_shared_lock::lock_shared(std::shared_ptr<executor> resume_executor) {
+    if (!static_cast<bool>(resume_executor)) {
+        throw std::invalid_argument(details::consts::k_async_shared_lock_lock_shared_null_resume_executor_err_msg);
+    }
+
+    return lock_shared_impl(std::move(resume_executor));
+}
+
+concurrencpp::lazy_result<bool> async_shared_lock::try_lock_shared() {
+    std::unique_lock<std::mutex> lock(m_awaiter_lock);
+    if (m_writer || !m_waiting_writers.empty()) {
+        co_return false;
+    }
+
+    ++m_reader_count;
+    co_return true;
+}
+
+void async_shared_lock::unlock_shared() {
+    std::unique_lock<std::mutex> lock(m_awaiter_lock);
+    if (m_reader_count == 0) {
+        lock.unlock();
+        throw std::system_error(static_cast<int>(std::errc::operation_not_permitted),
+                                std::system_category(),
+                                details::consts::k_async_shared_lock_unlock_shared_invalid_lock_err_msg);
+    }
+
+    assert(!m_writer);
+    --m_reader_count;
+
+    if (m_reader_count != 0) {
+        return;
+    }
+
+    const auto writer = m_waiting_writers.pop_front();
+    if (writer == nullptr) {
+        return;
+    }
+
+    m_writer = true;
+    lock.unlock();
+
+    try {
+        writer->resume();
+    } catch (...) {
+        // ~await_via_functor resumed the writer as interrupted, which released the lock.
+    }
+}
+
+concurrencpp::lazy_result<scoped_async_exclusive_lock> async_shared_lock::lock(std::shared_ptr<executor> resume_executor) {
+    if (!static_cast<bool>(resume_executor)) {
+        throw std::invalid_argument(details::consts::k_async_shared_lock_lock_null_resume_executor_err_msg);
+    }
+
+    return lock_impl(std::move(resume_executor));
+}
+
+concurrencpp::lazy_result<bool> async_shared_lock::try_lock() {
+    std::unique_lock<std::mutex> lock(m_awaiter_lock);
+    if (m_writer || m_reader_count != 0) {
+        co_return false;
+    }
+
+    m_writer = true;
+    co_return true;
+}
+
+void async_shared_lock::unlock() {
+    std::unique_lock<std::mutex> lock(m_awaiter_lock);
+    if (!m_writer) {
+        lock.unlock();
+        throw std::system_error(static_cast<int>(std::errc::operation_not_permitted),
+                                std::system_category(),
+                                details::consts::k_async_shared_lock_unlock_invalid_lock_err_msg);
+    }
+
+    assert(m_reader_count == 0);
+
+    // writers go first, readers are admitted as a group once no writer is waiting.
+    const auto writer = m_waiting_writers.pop_front();
+    if (writer != nullptr) {
+        lock.unlock();
+
+        try {
+            writer->resume();
+        } catch (...) {
+            // ~await_via_functor resumed the writer as interrupted, which released the lock.
+        }
+
+        return;
+    }
+
+    m_writer = false;
+
+    if (m_waiting_reader_count == 0) {
+        return;
+    }
+
+    m_reader_count = std::exchange(m_waiting_reader_count, 0);
+    auto readers = std::move(m_waiting_readers);
+    lock.unlock();
+
+    resume_readers(readers);
+}
+
+/*
+    scoped_async_shared_lock
+*/
+
+scoped_async_shared_lock::scoped_async_shared_lock(scoped_async_shared_lock&& rhs) noexcept :
+    m_lock(std::exchange(rhs.m_lock, nullptr)), m_owns(std::exchange(rhs.m_owns, false)) {}
+
+scoped_async_shared_lock::scoped_async_shared_lock(async_shared_lock& lock, std::defer_lock_t) noexcept :
+    m_lock(&lock), m_owns(false) {}
+
+scoped_async_shared_lock::scoped_async_shared_lock(async_shared_lock& lock, std::adopt_lock_t) noexcept :
+    m_lock(&lock), m_owns(true) {}
+
+scoped_async_shared_lock::~scoped_async_shared_lock() noexcept {
+    if (m_owns && m_lock != nullptr) {
+        m_lock->unlock_shared();
+    }
+}
+
+void scoped_async_shared_lock::unlock() {
+    if (!m_owns) {
+        throw std::system_error(static_cast<int>(std::errc::operation_not_permitted),
+                                std::system_category(),
+                                details::consts::k_scoped_async_shared_lock_unlock_invalid_lock_err_msg);
+    } else if (m_lock != nullptr) {
+        m_lock->unlock_shared();
+        m_owns = false;
+    }
+}
+
+bool scoped_async_shared_lock::owns_lock() const noexcept {
+    return m_owns;
+}
+
+scoped_async_shared_lock::operator bool() const noexcept {
+    return owns_lock();
+}
+
+void scoped_async_shared_lock::swap(scoped_async_shared_lock& rhs) noexcept {
+    std::swap(m_lock, rhs.m_lock);
+    std::swap(m_owns, rhs.m_owns);
+}
+
+async_shared_lock* scoped_async_shared_lock::release() noexcept {
+    m_owns = false;
+    return std::exchange(m_lock, nullptr);
+}
+
+async_shared_lock* scoped_async_shared_lock::mutex() const noexcept {
+    return m_lock;
+}
+
+/*
+    scoped_async_exclusive_lock
+*/
+
+scoped_async_exclusive_lock::scoped_async_exclusive_lock(scoped_async_exclusive_lock&& rhs) noexcept :
+    m_lock(std::exchange(rhs.m_lock, nullptr)), m_owns(std::exchange(rhs.m_owns, false)) {}
+
+scoped_async_exclusive_lock::scoped_async_exclusive_lock(async_shared_lock& lock, std::defer_lock_t) noexcept :
+    m_lock(&lock), m_owns(false) {}
+
+scoped_async_exclusive_lock::scoped_async_exclusive_lock(async_shared_lock& lock, std::adopt_lock_t) noexcept :
+    m_lock(&lock), m_owns(true) {}
+
+scoped_async_exclusive_lock::~scoped_async_exclusive_lock() noexcept {
+    if (m_owns && m_lock != nullptr) {
+        m_lock->unlock();
+    }
+}
+
+void scoped_async_exclusive_lock::unlock() {
+    if (!m_owns) {
+        throw std::system_error(static_cast<int>(std::errc::operation_not_permitted),
+                                std::system_category(),
+                                details::consts::k_scoped_async_exclusive_lock_unlock_invalid_lock_err_msg);
+    } else if (m_lock != nullptr) {
+        m_lock->unlock();
+        m_owns = false;
+    }
+}
+
+bool scoped_async_exclusive_lock::owns_lock() const noexcept {
+    return m_owns;
+}
+
+scoped_async_exclusive_lock::operator bool() const noexcept {
+    return owns_lock();
+}
+
+void scoped_async_exclusive_lock::swap(scoped_async_exclusive_lock& rhs) noexcept {
+    std::swap(m_lock, rhs.m_lock);
+    std::swap(m_owns, rhs.m_owns);
+}
+
+async_shared_lock* scoped_async_exclusive_lock::release() noexcept {
+    m_owns = false;
+    return std::exchange(m_lock, nullptr);
+}
+
+async_shared_lock* scoped_async_exclusive_lock::mutex() const noexcept {
+    return m_lock;
+}
@@ -0,0 +1,71 @@
+#include "concurrencpp/threads/impl/async_waiter.h"
+#include "concurrencpp/results/impl/consumer_context.h"
+#include "concurrencpp/executors/executor.h"
+
+#include <vector>
+
+using concurrencpp::task;
+using concurrencpp::details::async_waiter;
+
+async_waiter::async_waiter(executor& resume_executor) noexcept : m_resume_executor(resume_executor) {}
+
+void async_waiter::set_caller_handle(coroutine_handle<void> caller_handle) noexcept {
+    assert(static_cast<bool>(caller_handle));
+    assert(!caller_handle.done());
+    m_caller_handle = caller_handle;
+}
+
+bool async_waiter::interrupted() const noexcept {
+    return m_interrupted;
+}
+
+task async_waiter::make_resume_task() noexcept {
+    return await_via_functor {m_caller_handle, &m_interrupted};
+}
+
+void async_waiter::resume() noexcept {
+    try {
+        m_resume_executor.enqueue(make_resume_task());
+    } catch (...) {
+        // ~await_via_functor resumed the coroutine as interrupted.
+    }
+}
+
+void async_waiter::resume_all(slist<async_waiter>& waiters) noexcept {
+    std::vector<task> batch;
+    executor* batch_executor = nullptr;
+
+    const auto flush = [&batch, &batch_executor]() noexcept {
+        if (batch.empty()) {
+            return;
+        }
+
+        try {
+            batch_executor->enqueue(std::span<task>(batch));
+        } catch (...) {
+            // tasks that weren't scheduled resume their coroutines as interrupted when destroyed.
+        }
+
+        batch.clear();
+    };
+
+    while (true) {
+        const auto waiter = waiters.pop_front();
+        if (waiter == nullptr) {
+            break;
+        }
+
+        if (batch_executor != &waiter->m_resume_executor) {
+            flush();
+            batch_executor = &waiter->m_resume_executor;
+        }
+
+        try {
+            batch.emplace_back(waiter->make_resume_task());
+        } catch (...) {
+            // the unscheduled task resumed the coroutine as interrupted when it was destroyed.
+        }
+    }
+
+    flush();
+}
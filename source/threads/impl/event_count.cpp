@@ -0,0 +1,50 @@
+#include "concurrencpp/threads/impl/event_count.h"
+
+#include <cassert>
+
+using concurrencpp::details::event_count;
+
+bool event_count::has_waiters() const noexcept {
+    // pairs with the read-modify-write of prepare_wait: either the waiter sees the producer's change to its condition
+    // or the producer sees the waiter.
+    return (m_state.load(std::memory_order_seq_cst) & k_waiters_mask) != 0;
+}
+
+event_count::key_type event_count::prepare_wait() noexcept {
+    const auto state = m_state.fetch_add(1, std::memory_order_seq_cst);
+    assert((state & k_waiters_mask) != k_waiters_mask);
+    return static_cast<key_type>(state >> k_epoch_shift);
+}
+
+void event_count::cancel_wait() noexcept {
+    [[maybe_unused]] const auto state = m_state.fetch_sub(1, std::memory_order_seq_cst);
+    assert((state & k_waiters_mask) != 0);
+}
+
+void event_count::wait(key_type key) noexcept {
+    auto state = m_state.load(std::memory_order_seq_cst);
+    while (static_cast<key_type>(state >> k_epoch_shift) == key) {
+        m_state.wait(state, std::memory_order_seq_cst);
+        state = m_state.load(std::memory_order_seq_cst);
+    }
+
+    cancel_wait();
+}
+
+void event_count::notify_one() noexcept {
+    if (!has_waiters()) {
+        return;
+    }
+
+    m_state.fetch_add(k_epoch_increment, std::memory_order_seq_cst);
+    m_state.notify_one();
+}
+
+void event_count::notify_all() noexcept {
+    if (!has_waiters()) {
+        return;
+    }
+
+    m_state.fetch_add(k_epoch_increment, std::memory_order_seq_cst);
+    m_state.notify_all();
+}
@@ -4,6 +4,12 @@
 
 #include <atomic>
 
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#    include <immintrin.h>
+#endif
+
 #include "concurrencpp/runtime/constants.h"
 
 using concurrencpp::details::thread;
@@ -44,10 +50,28 @@ size_t thread::hardware_concurrency() noexcept {
     return (hc != 0) ? hc : consts::k_default_number_of_cores;
 }
 
+void thread::cpu_relax() noexcept {
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield" ::: "memory");
+#else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
 #ifdef CRCPP_WIN_OS
 
 #    include <Windows.h>
 
+bool thread::pin_current_to_core(size_t core) noexcept {
+    if (core >= sizeof(DWORD_PTR) * 8) {
+        return false;
+    }
+
+    return ::SetThreadAffinityMask(::GetCurrentThread(), DWORD_PTR(1) << core) != 0;
+}
+
 void thread::set_name(std::string_view name) noexcept {
     const std::wstring utf16_name(name.begin(),
                                   name.end());  // concurrencpp strings are always ASCII (english only)
@@ -62,14 +86,34 @@ void thread::set_name(std::string_view name) noexcept {
     ::pthread_setname_np(::pthread_self(), name.data());
 }
 
+bool thread::pin_current_to_core(size_t) noexcept {
+    return false;
+}
+
 #elif defined(CRCPP_UNIX_OS)
 
 #    include <pthread.h>
+#    include <sched.h>
 
 void thread::set_name(std::string_view name) noexcept {
     ::pthread_setname_np(::pthread_self(), name.data());
 }
 
+bool thread::pin_current_to_core(size_t core) noexcept {
+#    if defined(__linux__)
+    if (core >= CPU_SETSIZE) {
+        return false;
+    }
+
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(core, &cpu_set);
+    return ::pthread_setaffinity_np(::pthread_self(), sizeof(cpu_set), &cpu_set) == 0;
+#    else
+    return false;
+#    endif
+}
+
 #elif defined(CRCPP_MAC_OS)
 
 #    include <pthread.h>
@@ -78,4 +122,8 @@ void thread::set_name(std::string_view name) noexcept {
     ::pthread_setname_np(name.data());
 }
 
+bool thread::pin_current_to_core(size_t) noexcept {
+    return false;  // macOS only supports affinity hints between threads, not binding to a core
+}
+
 #endif
@@ -0,0 +1,453 @@
+#include "concurrencpp/timers/impl/timer_wheel.h"
+
+#include "concurrencpp/executors/executor.h"
+
+#include <bit>
+#include <span>
+#include <exception>
+#include <algorithm>
+#include <functional>
+
+#include <cassert>
+
+using concurrencpp::details::timer_wheel;
+using concurrencpp::details::timer_wheel_base;
+using concurrencpp::details::timer_wheel_node;
+using concurrencpp::details::timer_state_base;
+
+/*
+    timer_wheel_base
+*/
+
+timer_wheel_base::timer_wheel_base(time_point origin) noexcept : m_origin(origin) {}
+
+timer_wheel_base::~timer_wheel_base() noexcept {
+    assert(empty() && "concurrencpp::details::timer_wheel_base - destroyed while nodes are still linked.");
+}
+
+uint64_t timer_wheel_base::deadline_tick(time_point deadline) const noexcept {
+    if (deadline <= m_origin) {
+        return 0;
+    }
+
+    // rounded up, a node never expires before its deadline.
+    const auto diff = (deadline - m_origin).count();
+    const auto tick = k_tick.count();
+    return static_cast<uint64_t>((diff + tick - 1) / tick);
+}
+
+uint64_t timer_wheel_base::elapsed_ticks(time_point now) const noexcept {
+    if (now <= m_origin) {
+        return 0;
+    }
+
+    return static_cast<uint64_t>((now - m_origin).count() / k_tick.count());
+}
+
+uint64_t timer_wheel_base::fire_tick(const timer_wheel_node& node, uint64_t min_tick) const noexcept {
+    const auto tick = std::max(deadline_tick(node.get_deadline()), min_tick);
+    const auto slack_ticks = static_cast<uint64_t>(node.get_slack() / k_tick);
+
+    // rounding up to a multiple of the largest power of two that fits in the slack delays the node by at most its slack,
+    // and makes nodes with overlapping windows agree on the same tick.
+    const auto alignment = std::bit_floor(slack_ticks + 1);
+    return (tick + alignment - 1) & ~(alignment - 1);
+}
+
+bool timer_wheel_base::owns_slot(const timer_wheel_node* const* slot) const noexcept {
+    const std::less<const timer_wheel_node* const*> less;
+    return !less(slot, m_slots.data()) && less(slot, m_slots.data() + m_slots.size());
+}
+
+void timer_wheel_base::set_occupied(const timer_wheel_node* const* slot, bool occupied) noexcept {
+    if (!owns_slot(slot)) {
+        return;  // the overflow slot and external node lists have no bit
+    }
+
+    const auto index = static_cast<size_t>(slot - static_cast<const timer_wheel_node* const*>(m_slots.data()));
+    const auto bit = uint64_t(1) << (index % 64);
+
+    if (occupied) {
+        m_occupied[index / 64] |= bit;
+    } else {
+        m_occupied[index / 64] &= ~bit;
+    }
+}
+
+void timer_wheel_base::link(timer_wheel_node& node, timer_wheel_node*& slot) noexcept {
+    assert(node.m_wheel_slot == nullptr);
+
+    node.m_wheel_prev = nullptr;
+    node.m_wheel_next = slot;
+    node.m_wheel_slot = &slot;
+
+    if (slot != nullptr) {
+        slot->m_wheel_prev = &node;
+    }
+
+    slot = &node;
+    set_occupied(&slot, true);
+}
+
+void timer_wheel_base::unlink(timer_wheel_node& node) noexcept {
+    assert(node.m_wheel_slot != nullptr);
+    auto& slot = *node.m_wheel_slot;
+
+    if (node.m_wheel_prev != nullptr) {
+        node.m_wheel_prev->m_wheel_next = node.m_wheel_next;
+    } else {
+        slot = node.m_wheel_next;
+    }
+
+    if (node.m_wheel_next != nullptr) {
+        node.m_wheel_next->m_wheel_prev = node.m_wheel_prev;
+    }
+
+    if (slot == nullptr) {
+        set_occupied(&slot, false);
+    }
+
+    node.m_wheel_prev = nullptr;
+    node.m_wheel_next = nullptr;
+    node.m_wheel_slot = nullptr;
+}
+
+void timer_wheel_base::place(timer_wheel_node& node, uint64_t min_tick) noexcept {
+    const auto tick = fire_tick(node, min_tick);
+    assert(tick >= m_current_tick);
+
+    for (size_t level = 0; level < k_levels; level++) {
+        const auto upper_shift = k_slot_bits * (level + 1);
+        if ((tick >> upper_shift) != (m_current_tick >> upper_shift)) {
+            continue;
+        }
+
+        const auto slot = (tick >> (k_slot_bits * level)) & (k_slots - 1);
+        link(node, m_slots[level * k_slots + slot]);
+        return;
+    }
+
+    link(node, m_overflow);
+}
+
+timer_wheel_node* timer_wheel_base::detach(timer_wheel_node*& slot) noexcept {
+    const auto head = slot;
+    slot = nullptr;
+    set_occupied(&slot, false);
+    return head;
+}
+
+void timer_wheel_base::splice(timer_wheel_node*& slot, node_list& list, timer_wheel_node*& tail) noexcept {
+    auto head = detach(slot);
+
+    while (head != nullptr) {
+        auto& node = *head;
+        head = node.m_wheel_next;
+
+        node.m_wheel_prev = tail;
+        node.m_wheel_next = nullptr;
+        node.m_wheel_slot = &list;
+
+        if (tail != nullptr) {
+            tail->m_wheel_next = &node;
+        } else {
+            list = &node;
+        }
+
+        tail = &node;
+
+        assert(m_size != 0);
+        --m_size;
+    }
+}
+
+void timer_wheel_base::cascade(timer_wheel_node*& slot) noexcept {
+    auto head = detach(slot);
+
+    while (head != nullptr) {
+        auto& node = *head;
+        head = node.m_wheel_next;
+        node.m_wheel_slot = nullptr;
+        place(node, m_current_tick);
+    }
+}
+
+void timer_wheel_base::advance_to(uint64_t tick) noexcept {
+    assert(tick >= m_current_tick);
+
+    const auto previous_tick = m_current_tick;
+    m_current_tick = tick;
+
+    // tick is never past a non-empty slot, so only the slots we enter need to be cascaded, from the top level down.
+    const auto top_shift = k_slot_bits * k_levels;
+    if ((previous_tick >> top_shift) != (tick >> top_shift)) {
+        cascade(m_overflow);
+    }
+
+    for (size_t level = k_levels - 1; level != 0; --level) {
+        const auto shift = k_slot_bits * level;
+        if ((previous_tick >> shift) != (tick >> shift)) {
+            cascade(m_slots[level * k_slots + ((tick >> shift) & (k_slots - 1))]);
+        }
+    }
+}
+
+size_t timer_wheel_base::next_occupied_slot(size_t level, size_t from) const noexcept {
+    for (auto slot = from; slot < k_slots;) {
+        const auto index = level * k_slots + slot;
+        const auto word = m_occupied[index / 64] >> (index % 64);
+        if (word != 0) {
+            return slot + static_cast<size_t>(std::countr_zero(word));
+        }
+
+        slot += 64 - (index % 64);
+    }
+
+    return k_slots;
+}
+
+uint64_t timer_wheel_base::next_event_tick() const noexcept {
+    assert(!empty());
+
+    // a lower level always has an earlier event than a higher one, if it has any.
+    for (size_t level = 0; level < k_levels; level++) {
+        const auto shift = k_slot_bits * level;
+        const auto current_slot = static_cast<size_t>((m_current_tick >> shift) & (k_slots - 1));
+        const auto slot = next_occupied_slot(level, (level == 0) ? current_slot : current_slot + 1);
+        if (slot == k_slots) {
+            continue;
+        }
+
+        const auto upper_shift = shift + k_slot_bits;
+        return ((m_current_tick >> upper_shift) << upper_shift) | (uint64_t(slot) << shift);
+    }
+
+    // only the overflow slot is occupied, wake up when the top level wraps around.
+    const auto top_shift = k_slot_bits * k_levels;
+    return ((m_current_tick >> top_shift) + 1) << top_shift;
+}
+
+void timer_wheel_base::insert(timer_wheel_node& node) noexcept {
+    ++m_size;
+    place(node, m_current_tick);
+}
+
+void timer_wheel_base::reinsert(timer_wheel_node& node) noexcept {
+    ++m_size;
+    place(node, m_current_tick + 1);
+}
+
+void timer_wheel_base::erase(timer_wheel_node& node) noexcept {
+    if (node.m_wheel_slot == nullptr) {
+        return;
+    }
+
+    if (owns_slot(node.m_wheel_slot) || node.m_wheel_slot == &m_overflow) {
+        assert(m_size != 0);
+        --m_size;
+    }
+
+    unlink(node);
+}
+
+void timer_wheel_base::expire(time_point now, node_list& expired) noexcept {
+    const auto target_tick = elapsed_ticks(now);
+
+    auto tail = expired;
+    while (tail != nullptr && tail->m_wheel_next != nullptr) {
+        tail = tail->m_wheel_next;
+    }
+
+    while (!empty()) {
+        splice(m_slots[m_current_tick & (k_slots - 1)], expired, tail);
+
+        if (m_current_tick >= target_tick || empty()) {
+            break;
+        }
+
+        advance_to(std::min(next_event_tick(), target_tick));
+    }
+
+    if (empty()) {
+        m_current_tick = std::max(m_current_tick, target_tick);
+    }
+}
+
+void timer_wheel_base::expire_all(node_list& list) noexcept {
+    auto tail = list;
+    while (tail != nullptr && tail->m_wheel_next != nullptr) {
+        tail = tail->m_wheel_next;
+    }
+
+    for (auto& slot : m_slots) {
+        splice(slot, list, tail);
+    }
+
+    splice(m_overflow, list, tail);
+    assert(empty());
+}
+
+timer_wheel_node* timer_wheel_base::pop_front(node_list& list) noexcept {
+    const auto node = list;
+    if (node == nullptr) {
+        return nullptr;
+    }
+
+    list = node->m_wheel_next;
+    if (list != nullptr) {
+        list->m_wheel_prev = nullptr;
+    }
+
+    node->m_wheel_prev = nullptr;
+    node->m_wheel_next = nullptr;
+    node->m_wheel_slot = nullptr;
+    return node;
+}
+
+timer_wheel_base::time_point timer_wheel_base::next_deadline(time_point now) const noexcept {
+    if (empty()) {
+        return now + std::chrono::hours(24);
+    }
+
+    return m_origin + next_event_tick() * k_tick;
+}
+
+/*
+    timer_wheel
+*/
+
+timer_wheel::timer_wheel(time_point origin, std::atomic_size_t* inline_overruns) noexcept :
+    m_wheel(origin), m_inline_overruns(inline_overruns) {}
+
+timer_wheel::~timer_wheel() noexcept {
+    timer_wheel_base::node_list timers = nullptr;
+    m_wheel.expire_all(timers);
+
+    while (const auto node = timer_wheel_base::pop_front(timers)) {
+        release(to_timer(*node));
+    }
+}
+
+timer_state_base& timer_wheel::to_timer(timer_wheel_node& node) noexcept {
+    return static_cast<timer_state_base&>(node);
+}
+
+void timer_wheel::release(timer_state_base& timer) noexcept {
+    assert(!timer.linked());
+    auto ref = std::move(timer.m_wheel_ref);  // might destroy the timer, don't touch it afterwards
+}
+
+timer_wheel::fire_batch& timer_wheel::batch_of(executor& target) {
+    // a handful of executors at most are involved in a single wake-up, a linear search is cheapest.
+    for (size_t i = 0; i < m_batch_count; i++) {
+        if (m_batches[i].target == &target) {
+            return m_batches[i];
+        }
+    }
+
+    if (m_batch_count == m_batches.size()) {
+        m_batches.emplace_back();
+    }
+
+    auto& batch = m_batches[m_batch_count++];
+    batch.target = &target;
+    return batch;
+}
+
+void timer_wheel::dispatch_batches() {
+    std::exception_ptr error;
+
+    for (size_t i = 0; i < m_batch_count; i++) {
+        auto& batch = m_batches[i];
+
+        try {
+            batch.target->enqueue(std::span<concurrencpp::task>(batch.tasks));
+        } catch (...) {
+            if (!static_cast<bool>(error)) {
+                error = std::current_exception();
+            }
+        }
+
+        batch.target = nullptr;
+        batch.tasks.clear();
+    }
+
+    m_batch_count = 0;
+
+    if (static_cast<bool>(error)) {
+        std::rethrow_exception(error);
+    }
+}
+
+void timer_wheel::add(timer_ptr timer) {
+    assert(static_cast<bool>(timer));
+    assert(!timer->linked());
+
+    auto& state = *timer;
+    state.m_wheel_ref = std::move(timer);
+    m_wheel.insert(state);
+}
+
+void timer_wheel::remove(const timer_ptr& timer) noexcept {
+    assert(static_cast<bool>(timer));
+
+    if (!timer->linked()) {
+        // the timer was already released by the wheel when it was fired.
+        assert(timer->is_oneshot() || timer->cancelled());
+        return;
+    }
+
+    m_wheel.erase(*timer);
+    release(*timer);
+}
+
+timer_wheel::time_point timer_wheel::process_timers(time_point now) {
+    timer_wheel_base::node_list expired = nullptr;
+    m_wheel.expire(now, expired);
+
+    try {
+        while (const auto node = timer_wheel_base::pop_front(expired)) {
+            auto& timer = to_timer(*node);
+
+            if (timer.cancelled()) {
+                release(timer);
+                continue;
+            }
+
+            if (timer.is_inline()) {
+                const auto within_budget = timer.fire_inline();
+                if (!within_budget && m_inline_overruns != nullptr) {
+                    m_inline_overruns->fetch_add(1, std::memory_order_relaxed);
+                }
+            } else {
+                try {
+                    batch_of(*timer.m_executor).tasks.emplace_back(timer.fire());
+                } catch (...) {
+                    release(timer);
+
+                    // the rest are still due, they're fired by the next call.
+                    while (const auto rest = timer_wheel_base::pop_front(expired)) {
+                        m_wheel.insert(*rest);
+                    }
+
+                    throw;
+                }
+            }
+
+            if (timer.is_oneshot()) {
+                release(timer);
+                continue;
+            }
+
+            // a periodic timer is fired at most once per tick
+            m_wheel.reinsert(timer);
+        }
+    } catch (...) {
+        dispatch_batches();
+        throw;
+    }
+
+    // executors are only handed the fired tasks once every due timer was processed, so each one gets a single batch.
+    dispatch_batches();
+    return m_wheel.next_deadline(now);
+}
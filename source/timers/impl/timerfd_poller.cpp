@@ -0,0 +1,172 @@
+#include "concurrencpp/timers/constants.h"
+#include "concurrencpp/timers/impl/timerfd_poller.h"
+
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include <system_error>
+
+#include <cstdint>
+
+using concurrencpp::details::timerfd_poller;
+
+#if defined(__linux__)
+
+#    include <cerrno>
+
+#    include <unistd.h>
+#    include <sys/epoll.h>
+#    include <sys/eventfd.h>
+#    include <sys/timerfd.h>
+
+namespace concurrencpp::details {
+    namespace {
+        [[noreturn]] void throw_errno(const char* error_msg) {
+            throw std::system_error(errno, std::system_category(), error_msg);
+        }
+
+        void drain(int fd) noexcept {
+            uint64_t count;
+            [[maybe_unused]] const auto res = ::read(fd, &count, sizeof(count));
+        }
+
+        void close_fd(int& fd) noexcept {
+            if (fd != -1) {
+                ::close(fd);
+                fd = -1;
+            }
+        }
+    }  // namespace
+}  // namespace concurrencpp::details
+
+timerfd_poller::timerfd_poller() {
+    try {
+        m_epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+        if (m_epoll_fd == -1) {
+            details::throw_errno(details::consts::k_timerfd_poller_epoll_create_err_msg);
+        }
+
+        m_timer_fd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        if (m_timer_fd == -1) {
+            details::throw_errno(details::consts::k_timerfd_poller_timerfd_create_err_msg);
+        }
+
+        m_event_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (m_event_fd == -1) {
+            details::throw_errno(details::consts::k_timerfd_poller_eventfd_create_err_msg);
+        }
+
+        for (const auto fd : {m_timer_fd, m_event_fd}) {
+            ::epoll_event event {};
+            event.events = EPOLLIN;
+            event.data.fd = fd;
+
+            if (::epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, fd, &event) == -1) {
+                details::throw_errno(details::consts::k_timerfd_poller_epoll_ctl_err_msg);
+            }
+        }
+    } catch (...) {
+        details::close_fd(m_event_fd);
+        details::close_fd(m_timer_fd);
+        details::close_fd(m_epoll_fd);
+        throw;
+    }
+}
+
+timerfd_poller::~timerfd_poller() noexcept {
+    details::close_fd(m_event_fd);
+    details::close_fd(m_timer_fd);
+    details::close_fd(m_epoll_fd);
+}
+
+bool timerfd_poller::supported() noexcept {
+    return true;
+}
+
+void timerfd_poller::notify() noexcept {
+    const uint64_t one = 1;
+    [[maybe_unused]] const auto res = ::write(m_event_fd, &one, sizeof(one));
+}
+
+void timerfd_poller::arm(std::chrono::nanoseconds relative_deadline) {
+    // an all zero it_value disarms the timer
+    const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(relative_deadline);
+
+    ::itimerspec spec {};
+    spec.it_value.tv_sec = static_cast<time_t>(seconds.count());
+    spec.it_value.tv_nsec = static_cast<long>((relative_deadline - seconds).count());
+
+    if (::timerfd_settime(m_timer_fd, 0, &spec, nullptr) == -1) {
+        details::throw_errno(details::consts::k_timerfd_poller_timerfd_settime_err_msg);
+    }
+}
+
+bool timerfd_poller::wait_impl(int timeout_ms) {
+    ::epoll_event events[2];
+
+    while (true) {
+        const auto count = ::epoll_wait(m_epoll_fd, events, 2, timeout_ms);
+        if (count == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            details::throw_errno(details::consts::k_timerfd_poller_epoll_wait_err_msg);
+        }
+
+        bool notified = false;
+        for (int i = 0; i < count; i++) {
+            details::drain(events[i].data.fd);
+            notified |= (events[i].data.fd == m_event_fd);
+        }
+
+        return notified;
+    }
+}
+
+bool timerfd_poller::wait_until(time_point deadline) {
+    const auto relative_deadline = deadline - clock_type::now();
+    if (relative_deadline <= std::chrono::nanoseconds::zero()) {
+        return false;
+    }
+
+    arm(relative_deadline);
+    return wait_impl(-1);
+}
+
+bool timerfd_poller::wait_for(std::chrono::milliseconds timeout) {
+    arm(std::chrono::nanoseconds::zero());
+
+    const auto timeout_ms = std::min<std::chrono::milliseconds::rep>(timeout.count(), std::numeric_limits<int>::max());
+    return wait_impl(static_cast<int>(timeout_ms));
+}
+
+#else
+
+timerfd_poller::timerfd_poller() {
+    throw std::invalid_argument(details::consts::k_timerfd_poller_unsupported_err_msg);
+}
+
+timerfd_poller::~timerfd_poller() noexcept {}
+
+bool timerfd_poller::supported() noexcept {
+    return false;
+}
+
+void timerfd_poller::notify() noexcept {}
+
+void timerfd_poller::arm(std::chrono::nanoseconds) {}
+
+bool timerfd_poller::wait_impl(int) {
+    return false;
+}
+
+bool timerfd_poller::wait_until(time_point) {
+    return false;
+}
+
+bool timerfd_poller::wait_for(std::chrono::milliseconds) {
+    return false;
+}
+
+#endif
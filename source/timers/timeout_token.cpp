@@ -0,0 +1,45 @@
+#include "concurrencpp/timers/constants.h"
+#include "concurrencpp/timers/timer_queue.h"
+#include "concurrencpp/timers/timeout_token.h"
+
+#include <stdexcept>
+
+#include <cassert>
+
+using concurrencpp::details::timeout_token_base;
+
+timeout_token_base::timeout_token_base() noexcept : timer_wheel_node(time_point(), duration::zero()) {}
+
+timeout_token_base::~timeout_token_base() noexcept {
+    // the most derived token disarms itself before its callable is destroyed
+    assert(!linked());
+}
+
+void timeout_token_base::arm(concurrencpp::timer_queue& timer_queue, duration timeout, duration slack) {
+    if (slack < duration::zero()) {
+        throw std::invalid_argument(details::consts::k_timeout_token_arm_negative_slack_err_msg);
+    }
+
+    disarm();
+
+    // the token is unlinked, the timer_queue thread doesn't touch it until it's linked again.
+    m_deadline = clock_type::now() + timeout;
+    m_slack = slack;
+    m_shard = &timer_queue.arm_token(*this);
+}
+
+bool timeout_token_base::disarm() noexcept {
+    if (m_shard == nullptr) {
+        return false;
+    }
+
+    return concurrencpp::timer_queue::disarm_token(*m_shard, *this);
+}
+
+bool timeout_token_base::armed() const noexcept {
+    if (m_shard == nullptr) {
+        return false;
+    }
+
+    return concurrencpp::timer_queue::token_armed(*m_shard, *this);
+}
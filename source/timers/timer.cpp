@@ -10,28 +10,45 @@ using concurrencpp::timer;
 using concurrencpp::details::timer_state;
 using concurrencpp::details::timer_state_base;
 
-timer_state_base::timer_state_base(size_t due_time,
-                                   size_t frequency,
+timer_state_base::timer_state_base(duration due_time,
+                                   duration frequency,
                                    std::shared_ptr<concurrencpp::executor> executor,
                                    std::weak_ptr<concurrencpp::timer_queue> timer_queue,
-                                   bool is_oneshot) noexcept :
-    m_timer_queue(std::move(timer_queue)),
-    m_executor(std::move(executor)), m_due_time(due_time), m_frequency(frequency), m_deadline(make_deadline(milliseconds(due_time))),
-    m_cancelled(false), m_is_oneshot(is_oneshot) {
-    assert(static_cast<bool>(m_executor));
+                                   bool is_oneshot,
+                                   duration slack,
+                                   duration inline_budget) noexcept :
+    timer_wheel_node(make_deadline(due_time), slack),
+    m_timer_queue(std::move(timer_queue)), m_executor(std::move(executor)), m_due_time(due_time), m_inline_budget(inline_budget),
+    m_frequency(frequency), m_cancelled(false), m_is_oneshot(is_oneshot) {
+    assert(slack >= duration::zero());
+    assert(inline_budget >= duration::zero());
 }
 
-void timer_state_base::fire() {
+concurrencpp::task timer_state_base::fire() {
     const auto frequency = m_frequency.load(std::memory_order_relaxed);
-    m_deadline = make_deadline(milliseconds(frequency));
+    m_deadline = make_deadline(frequency);
 
-    assert(static_cast<bool>(m_executor));
-
-    m_executor->post([self = shared_from_this()]() mutable {
+    return concurrencpp::task([self = shared_from_this()]() mutable {
         self->execute();
     });
 }
 
+bool timer_state_base::fire_inline() noexcept {
+    assert(is_inline());
+
+    const auto frequency = m_frequency.load(std::memory_order_relaxed);
+    const auto start = clock_type::now();
+    m_deadline = start + frequency;
+
+    try {
+        execute();
+    } catch (...) {
+        // there is no one to report to on the timer_queue thread, and the rest of the due timers must still be fired.
+    }
+
+    return clock_type::now() - start <= m_inline_budget;
+}
+
 timer::timer(std::shared_ptr<timer_state_base> timer_impl) noexcept : m_state(std::move(timer_impl)) {}
 
 timer::~timer() noexcept {
@@ -46,14 +63,19 @@ void timer::throw_if_empty(const char* error_message) const {
     throw errors::empty_timer(error_message);
 }
 
-std::chrono::milliseconds timer::get_due_time() const {
+std::chrono::nanoseconds timer::get_due_time() const {
     throw_if_empty(details::consts::k_timer_empty_get_due_time_err_msg);
-    return std::chrono::milliseconds(m_state->get_due_time());
+    return m_state->get_due_time();
+}
+
+std::chrono::nanoseconds timer::get_slack() const {
+    throw_if_empty(details::consts::k_timer_empty_get_slack_err_msg);
+    return m_state->get_slack();
 }
 
-std::chrono::milliseconds timer::get_frequency() const {
+std::chrono::nanoseconds timer::get_frequency() const {
     throw_if_empty(details::consts::k_timer_empty_get_frequency_err_msg);
-    return std::chrono::milliseconds(m_state->get_frequency());
+    return m_state->get_frequency();
 }
 
 std::shared_ptr<concurrencpp::executor> timer::get_executor() const {
@@ -83,9 +105,9 @@ void timer::cancel() {
     timer_queue->remove_internal_timer(std::move(state));
 }
 
-void timer::set_frequency(std::chrono::milliseconds new_frequency) {
+void timer::set_frequency(std::chrono::nanoseconds new_frequency) {
     throw_if_empty(details::consts::k_timer_empty_set_frequency_err_msg);
-    return m_state->set_new_frequency(new_frequency.count());
+    return m_state->set_new_frequency(new_frequency);
 }
 
 timer& timer::operator=(timer&& rhs) noexcept {
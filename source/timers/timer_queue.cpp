@@ -1,257 +1,468 @@
 #include "concurrencpp/timers/timer.h"
 #include "concurrencpp/timers/timer_queue.h"
+#include "concurrencpp/timers/timeout_token.h"
+#include "concurrencpp/timers/impl/timer_wheel.h"
+#include "concurrencpp/timers/impl/timerfd_poller.h"
 
 #include "concurrencpp/coroutines/coroutine.h"
 #include "concurrencpp/executors/constants.h"
 #include "concurrencpp/executors/executor.h"
+#include "concurrencpp/threads/thread.h"
 
-#include <set>
-#include <unordered_map>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <algorithm>
+#include <condition_variable>
 
 #include <cassert>
 
+#if defined(__linux__)
+#    include <sys/prctl.h>
+#endif
+
 using namespace std::chrono;
 
 using concurrencpp::timer;
 using concurrencpp::timer_queue;
-using concurrencpp::details::timer_request;
+using concurrencpp::timer_queue_backend;
 using concurrencpp::details::timer_state_base;
+using concurrencpp::details::timer_wheel_base;
+using concurrencpp::details::timeout_token_base;
 
 using timer_ptr = timer_queue::timer_ptr;
 using time_point = timer_queue::time_point;
-using request_queue = timer_queue::request_queue;
 
 namespace concurrencpp::details {
     namespace {
-        struct deadline_comparator {
-            bool operator()(const timer_ptr& a, const timer_ptr& b) const noexcept {
-                return a->get_deadline() < b->get_deadline();
-            }
-        };
-
-        class timer_queue_internal {
-            using timer_set = std::multiset<timer_ptr, deadline_comparator>;
-            using timer_set_iterator = typename timer_set::iterator;
-            using iterator_map = std::unordered_map<timer_ptr, timer_set_iterator>;
-
-           private:
-            timer_set m_timers;
-            iterator_map m_iterator_mapper;
+        constexpr std::chrono::microseconds k_spin_window(details::consts::k_timer_queue_spin_window_us);
 
-            void add_timer_internal(timer_ptr new_timer) {
-                assert(m_iterator_mapper.find(new_timer) == m_iterator_mapper.end());
-                auto timer_it = m_timers.emplace(new_timer);
-                m_iterator_mapper.emplace(std::move(new_timer), timer_it);
+        void spin_until(::time_point deadline) noexcept {
+            while (high_resolution_clock::now() < deadline) {
+                std::this_thread::yield();
             }
+        }
 
-            void remove_timer_internal(timer_ptr existing_timer) {
-                auto timer_it = m_iterator_mapper.find(existing_timer);
-                if (timer_it == m_iterator_mapper.end()) {
-                    assert(existing_timer->is_oneshot() || existing_timer->cancelled());  // the timer was already deleted by
-                                                                                          // the queue when it was fired.
-                    return;
-                }
-
-                auto set_iterator = timer_it->second;
-                m_timers.erase(set_iterator);
-                m_iterator_mapper.erase(timer_it);
-            }
+        void reduce_timer_slack() noexcept {
+#if defined(__linux__)
+            // the default 50us slack would dwarf sub-millisecond deadlines
+            ::prctl(PR_SET_TIMERSLACK, 1UL, 0UL, 0UL, 0UL);
+#endif
+        }
+    }  // namespace
+}  // namespace concurrencpp::details
 
-            void process_request_queue(request_queue& queue) {
-                for (auto& request : queue) {
-                    auto& timer_ptr = request.first;
-                    const auto opt = request.second;
-
-                    if (opt == timer_request::add) {
-                        add_timer_internal(std::move(timer_ptr));
-                    } else {
-                        remove_timer_internal(std::move(timer_ptr));
-                    }
-                }
-            }
+namespace concurrencpp::details {
+    class timer_queue_shard {
 
-            void reset_containers_memory() noexcept {
-                assert(empty());
-                timer_set timers;
-                std::swap(m_timers, timers);
-                iterator_map iterator_mapper;
-                std::swap(m_iterator_mapper, iterator_mapper);
-            }
+       private:
+        timer_queue& m_parent;
+        std::mutex m_lock;
+        details::thread m_worker;
+        std::condition_variable m_condition;
+        std::unique_ptr<details::timerfd_poller> m_poller;  // replaces m_condition with the timerfd backend
+        std::atomic_bool m_abort {false};
+        bool m_idle = true;
+
+        // lock-free LIFO lists of pending requests, pushed by any thread and taken as a whole by the worker.
+        std::atomic<timer_state_base*> m_added_timers {nullptr};
+        std::atomic<timer_state_base*> m_removed_timers {nullptr};
+
+        // the deadline the worker sleeps until: max while it's idle or has nothing to wait for, min while it's awake.
+        // producers whose deadline isn't earlier don't need to wake it up, so they don't touch m_lock at all.
+        std::atomic<timer_queue::time_point> m_sleep_deadline {timer_queue::time_point::max()};
+
+        // timeout tokens are owned by their callers, so unlike timers they're linked into a wheel guarded by m_lock.
+        details::timer_wheel_base m_token_wheel;
+        details::timer_wheel_base::node_list m_expired_tokens = nullptr;  // expired, waiting to be invoked
+        const timeout_token_base* m_firing_token = nullptr;
+        std::thread::id m_firing_thread;
+        std::condition_variable m_token_fired;
+        size_t m_token_fired_waiters = 0;
+        bool m_deadline_changed = false;
+
+        static void push_request(std::atomic<timer_state_base*>& head,
+                                 timer_state_base& timer,
+                                 timer_state_base* timer_state_base::*next) noexcept;
+
+        void process_requests(details::timer_wheel& wheel) noexcept;
+        void discard_requests() noexcept;
+        static void release_removed_timers(timer_state_base* removed) noexcept;
+        bool has_requests() const noexcept;
+
+        details::thread ensure_worker_thread(std::unique_lock<std::mutex>& lock);
+        void request_wake_up(std::unique_lock<std::mutex>& lock) noexcept;
+        void notify_worker() noexcept;
+        bool should_wake_up() const noexcept;
+        void fire_expired_tokens(std::unique_lock<std::mutex>& lock) noexcept;
+        void discard_tokens() noexcept;
+
+        bool wait_on_condition(std::unique_lock<std::mutex>& lock, bool has_timers, timer_queue::time_point next_deadline);
+        bool wait_on_poller(std::unique_lock<std::mutex>& lock, bool has_timers, timer_queue::time_point next_deadline);
+
+        void work_loop();
 
-           public:
-            bool empty() const noexcept {
-                assert(m_iterator_mapper.size() == m_timers.size());
-                return m_timers.empty();
-            }
+       public:
+        timer_queue_shard(timer_queue& parent, timer_queue_backend backend);
 
-            ::time_point process_timers(request_queue& queue) {
-                process_request_queue(queue);
-
-                const auto now = high_resolution_clock::now();
-
-                while (true) {
-                    if (m_timers.empty()) {
-                        break;
-                    }
-
-                    timer_set temp_set;
-
-                    auto first_timer_it = m_timers.begin();  // closest deadline
-                    auto timer_ptr = *first_timer_it;
-                    const auto is_oneshot = timer_ptr->is_oneshot();
-
-                    if (!timer_ptr->expired(now)) {
-                        // if this timer is not expired, the next ones are guaranteed not to, as
-                        // the set is ordered by deadlines.
-                        break;
-                    }
-
-                    // we are going to modify the timer, so first we extract it
-                    auto timer_node = m_timers.extract(first_timer_it);
-
-                    // we cannot use the naked node_handle according to the standard. it must
-                    // be contained somewhere.
-                    auto temp_it = temp_set.insert(std::move(timer_node));
-
-                    // we fire it only if it's not cancelled
-                    const auto cancelled = timer_ptr->cancelled();
-                    if (!cancelled) {
-                        (*temp_it)->fire();
-                    }
-
-                    if (is_oneshot || cancelled) {
-                        m_iterator_mapper.erase(timer_ptr);
-                        continue;  // let the timer die inside temp_set
-                    }
-
-                    // regular timer, re-insert into the right position
-                    timer_node = temp_set.extract(temp_it);
-                    auto new_it = m_timers.insert(std::move(timer_node));
-                    // AppleClang doesn't have std::unordered_map::contains yet
-                    assert(m_iterator_mapper.find(timer_ptr) != m_iterator_mapper.end());
-                    m_iterator_mapper[timer_ptr] = new_it;  // update the iterator map, multiset::extract invalidates the
-                    // timer
-                }
-
-                if (m_timers.empty()) {
-                    reset_containers_memory();
-                    return now + std::chrono::hours(24);
-                }
-
-                // get the closest deadline.
-                return (**m_timers.begin()).get_deadline();
-            }
-        };
-    }  // namespace
+        void add_timer(timer_ptr new_timer);
+        void remove_timer(timer_ptr existing_timer);
+        void shutdown();
+
+        void arm_token(timeout_token_base& token);
+        bool disarm_token(timeout_token_base& token) noexcept;
+        bool token_armed(const timeout_token_base& token) noexcept;
+    };
 }  // namespace concurrencpp::details
 
-timer_queue::timer_queue(milliseconds max_waiting_time,
-                         const std::function<void(std::string_view thread_name)>& thread_started_callback,
-                         const std::function<void(std::string_view thread_name)>& thread_terminated_callback) :
-    m_thread_started_callback(thread_started_callback),
-    m_thread_terminated_callback(thread_terminated_callback), m_atomic_abort(false), m_abort(false), m_idle(true),
-    m_max_waiting_time(max_waiting_time) {}
+using concurrencpp::details::timer_queue_shard;
 
-timer_queue::~timer_queue() noexcept {
-    shutdown();
-    assert(!m_worker.joinable());
+/*
+    timer_queue_shard
+*/
+
+timer_queue_shard::timer_queue_shard(timer_queue& parent, timer_queue_backend backend) : m_parent(parent) {
+    if (backend == timer_queue_backend::timerfd) {
+        m_poller = std::make_unique<details::timerfd_poller>();
+    }
 }
 
-void timer_queue::add_internal_timer(std::unique_lock<std::mutex>& lock, timer_ptr new_timer) {
-    assert(lock.owns_lock());
-    m_request_queue.emplace_back(std::move(new_timer), timer_request::add);
-    lock.unlock();
+void timer_queue_shard::notify_worker() noexcept {
+    if (static_cast<bool>(m_poller)) {
+        m_poller->notify();
+        return;
+    }
 
     m_condition.notify_one();
 }
 
-void timer_queue::remove_internal_timer(timer_ptr existing_timer) {
-    {
-        std::unique_lock<decltype(m_lock)> lock(m_lock);
-        m_request_queue.emplace_back(std::move(existing_timer), timer_request::remove);
+void timer_queue_shard::push_request(std::atomic<timer_state_base*>& head,
+                                     timer_state_base& timer,
+                                     timer_state_base* timer_state_base::*next) noexcept {
+    auto old_head = head.load(std::memory_order_relaxed);
+    do {
+        timer.*next = old_head;
+    } while (!head.compare_exchange_weak(old_head, &timer, std::memory_order_seq_cst, std::memory_order_relaxed));
+}
+
+bool timer_queue_shard::has_requests() const noexcept {
+    return m_added_timers.load(std::memory_order_seq_cst) != nullptr || m_removed_timers.load(std::memory_order_seq_cst) != nullptr;
+}
+
+void timer_queue_shard::process_requests(details::timer_wheel& wheel) noexcept {
+    // a timer is pushed to the removed list only after it was pushed to the added list. taking the removed list first
+    // guarantees that every removal we take finds its timer either in the wheel or in the added list we take next.
+    auto removed = m_removed_timers.exchange(nullptr, std::memory_order_seq_cst);
+    auto added = m_added_timers.exchange(nullptr, std::memory_order_seq_cst);
+
+    while (added != nullptr) {
+        auto& timer = *added;
+        added = std::exchange(timer.m_next_added, nullptr);
+        wheel.add(std::move(timer.m_wheel_ref));
     }
 
-    m_condition.notify_one();
+    while (removed != nullptr) {
+        auto& timer = *removed;
+        removed = std::exchange(timer.m_next_removed, nullptr);
+
+        const auto timer_ref = std::move(timer.m_removed_ref);
+        wheel.remove(timer_ref);
+    }
 }
 
-void timer_queue::add_timer(std::unique_lock<std::mutex>& lock, timer_ptr new_timer) {
+void timer_queue_shard::discard_requests() noexcept {
+    // the removed list keeps its timers alive, so it's released last.
+    auto removed = m_removed_timers.exchange(nullptr, std::memory_order_seq_cst);
+    auto added = m_added_timers.exchange(nullptr, std::memory_order_seq_cst);
+
+    while (added != nullptr) {
+        auto& timer = *added;
+        added = std::exchange(timer.m_next_added, nullptr);
+        timer.m_wheel_ref.reset();
+    }
+
+    release_removed_timers(removed);
+}
+
+void timer_queue_shard::release_removed_timers(timer_state_base* removed) noexcept {
+    while (removed != nullptr) {
+        auto& timer = *removed;
+        removed = std::exchange(timer.m_next_removed, nullptr);
+        timer.m_removed_ref.reset();
+    }
+}
+
+void timer_queue_shard::request_wake_up(std::unique_lock<std::mutex>& lock) noexcept {
     assert(lock.owns_lock());
 
+    // the worker re-computes its deadline once it's up, until then there's no point in waking it up again.
+    m_deadline_changed = true;
+    m_sleep_deadline.store(timer_queue::time_point::min(), std::memory_order_seq_cst);
+}
+
+void timer_queue_shard::add_timer(timer_ptr new_timer) {
+    if (m_abort.load(std::memory_order_relaxed)) {
+        throw errors::runtime_shutdown(details::consts::k_timer_queue_shutdown_err_msg);
+    }
+
+    auto& timer = *new_timer;
+    const auto deadline = timer.get_deadline();
+    timer.m_wheel_ref = std::move(new_timer);  // owned by the added list until the worker moves it into its wheel
+    push_request(m_added_timers, timer, &timer_state_base::m_next_added);
+
+    // pairs with the store in shutdown: either we see the abort flag or shutdown sees our request.
+    if (m_abort.load(std::memory_order_seq_cst)) {
+        discard_requests();
+        throw errors::runtime_shutdown(details::consts::k_timer_queue_shutdown_err_msg);
+    }
+
+    // pairs with the worker storing its deadline and then checking the lists: either we see the deadline it's going to
+    // sleep until or it sees our request and doesn't go to sleep.
+    if (deadline >= m_sleep_deadline.load(std::memory_order_seq_cst)) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_lock);
+    if (m_abort) {
+        return;  // shutdown takes care of the request
+    }
+
+    auto old_thread = ensure_worker_thread(lock);
+    request_wake_up(lock);
+    lock.unlock();
+
+    notify_worker();
+
+    if (old_thread.joinable()) {
+        old_thread.join();
+    }
+}
+
+void timer_queue_shard::remove_timer(timer_ptr existing_timer) {
+    auto& timer = *existing_timer;
+    timer.m_removed_ref = std::move(existing_timer);
+    push_request(m_removed_timers, timer, &timer_state_base::m_next_removed);
+
+    if (m_abort.load(std::memory_order_seq_cst)) {
+        discard_requests();
+        return;
+    }
+
+    // an awake worker takes the request on its own. a sleeping one is woken up once per batch of removals: the first
+    // remover sets m_sleep_deadline to min, the rest see it and leave.
+    if (m_sleep_deadline.load(std::memory_order_seq_cst) == timer_queue::time_point::min()) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_lock);
+    if (m_abort) {
+        return;
+    }
+
+    if (m_idle) {
+        // no worker runs until the next one is started under m_lock, and an idle worker has no timers to unlink: the
+        // pending removals are released right away instead of holding their timers, executors and callables until then.
+        // a timer still on the added list is cancelled already, the next worker drops it when it's due.
+        const auto removed = m_removed_timers.exchange(nullptr, std::memory_order_seq_cst);
+        lock.unlock();
+
+        release_removed_timers(removed);  // destroys callables, which may use the timer queue themselves
+        return;
+    }
+
+    request_wake_up(lock);
+    lock.unlock();
+
+    notify_worker();
+}
+
+void timer_queue_shard::arm_token(timeout_token_base& token) {
+    std::unique_lock<std::mutex> lock(m_lock);
     if (m_abort) {
         throw errors::runtime_shutdown(details::consts::k_timer_queue_shutdown_err_msg);
     }
 
     auto old_thread = ensure_worker_thread(lock);
-    add_internal_timer(lock, new_timer);
+    m_token_wheel.insert(token);
+
+    // most tokens expire after the next wake-up of the worker, which finds them on its own.
+    const auto notify = token.get_deadline() < m_sleep_deadline.load(std::memory_order_relaxed);
+    if (notify) {
+        request_wake_up(lock);
+    }
+
+    lock.unlock();
+
+    if (notify) {
+        notify_worker();
+    }
 
     if (old_thread.joinable()) {
         old_thread.join();
     }
 }
 
-void timer_queue::work_loop() {
-    time_point next_deadline;
-    details::timer_queue_internal internal_state;
+bool timer_queue_shard::disarm_token(timeout_token_base& token) noexcept {
+    std::unique_lock<std::mutex> lock(m_lock);
+    if (token.linked()) {
+        m_token_wheel.erase(token);  // unlinks it from m_expired_tokens as well
+        return true;
+    }
+
+    // a token that disarms itself from its own callable can't wait for it
+    if (m_firing_token == &token && m_firing_thread != std::this_thread::get_id()) {
+        ++m_token_fired_waiters;
+        m_token_fired.wait(lock, [this, &token] {
+            return m_firing_token != &token;
+        });
+        --m_token_fired_waiters;
+    }
+
+    return false;
+}
+
+bool timer_queue_shard::token_armed(const timeout_token_base& token) noexcept {
+    std::unique_lock<std::mutex> lock(m_lock);
+    return token.linked();
+}
+
+void timer_queue_shard::fire_expired_tokens(std::unique_lock<std::mutex>& lock) noexcept {
+    assert(lock.owns_lock());
+
+    while (const auto node = timer_wheel_base::pop_front(m_expired_tokens)) {
+        auto& token = static_cast<timeout_token_base&>(*node);
+        m_firing_token = &token;
+        m_firing_thread = std::this_thread::get_id();
+        lock.unlock();
+
+        token.on_timeout();  // might re-arm or destroy the token, don't touch it afterwards
+
+        lock.lock();
+        m_firing_token = nullptr;
+
+        if (m_token_fired_waiters != 0) {
+            m_token_fired.notify_all();
+        }
+    }
+}
+
+void timer_queue_shard::discard_tokens() noexcept {
+    m_token_wheel.expire_all(m_expired_tokens);
+    while (timer_wheel_base::pop_front(m_expired_tokens) != nullptr) {
+    }
+}
+
+bool timer_queue_shard::should_wake_up() const noexcept {
+    return m_deadline_changed || m_abort || has_requests();
+}
+
+bool timer_queue_shard::wait_on_condition(std::unique_lock<std::mutex>& lock,
+                                          bool has_timers,
+                                          timer_queue::time_point next_deadline) {
+    assert(lock.owns_lock());
+
+    if (!has_timers) {
+        return m_condition.wait_for(lock, m_parent.m_max_waiting_time, [this] {
+            return should_wake_up();
+        });
+    }
+
+    // condition variable timeouts overshoot by the OS timer slack, the last stretch before the deadline is spun out.
+    const auto woken = m_condition.wait_until(lock, next_deadline - details::k_spin_window, [this] {
+        return should_wake_up();
+    });
+
+    if (!woken) {
+        lock.unlock();
+        details::spin_until(next_deadline);
+        lock.lock();
+    }
+
+    return true;
+}
+
+bool timer_queue_shard::wait_on_poller(std::unique_lock<std::mutex>& lock,
+                                       bool has_timers,
+                                       timer_queue::time_point next_deadline) {
+    assert(lock.owns_lock());
+
+    // producers signal the eventfd after releasing the lock, a signal that arrives before we wait is not lost.
+    while (!should_wake_up()) {
+        lock.unlock();
+        const auto notified =
+            has_timers ? m_poller->wait_until(next_deadline) : m_poller->wait_for(m_parent.m_max_waiting_time);
+        lock.lock();
+
+        if (!notified) {
+            return has_timers || should_wake_up();
+        }
+    }
+
+    return true;
+}
+
+void timer_queue_shard::work_loop() {
+    details::reduce_timer_slack();
+
+    auto timers_deadline = timer_queue::time_point::max();
+    details::timer_wheel wheel(high_resolution_clock::now(), &m_parent.m_inline_timer_overruns);
 
     while (true) {
         std::unique_lock<decltype(m_lock)> lock(m_lock);
-        if (internal_state.empty()) {
-            const auto res = m_condition.wait_for(lock, m_max_waiting_time, [this] {
-                return !m_request_queue.empty() || m_abort;
-            });
-
-            if (!res) {
-                m_idle = true;
-                lock.unlock();
-                return;
-            }
+        const auto has_timers = !wheel.empty() || !m_token_wheel.empty();
+        const auto next_deadline = std::min(timers_deadline, m_token_wheel.next_deadline(high_resolution_clock::now()));
+
+        m_sleep_deadline.store(has_timers ? next_deadline : timer_queue::time_point::max(), std::memory_order_seq_cst);
+        const auto woken = static_cast<bool>(m_poller) ? wait_on_poller(lock, has_timers, next_deadline) :
+                                                         wait_on_condition(lock, has_timers, next_deadline);
+        m_deadline_changed = false;
 
-        } else {
-            m_condition.wait_until(lock, next_deadline, [this] {
-                return !m_request_queue.empty() || m_abort;
-            });
+        if (!woken) {
+            m_idle = true;  // m_sleep_deadline stays max, the next producer starts a new worker
+            lock.unlock();
+            return;
         }
 
+        m_sleep_deadline.store(timer_queue::time_point::min(), std::memory_order_seq_cst);
+
         if (m_abort) {
             return;
         }
 
-        auto request_queue = std::move(m_request_queue);
+        m_token_wheel.expire(high_resolution_clock::now(), m_expired_tokens);
+        fire_expired_tokens(lock);
         lock.unlock();
 
-        next_deadline = internal_state.process_timers(request_queue);
-        const auto now = clock_type::now();
-        if (next_deadline <= now) {
-            continue;
-        }
+        process_requests(wheel);
+        timers_deadline = wheel.process_timers(high_resolution_clock::now());
     }
 }
 
-bool timer_queue::shutdown_requested() const noexcept {
-    return m_atomic_abort.load(std::memory_order_relaxed);
-}
-
-void timer_queue::shutdown() {
-    const auto state_before = m_atomic_abort.exchange(true, std::memory_order_relaxed);
-    if (state_before) {
-        return;  // timer_queue has been shut down already.
-    }
-
+void timer_queue_shard::shutdown() {
     std::unique_lock<std::mutex> lock(m_lock);
-    m_abort = true;
+    m_abort.store(true, std::memory_order_seq_cst);
+    discard_tokens();
 
     if (!m_worker.joinable()) {
+        lock.unlock();
+        discard_requests();
         return;  // nothing to shut down
     }
 
-    m_request_queue.clear();
     lock.unlock();
 
-    m_condition.notify_all();
+    if (static_cast<bool>(m_poller)) {
+        m_poller->notify();
+    } else {
+        m_condition.notify_all();
+    }
+
     m_worker.join();
+    discard_requests();
 }
 
-concurrencpp::details::thread timer_queue::ensure_worker_thread(std::unique_lock<std::mutex>& lock) {
+concurrencpp::details::thread timer_queue_shard::ensure_worker_thread(std::unique_lock<std::mutex>& lock) {
     assert(lock.owns_lock());
     if (!m_idle) {
         return {};
@@ -264,35 +475,108 @@ concurrencpp::details::thread timer_queue::ensure_worker_thread(std::unique_lock
         [this] {
             work_loop();
         },
-        m_thread_started_callback,
-        m_thread_terminated_callback);
+        m_parent.m_thread_started_callback,
+        m_parent.m_thread_terminated_callback);
 
     m_idle = false;
     return old_worker;
 }
 
-concurrencpp::lazy_result<void> timer_queue::make_delay_object_impl(std::chrono::milliseconds due_time,
+/*
+    timer_queue
+*/
+
+timer_queue::timer_queue(milliseconds max_waiting_time,
+                         const std::function<void(std::string_view thread_name)>& thread_started_callback,
+                         const std::function<void(std::string_view thread_name)>& thread_terminated_callback,
+                         size_t shard_count,
+                         timer_queue_backend backend) :
+    m_atomic_abort(false), m_inline_timer_overruns(0),
+    m_max_waiting_time(max_waiting_time), m_thread_started_callback(thread_started_callback),
+    m_thread_terminated_callback(thread_terminated_callback), m_backend(backend) {
+    if (shard_count == 0) {
+        throw std::invalid_argument(details::consts::k_timer_queue_zero_shard_count_err_msg);
+    }
+
+    if (backend == timer_queue_backend::timerfd && !details::timerfd_poller::supported()) {
+        throw std::invalid_argument(details::consts::k_timerfd_poller_unsupported_err_msg);
+    }
+
+    m_shards.reserve(shard_count);
+    for (size_t i = 0; i < shard_count; i++) {
+        m_shards.emplace_back(std::make_unique<details::timer_queue_shard>(*this, backend));
+    }
+}
+
+timer_queue::~timer_queue() noexcept {
+    shutdown();
+}
+
+void timer_queue::add_timer(timer_ptr new_timer) {
+    // threads are spread round-robin over the shards by their creation order.
+    const auto shard_index = static_cast<size_t>(details::thread::get_current_virtual_id() % m_shards.size());
+    new_timer->m_shard_index = shard_index;
+    m_shards[shard_index]->add_timer(std::move(new_timer));
+}
+
+void timer_queue::remove_internal_timer(timer_ptr existing_timer) {
+    const auto shard_index = existing_timer->m_shard_index;
+    assert(shard_index < m_shards.size());
+    m_shards[shard_index]->remove_timer(std::move(existing_timer));
+}
+
+concurrencpp::details::timer_queue_shard& timer_queue::arm_token(details::timeout_token_base& token) {
+    const auto shard_index = static_cast<size_t>(details::thread::get_current_virtual_id() % m_shards.size());
+    auto& shard = *m_shards[shard_index];
+    shard.arm_token(token);
+    return shard;
+}
+
+bool timer_queue::disarm_token(details::timer_queue_shard& shard, details::timeout_token_base& token) noexcept {
+    return shard.disarm_token(token);
+}
+
+bool timer_queue::token_armed(details::timer_queue_shard& shard, const details::timeout_token_base& token) noexcept {
+    return shard.token_armed(token);
+}
+
+bool timer_queue::shutdown_requested() const noexcept {
+    return m_atomic_abort.load(std::memory_order_relaxed);
+}
+
+void timer_queue::shutdown() {
+    const auto state_before = m_atomic_abort.exchange(true, std::memory_order_relaxed);
+    if (state_before) {
+        return;  // timer_queue has been shut down already.
+    }
+
+    for (auto& shard : m_shards) {
+        shard->shutdown();
+    }
+}
+
+concurrencpp::lazy_result<void> timer_queue::make_delay_object_impl(duration due_time,
                                                                     std::shared_ptr<concurrencpp::timer_queue> self,
                                                                     std::shared_ptr<concurrencpp::executor> executor) {
     class delay_object_awaitable : public details::suspend_always {
 
        private:
-        const size_t m_due_time_ms;
+        const duration m_due_time;
         timer_queue& m_parent_queue;
         std::shared_ptr<concurrencpp::executor> m_executor;
         bool m_interrupted = false;
 
        public:
-        delay_object_awaitable(size_t due_time_ms,
+        delay_object_awaitable(duration due_time,
                                timer_queue& parent_queue,
                                std::shared_ptr<concurrencpp::executor> executor) noexcept :
-            m_due_time_ms(due_time_ms),
+            m_due_time(due_time),
             m_parent_queue(parent_queue), m_executor(std::move(executor)) {}
 
         void await_suspend(details::coroutine_handle<void> coro_handle) noexcept {
             try {
-                m_parent_queue.make_timer_impl(m_due_time_ms,
-                                               0,
+                m_parent_queue.make_timer_impl(m_due_time,
+                                               duration::zero(),
                                                std::move(m_executor),
                                                true,
                                                details::await_via_functor {coro_handle, &m_interrupted});
@@ -309,10 +593,10 @@ concurrencpp::lazy_result<void> timer_queue::make_delay_object_impl(std::chrono:
         }
     };
 
-    co_await delay_object_awaitable {static_cast<size_t>(due_time.count()), *this, std::move(executor)};
+    co_await delay_object_awaitable {due_time, *this, std::move(executor)};
 }
 
-concurrencpp::lazy_result<void> timer_queue::make_delay_object(std::chrono::milliseconds due_time,
+concurrencpp::lazy_result<void> timer_queue::make_delay_object(duration due_time,
                                                                std::shared_ptr<executor> executor) {
     if (!static_cast<bool>(executor)) {
         throw std::invalid_argument(details::consts::k_timer_queue_make_delay_object_executor_null_err_msg);
@@ -321,6 +605,18 @@ concurrencpp::lazy_result<void> timer_queue::make_delay_object(std::chrono::mill
     return make_delay_object_impl(due_time, shared_from_this(), std::move(executor));
 }
 
+size_t timer_queue::inline_timer_overruns() const noexcept {
+    return m_inline_timer_overruns.load(std::memory_order_relaxed);
+}
+
 milliseconds timer_queue::max_worker_idle_time() const noexcept {
     return m_max_waiting_time;
 }
+
+size_t timer_queue::shard_count() const noexcept {
+    return m_shards.size();
+}
+
+concurrencpp::timer_queue_backend timer_queue::backend() const noexcept {
+    return m_backend;
+}
@@ -0,0 +1,397 @@
+#include "concurrencpp/concurrencpp.h"
+#include "concurrencpp/algorithms/impl/numeric_kernels.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/random.h"
+#include "utils/executor_shutdowner.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <numeric>
+#include <iterator>
+#include <algorithm>
+
+namespace concurrencpp::tests {
+    void test_numeric_null_executor();
+    void test_numeric_invalid_arguments();
+    void test_numeric_sum();
+    void test_numeric_min_max();
+    void test_numeric_dot();
+    void test_numeric_histogram();
+    void test_numeric_kernels();
+}  // namespace concurrencpp::tests
+
+namespace concurrencpp::tests {
+    // small integers, so float and double sums and dot products are exact no matter how they're split or vectorized
+    template<class type>
+    std::vector<type> make_numeric_values(size_t size, random& randomizer) {
+        std::vector<type> values(size);
+        for (auto& value : values) {
+            value = static_cast<type>(randomizer(-100, 100));
+        }
+
+        return values;
+    }
+
+    const size_t k_numeric_test_sizes[] = {0, 1, 7, 15, 16, 33, 1'000, 16'385, 1'000'003};
+}  // namespace concurrencpp::tests
+
+using concurrencpp::numeric::instruction_set;
+
+void concurrencpp::tests::test_numeric_null_executor() {
+    const std::shared_ptr<thread_pool_executor> executor;
+    const std::vector<float> values(8);
+    std::vector<uint64_t> bins(4);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            numeric::sum(executor, std::span<const float>(values));
+        },
+        concurrencpp::details::consts::k_numeric_sum_null_executor_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            numeric::min_max(executor, std::span<const float>(values));
+        },
+        concurrencpp::details::consts::k_numeric_min_max_null_executor_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            numeric::dot(executor, std::span<const float>(values), std::span<const float>(values));
+        },
+        concurrencpp::details::consts::k_numeric_dot_null_executor_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            numeric::histogram(executor, std::span<const float>(values), 0.0f, 1.0f, bins);
+        },
+        concurrencpp::details::consts::k_numeric_histogram_null_executor_err_msg);
+}
+
+void concurrencpp::tests::test_numeric_invalid_arguments() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 2, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    const std::vector<double> lhs(8), rhs(9);
+    const std::vector<int32_t> values(8);
+    std::vector<uint64_t> bins(4);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            numeric::dot(executor, std::span<const double>(lhs), std::span<const double>(rhs));
+        },
+        concurrencpp::details::consts::k_numeric_dot_size_mismatch_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            numeric::histogram(executor, std::span<const int32_t>(values), 0, 10, std::span<uint64_t> {});
+        },
+        concurrencpp::details::consts::k_numeric_histogram_bin_count_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            numeric::histogram(executor, std::span<const int32_t>(values), 10, 10, bins);
+        },
+        concurrencpp::details::consts::k_numeric_histogram_range_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            const std::vector<float> float_values(8);
+            numeric::histogram(executor, std::span<const float>(float_values), 1.0f, std::nanf(""), bins);
+        },
+        concurrencpp::details::consts::k_numeric_histogram_range_err_msg);
+
+    // high - low overflows to infinity
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            const std::vector<float> float_values(8);
+            numeric::histogram(executor,
+                               std::span<const float>(float_values),
+                               std::numeric_limits<float>::lowest(),
+                               std::numeric_limits<float>::max(),
+                               bins);
+        },
+        concurrencpp::details::consts::k_numeric_histogram_scale_err_msg);
+
+    // the bins are so narrow the scale overflows to infinity
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            const std::vector<float> float_values(8);
+            numeric::histogram(executor, std::span<const float>(float_values), 0.0f, std::numeric_limits<float>::denorm_min(), bins);
+        },
+        concurrencpp::details::consts::k_numeric_histogram_scale_err_msg);
+}
+
+void concurrencpp::tests::test_numeric_sum() {
+    random randomizer;
+
+    for (const size_t pool_size : {1, 4}) {
+        auto executor = std::make_shared<thread_pool_executor>("threadpool", pool_size, std::chrono::seconds(10));
+        executor_shutdowner shutdown(executor);
+
+        for (const auto size : k_numeric_test_sizes) {
+            const auto ints = make_numeric_values<int32_t>(size, randomizer);
+            const std::vector<float> floats(ints.begin(), ints.end());
+            const std::vector<double> doubles(ints.begin(), ints.end());
+
+            int64_t expected = 0;
+            for (const auto value : ints) {
+                expected += value;
+            }
+
+            assert_equal(numeric::sum(executor, std::span<const int32_t>(ints)), expected);
+            assert_equal(numeric::sum(executor, std::span<const float>(floats)), static_cast<double>(expected));
+            assert_equal(numeric::sum(executor, std::span<const double>(doubles)), static_cast<double>(expected));
+        }
+    }
+
+    // int32_t values are accumulated as int64_t
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    const std::vector<int32_t> big_values(100'000, std::numeric_limits<int32_t>::max());
+    assert_equal(numeric::sum(executor, std::span<const int32_t>(big_values)), int64_t(100'000) * std::numeric_limits<int32_t>::max());
+
+    // floats are accumulated as doubles
+    const std::vector<float> fractions(1'000'000, 0.1f);
+    const auto sum = numeric::sum(executor, std::span<const float>(fractions));
+    assert_true(std::abs(sum - 1'000'000 * static_cast<double>(0.1f)) < 1e-6);
+}
+
+void concurrencpp::tests::test_numeric_min_max() {
+    random randomizer;
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    const auto empty_result = numeric::min_max(executor, std::span<const int32_t> {});
+    assert_equal(empty_result.min, std::numeric_limits<int32_t>::max());
+    assert_equal(empty_result.max, std::numeric_limits<int32_t>::lowest());
+
+    for (const auto size : k_numeric_test_sizes) {
+        if (size == 0) {
+            continue;
+        }
+
+        auto ints = make_numeric_values<int32_t>(size, randomizer);
+
+        // the extremes are planted at random positions, so every chunk and every vector lane gets to hold them
+        ints[static_cast<size_t>(randomizer(0, static_cast<int64_t>(size - 1)))] = -1'000;
+        ints[static_cast<size_t>(randomizer(0, static_cast<int64_t>(size - 1)))] = 1'000;
+
+        const auto expected_min = *std::min_element(ints.begin(), ints.end());
+        const auto expected_max = *std::max_element(ints.begin(), ints.end());
+
+        const std::vector<float> floats(ints.begin(), ints.end());
+        const std::vector<double> doubles(ints.begin(), ints.end());
+
+        const auto int_result = numeric::min_max(executor, std::span<const int32_t>(ints));
+        assert_equal(int_result.min, expected_min);
+        assert_equal(int_result.max, expected_max);
+
+        const auto float_result = numeric::min_max(executor, std::span<const float>(floats));
+        assert_equal(float_result.min, static_cast<float>(expected_min));
+        assert_equal(float_result.max, static_cast<float>(expected_max));
+
+        const auto double_result = numeric::min_max(executor, std::span<const double>(doubles));
+        assert_equal(double_result.min, static_cast<double>(expected_min));
+        assert_equal(double_result.max, static_cast<double>(expected_max));
+    }
+}
+
+void concurrencpp::tests::test_numeric_dot() {
+    random randomizer;
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    for (const auto size : k_numeric_test_sizes) {
+        const auto lhs = make_numeric_values<double>(size, randomizer);
+        const auto rhs = make_numeric_values<double>(size, randomizer);
+        const std::vector<float> float_lhs(lhs.begin(), lhs.end());
+        const std::vector<float> float_rhs(rhs.begin(), rhs.end());
+
+        double expected = 0;
+        for (size_t i = 0; i < size; i++) {
+            expected += lhs[i] * rhs[i];
+        }
+
+        assert_equal(numeric::dot(executor, std::span<const double>(lhs), std::span<const double>(rhs)), expected);
+        assert_equal(numeric::dot(executor, std::span<const float>(float_lhs), std::span<const float>(float_rhs)), expected);
+    }
+}
+
+void concurrencpp::tests::test_numeric_histogram() {
+    random randomizer;
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    for (const auto size : k_numeric_test_sizes) {
+        const auto ints = make_numeric_values<int32_t>(size, randomizer);
+
+        // [-50, 50) in 20 bins of 5: an int value v is counted in bin (v + 50) / 5, a float value v + 0.5 as well
+        std::vector<float> floats;
+        for (const auto value : ints) {
+            floats.emplace_back(static_cast<float>(value) + 0.5f);
+        }
+
+        std::vector<uint64_t> expected(20);
+        for (const auto value : ints) {
+            if (value >= -50 && value < 50) {
+                ++expected[static_cast<size_t>((value + 50) / 5)];
+            }
+        }
+
+        std::vector<uint64_t> bins(20, 1234);  // overwritten, not added to
+        numeric::histogram(executor, std::span<const int32_t>(ints), -50, 50, bins);
+        assert_true(bins == expected);
+
+        std::vector<uint64_t> float_bins(20, 1234);
+        numeric::histogram(executor, std::span<const float>(floats), -50.0f, 50.0f, float_bins);
+        assert_true(float_bins == expected);
+    }
+
+    // low is counted, high, values outside of the range and NaNs aren't
+    const float edges[] = {0.0f,
+                           0.999f,
+                           1.0f,
+                           3.999f,
+                           4.0f,
+                           -0.001f,
+                           std::nanf(""),
+                           std::numeric_limits<float>::infinity(),
+                           -std::numeric_limits<float>::infinity()};
+    std::vector<uint64_t> bins(4);
+    numeric::histogram(executor, std::span<const float>(edges), 0.0f, 4.0f, bins);
+    assert_true(bins == std::vector<uint64_t> {2, 1, 0, 1});
+
+    const int32_t int_edges[] = {std::numeric_limits<int32_t>::lowest(), -1, 0, 1, std::numeric_limits<int32_t>::max()};
+    std::vector<uint64_t> int_bins(2);
+    numeric::histogram(executor,
+                       std::span<const int32_t>(int_edges),
+                       std::numeric_limits<int32_t>::lowest(),
+                       std::numeric_limits<int32_t>::max(),
+                       int_bins);
+    assert_true(int_bins == std::vector<uint64_t> {2, 2});
+}
+
+void concurrencpp::tests::test_numeric_kernels() {
+    using concurrencpp::details::numeric_kernels;
+
+    random randomizer;
+    const auto& scalar = concurrencpp::details::scalar_numeric_kernels();
+    const auto active = numeric::active_instruction_set();
+    assert_true(concurrencpp::details::numeric_kernels_of(active) != nullptr);
+
+    // every supported instruction set computes what the scalar kernels compute, at every length and alignment
+    const auto ints = make_numeric_values<int32_t>(4'104, randomizer);
+    std::vector<float> floats;
+    for (const auto value : ints) {
+        floats.emplace_back(static_cast<float>(value) / 7.0f);
+    }
+
+    const std::vector<double> doubles(floats.begin(), floats.end());
+
+    for (const auto isa : {instruction_set::scalar, instruction_set::neon, instruction_set::avx2, instruction_set::avx512}) {
+        const auto* kernels = concurrencpp::details::numeric_kernels_of(isa);
+        if (kernels == nullptr) {
+            continue;
+        }
+
+        assert_equal(kernels->isa, isa);
+
+        for (const size_t offset : {0, 1, 3}) {
+            for (const size_t size : {0, 1, 5, 8, 17, 31, 32, 33, 64, 100, 4'096}) {
+                const auto* float_data = floats.data() + offset;
+                const auto* double_data = doubles.data() + offset;
+                const auto* int_data = ints.data() + offset;
+
+                assert_equal(kernels->sum_i32(int_data, size), scalar.sum_i32(int_data, size));
+                assert_true(std::abs(kernels->sum_f32(float_data, size) - scalar.sum_f32(float_data, size)) < 1e-6);
+                assert_true(std::abs(kernels->sum_f64(double_data, size) - scalar.sum_f64(double_data, size)) < 1e-6);
+                assert_true(std::abs(kernels->dot_f32(float_data, float_data + 1, size) - scalar.dot_f32(float_data, float_data + 1, size)) <
+                            1e-6);
+                assert_true(std::abs(kernels->dot_f64(double_data, double_data + 1, size) - scalar.dot_f64(double_data, double_data + 1, size)) <
+                            1e-6);
+
+                float min = std::numeric_limits<float>::max(), max = std::numeric_limits<float>::lowest();
+                float expected_min = min, expected_max = max;
+                kernels->min_max_f32(float_data, size, min, max);
+                scalar.min_max_f32(float_data, size, expected_min, expected_max);
+                assert_equal(min, expected_min);
+                assert_equal(max, expected_max);
+
+                int32_t int_min = 0, int_max = 0;  // folds into what's passed in
+                int32_t expected_int_min = 0, expected_int_max = 0;
+                kernels->min_max_i32(int_data, size, int_min, int_max);
+                scalar.min_max_i32(int_data, size, expected_int_min, expected_int_max);
+                assert_equal(int_min, expected_int_min);
+                assert_equal(int_max, expected_int_max);
+
+                // an irregular range and bin count, so positions are rounded and clamped
+                const float low = -9.3f, high = 11.1f;
+                const size_t bin_count = 13;
+                const auto scale = static_cast<float>(bin_count) / (high - low);
+
+                std::vector<uint64_t> bins(bin_count), expected_bins(bin_count);
+                kernels->histogram_f32(float_data, size, low, high, scale, bins.data(), bin_count);
+                scalar.histogram_f32(float_data, size, low, high, scale, expected_bins.data(), bin_count);
+                assert_true(bins == expected_bins);
+            }
+        }
+
+        // degenerate ranges make every position NaN (a zero scale times an infinite offset, or an infinite scale times
+        // a zero offset): the kernels must still count within bins. the bins are surrounded by guards that must stay 0.
+        std::vector<float> extremes;
+        for (size_t i = 0; i < 37; i++) {
+            const float pattern[] = {std::numeric_limits<float>::lowest(),
+                                     std::numeric_limits<float>::max(),
+                                     0.0f,
+                                     -1.0f,
+                                     1e30f,
+                                     std::numeric_limits<float>::denorm_min(),
+                                     std::nanf(""),
+                                     std::numeric_limits<float>::infinity()};
+            extremes.emplace_back(pattern[i % std::size(pattern)]);
+        }
+
+        const std::pair<float, float> degenerate_ranges[] = {
+            {std::numeric_limits<float>::lowest(), std::numeric_limits<float>::max()},
+            {0.0f, std::numeric_limits<float>::denorm_min()}};
+
+        for (const auto& [low, high] : degenerate_ranges) {
+            const size_t bin_count = 16;
+            const auto scale = static_cast<float>(bin_count) / (high - low);
+            std::vector<uint64_t> bins(bin_count + 2), expected_bins(bin_count + 2);
+
+            kernels->histogram_f32(extremes.data(), extremes.size(), low, high, scale, bins.data() + 1, bin_count);
+            scalar.histogram_f32(extremes.data(), extremes.size(), low, high, scale, expected_bins.data() + 1, bin_count);
+
+            const auto in_range = std::count_if(extremes.begin(), extremes.end(), [low, high](auto value) {
+                return value >= low && value < high;
+            });
+
+            assert_true(bins == expected_bins);
+            assert_equal(bins.front(), static_cast<uint64_t>(0));
+            assert_equal(bins.back(), static_cast<uint64_t>(0));
+            assert_equal(std::accumulate(bins.begin(), bins.end(), uint64_t(0)), static_cast<uint64_t>(in_range));
+        }
+    }
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("numeric test");
+
+    tester.add_step("null executor", test_numeric_null_executor);
+    tester.add_step("invalid arguments", test_numeric_invalid_arguments);
+    tester.add_step("sum", test_numeric_sum);
+    tester.add_step("min_max", test_numeric_min_max);
+    tester.add_step("dot", test_numeric_dot);
+    tester.add_step("histogram", test_numeric_histogram);
+    tester.add_step("kernels", test_numeric_kernels);
+
+    tester.launch_test();
+    return 0;
+}
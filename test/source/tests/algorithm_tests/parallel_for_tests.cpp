@@ -0,0 +1,213 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/executor_shutdowner.h"
+
+#include <vector>
+#include <numeric>
+
+namespace concurrencpp::tests {
+    void test_parallel_for_null_executor();
+    void test_parallel_for_empty_range();
+    void test_parallel_for_indices();
+    void test_parallel_for_iterators();
+    void test_parallel_for_grain_size();
+    void test_parallel_for_exception();
+    void test_parallel_for_nested();
+    void test_async_parallel_for();
+}  // namespace concurrencpp::tests
+
+using concurrencpp::parallel_for;
+using concurrencpp::async_parallel_for;
+
+void concurrencpp::tests::test_parallel_for_null_executor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            parallel_for(std::shared_ptr<thread_pool_executor> {}, 0, 10, [](int) {
+            });
+        },
+        concurrencpp::details::consts::k_parallel_for_null_executor_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_parallel_for(std::shared_ptr<thread_pool_executor> {}, 0, 10, [](int) {
+            });
+        },
+        concurrencpp::details::consts::k_parallel_for_null_executor_err_msg);
+}
+
+void concurrencpp::tests::test_parallel_for_empty_range() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    size_t invocations = 0;
+    parallel_for(executor, 10, 10, [&invocations](int) {
+        ++invocations;
+    });
+
+    parallel_for(executor, 10, 0, [&invocations](int) {
+        ++invocations;
+    });
+
+    assert_equal(invocations, static_cast<size_t>(0));
+}
+
+void concurrencpp::tests::test_parallel_for_indices() {
+    for (const size_t pool_size : {1, 2, 8}) {
+        auto executor = std::make_shared<thread_pool_executor>("threadpool", pool_size, std::chrono::seconds(10));
+        executor_shutdowner shutdown(executor);
+
+        for (const size_t size : {1, 7, 1'000, 100'000}) {
+            // every index is visited exactly once
+            std::vector<std::atomic_size_t> visits(size);
+            parallel_for(executor, size_t(0), size, [&visits](size_t i) {
+                visits[i].fetch_add(1, std::memory_order_relaxed);
+            });
+
+            for (const auto& visit_count : visits) {
+                assert_equal(visit_count.load(), static_cast<size_t>(1));
+            }
+        }
+
+        // a sub range of a signed range
+        std::vector<int> values(200, 0);
+        parallel_for(executor, -50, 50, [&values](int i) {
+            values[i + 100] = i;
+        });
+
+        for (int i = 0; i < 200; i++) {
+            assert_equal(values[i], (i >= 50 && i < 150) ? i - 100 : 0);
+        }
+    }
+}
+
+void concurrencpp::tests::test_parallel_for_iterators() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    std::vector<size_t> values(50'000);
+    std::iota(values.begin(), values.end(), 0);
+
+    parallel_for(executor, values.begin(), values.end(), [](size_t& value) {
+        value *= 2;
+    });
+
+    for (size_t i = 0; i < values.size(); i++) {
+        assert_equal(values[i], i * 2);
+    }
+}
+
+void concurrencpp::tests::test_parallel_for_grain_size() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    // a range no bigger than the grain size is never split, it runs on the calling thread
+    const auto this_thread = concurrencpp::details::thread::get_current_virtual_id();
+    std::vector<size_t> executing_threads(1'024);
+
+    parallel_for(
+        executor,
+        size_t(0),
+        executing_threads.size(),
+        [&executing_threads](size_t i) {
+            executing_threads[i] = concurrencpp::details::thread::get_current_virtual_id();
+        },
+        executing_threads.size());
+
+    for (const auto executing_thread : executing_threads) {
+        assert_equal(executing_thread, this_thread);
+    }
+}
+
+void concurrencpp::tests::test_parallel_for_exception() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    for (size_t i = 0; i < 16; i++) {
+        std::atomic_size_t invocations = 0;
+
+        // the leftmost failing chunk wins
+        assert_throws_with_error_message<std::runtime_error>(
+            [&] {
+                parallel_for(
+                    executor,
+                    0,
+                    1'024,
+                    [&invocations](int index) {
+                        invocations.fetch_add(1, std::memory_order_relaxed);
+                        if (index == 200) {
+                            throw std::runtime_error("200");
+                        }
+
+                        if (index == 900) {
+                            throw std::runtime_error("900");
+                        }
+                    },
+                    16);
+            },
+            "200");
+
+        assert_smaller_equal(invocations.load(), static_cast<size_t>(1'024));
+    }
+}
+
+void concurrencpp::tests::test_parallel_for_nested() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    constexpr size_t rows = 256, columns = 256;
+    std::vector<std::atomic_size_t> visits(rows * columns);
+
+    parallel_for(executor, size_t(0), rows, [&](size_t row) {
+        parallel_for(executor, size_t(0), columns, [&](size_t column) {
+            visits[row * columns + column].fetch_add(1, std::memory_order_relaxed);
+        });
+    });
+
+    for (const auto& visit_count : visits) {
+        assert_equal(visit_count.load(), static_cast<size_t>(1));
+    }
+}
+
+void concurrencpp::tests::test_async_parallel_for() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    std::vector<size_t> values(10'000, 0);
+    auto result = async_parallel_for(executor, size_t(0), values.size(), [&values](size_t i) {
+        values[i] = i + 1;
+    });
+
+    result.get();
+
+    for (size_t i = 0; i < values.size(); i++) {
+        assert_equal(values[i], i + 1);
+    }
+
+    auto failing_result = async_parallel_for(executor, 0, 100, [](int) {
+        throw std::runtime_error("error");
+    });
+
+    assert_throws<std::runtime_error>([&failing_result] {
+        failing_result.get();
+    });
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("parallel_for test");
+
+    tester.add_step("null executor", test_parallel_for_null_executor);
+    tester.add_step("empty range", test_parallel_for_empty_range);
+    tester.add_step("indices", test_parallel_for_indices);
+    tester.add_step("iterators", test_parallel_for_iterators);
+    tester.add_step("grain size", test_parallel_for_grain_size);
+    tester.add_step("exception", test_parallel_for_exception);
+    tester.add_step("nested", test_parallel_for_nested);
+    tester.add_step("async_parallel_for", test_async_parallel_for);
+
+    tester.launch_test();
+    return 0;
+}
@@ -0,0 +1,194 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/object_observer.h"
+#include "utils/executor_shutdowner.h"
+
+namespace concurrencpp::tests {
+    void test_parallel_invoke_null_executor();
+    void test_parallel_invoke_invokes_all();
+    void test_parallel_invoke_inline_when_busy();
+    void test_parallel_invoke_forks_to_idle_workers();
+    void test_parallel_invoke_exception();
+    void test_parallel_invoke_recursive();
+    void test_parallel_invoke_shutdown();
+
+    size_t fibonacci_sync(size_t n) noexcept {
+        return (n < 2) ? n : fibonacci_sync(n - 1) + fibonacci_sync(n - 2);
+    }
+}  // namespace concurrencpp::tests
+
+using concurrencpp::parallel_invoke;
+
+void concurrencpp::tests::test_parallel_invoke_null_executor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            parallel_invoke(std::shared_ptr<thread_pool_executor> {}, [] {
+            });
+        },
+        concurrencpp::details::consts::k_parallel_invoke_null_executor_err_msg);
+}
+
+void concurrencpp::tests::test_parallel_invoke_invokes_all() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    object_observer observer;
+    parallel_invoke(executor, observer.get_testing_stub());
+    assert_equal(observer.get_execution_count(), static_cast<size_t>(1));
+
+    parallel_invoke(executor,
+                    observer.get_testing_stub(),
+                    observer.get_testing_stub(),
+                    observer.get_testing_stub(),
+                    observer.get_testing_stub(),
+                    observer.get_testing_stub());
+
+    // parallel_invoke returns only after all the callables are done
+    assert_equal(observer.get_execution_count(), static_cast<size_t>(6));
+}
+
+void concurrencpp::tests::test_parallel_invoke_inline_when_busy() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 1, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    // the only worker is busy running this task, every callable is invoked inline by it
+    auto all_inline = executor->submit([executor] {
+        const auto this_thread = concurrencpp::details::thread::get_current_virtual_id();
+        size_t executing_threads[3] = {};
+
+        parallel_invoke(
+            executor,
+            [&] {
+                executing_threads[0] = concurrencpp::details::thread::get_current_virtual_id();
+            },
+            [&] {
+                executing_threads[1] = concurrencpp::details::thread::get_current_virtual_id();
+            },
+            [&] {
+                executing_threads[2] = concurrencpp::details::thread::get_current_virtual_id();
+            });
+
+        return executing_threads[0] == this_thread && executing_threads[1] == this_thread && executing_threads[2] == this_thread;
+    });
+
+    assert_true(all_inline.get());
+}
+
+void concurrencpp::tests::test_parallel_invoke_forks_to_idle_workers() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    // the first two callables can only finish if they run at the same time as the last one, on other threads
+    std::atomic_size_t arrived = 0;
+    const auto rendezvous = [&arrived] {
+        arrived.fetch_add(1);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        while (arrived.load() != 3 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+    };
+
+    parallel_invoke(executor, rendezvous, rendezvous, rendezvous);
+    assert_equal(arrived.load(), static_cast<size_t>(3));
+}
+
+void concurrencpp::tests::test_parallel_invoke_exception() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    // all the callables are invoked, the first exception is rethrown
+    for (size_t i = 0; i < 64; i++) {
+        object_observer observer;
+
+        assert_throws_with_error_message<std::runtime_error>(
+            [&] {
+                parallel_invoke(
+                    executor,
+                    observer.get_testing_stub(),
+                    [] {
+                        throw std::runtime_error("first");
+                    },
+                    observer.get_testing_stub(),
+                    [] {
+                        throw std::runtime_error("second");
+                    });
+            },
+            "first");
+
+        assert_equal(observer.get_execution_count(), static_cast<size_t>(2));
+    }
+}
+
+void concurrencpp::tests::test_parallel_invoke_recursive() {
+    struct fibonacci {
+        static void run(const std::shared_ptr<thread_pool_executor>& executor, size_t n, size_t& result) {
+            if (n < 2) {
+                result = n;
+                return;
+            }
+
+            size_t lhs = 0, rhs = 0;
+            parallel_invoke(
+                executor,
+                [&] {
+                    run(executor, n - 1, lhs);
+                },
+                [&] {
+                    run(executor, n - 2, rhs);
+                });
+
+            result = lhs + rhs;
+        }
+    };
+
+    for (const size_t pool_size : {1, 2, 8}) {
+        auto executor = std::make_shared<thread_pool_executor>("threadpool", pool_size, std::chrono::seconds(10));
+        executor_shutdowner shutdown(executor);
+
+        // from outside of the pool
+        size_t result = 0;
+        fibonacci::run(executor, 20, result);
+        assert_equal(result, fibonacci_sync(20));
+
+        // from inside of the pool
+        auto pool_result = executor->submit([executor] {
+            size_t result = 0;
+            fibonacci::run(executor, 20, result);
+            return result;
+        });
+
+        assert_equal(pool_result.get(), fibonacci_sync(20));
+    }
+}
+
+void concurrencpp::tests::test_parallel_invoke_shutdown() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor->shutdown();
+
+    // the callables handed to a shut down pool fail with broken_task, the ones invoked inline still run
+    object_observer observer;
+    assert_throws<concurrencpp::errors::broken_task>([executor, &observer] {
+        parallel_invoke(executor, observer.get_testing_stub(), observer.get_testing_stub());
+    });
+
+    assert_equal(observer.get_execution_count(), static_cast<size_t>(1));
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("parallel_invoke test");
+
+    tester.add_step("null executor", test_parallel_invoke_null_executor);
+    tester.add_step("invokes all", test_parallel_invoke_invokes_all);
+    tester.add_step("inline when busy", test_parallel_invoke_inline_when_busy);
+    tester.add_step("forks to idle workers", test_parallel_invoke_forks_to_idle_workers);
+    tester.add_step("exception", test_parallel_invoke_exception);
+    tester.add_step("recursive", test_parallel_invoke_recursive);
+    tester.add_step("shutdown", test_parallel_invoke_shutdown);
+
+    tester.launch_test();
+    return 0;
+}
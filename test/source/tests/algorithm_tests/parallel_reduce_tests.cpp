@@ -0,0 +1,175 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/executor_shutdowner.h"
+
+#include <string>
+#include <vector>
+#include <numeric>
+
+namespace concurrencpp::tests {
+    void test_parallel_reduce_null_executor();
+    void test_parallel_reduce_empty_range();
+    void test_parallel_reduce_sum();
+    void test_parallel_reduce_order();
+    void test_parallel_transform_reduce();
+    void test_parallel_reduce_exception();
+    void test_async_parallel_reduce();
+}  // namespace concurrencpp::tests
+
+using concurrencpp::parallel_reduce;
+using concurrencpp::parallel_transform_reduce;
+using concurrencpp::async_parallel_reduce;
+using concurrencpp::async_parallel_transform_reduce;
+
+void concurrencpp::tests::test_parallel_reduce_null_executor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            parallel_reduce(std::shared_ptr<thread_pool_executor> {}, 0, 10, 0);
+        },
+        concurrencpp::details::consts::k_parallel_reduce_null_executor_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            parallel_transform_reduce(std::shared_ptr<thread_pool_executor> {}, 0, 10, 0, std::plus<> {}, [](int i) {
+                return i;
+            });
+        },
+        concurrencpp::details::consts::k_parallel_transform_reduce_null_executor_err_msg);
+}
+
+void concurrencpp::tests::test_parallel_reduce_empty_range() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    const std::vector<int> values;
+    assert_equal(parallel_reduce(executor, values.begin(), values.end(), 17), 17);
+    assert_equal(parallel_reduce(executor, 5, 5, 17), 17);
+}
+
+void concurrencpp::tests::test_parallel_reduce_sum() {
+    for (const size_t pool_size : {1, 2, 8}) {
+        auto executor = std::make_shared<thread_pool_executor>("threadpool", pool_size, std::chrono::seconds(10));
+        executor_shutdowner shutdown(executor);
+
+        for (const size_t size : {1, 7, 1'000, 1'000'000}) {
+            std::vector<size_t> values(size);
+            std::iota(values.begin(), values.end(), 1);
+
+            const auto expected = size * (size + 1) / 2;
+            assert_equal(parallel_reduce(executor, values.begin(), values.end(), size_t(0)), expected);
+            assert_equal(parallel_reduce(executor, size_t(1), size + 1, size_t(0)), expected);
+            assert_equal(parallel_reduce(executor, values.cbegin(), values.cend(), size_t(10), std::plus<> {}, 64), expected + 10);
+        }
+    }
+}
+
+void concurrencpp::tests::test_parallel_reduce_order() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    // string concatenation is associative but not commutative, partial values must be combined in range order
+    std::vector<std::string> letters;
+    std::string expected = "start:";
+
+    for (size_t i = 0; i < 20'000; i++) {
+        letters.emplace_back(1, static_cast<char>('a' + i % 26));
+        expected += letters.back();
+    }
+
+    for (size_t i = 0; i < 8; i++) {
+        const auto concatenated = parallel_reduce(executor, letters.begin(), letters.end(), std::string("start:"), std::plus<> {}, 16);
+        assert_equal(concatenated, expected);
+    }
+}
+
+void concurrencpp::tests::test_parallel_transform_reduce() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    // a dot product over indices
+    std::vector<double> lhs(100'000), rhs(100'000);
+    for (size_t i = 0; i < lhs.size(); i++) {
+        lhs[i] = static_cast<double>(i % 10);
+        rhs[i] = 2.0;
+    }
+
+    const auto dot = parallel_transform_reduce(executor, size_t(0), lhs.size(), 0.0, std::plus<> {}, [&](size_t i) {
+        return lhs[i] * rhs[i];
+    });
+
+    assert_equal(dot, std::inner_product(lhs.begin(), lhs.end(), rhs.begin(), 0.0));
+
+    // a maximum over iterators
+    const auto max_length = parallel_transform_reduce(
+        executor,
+        lhs.begin(),
+        lhs.end(),
+        size_t(0),
+        [](size_t a, size_t b) {
+            return std::max(a, b);
+        },
+        [](double value) {
+            return static_cast<size_t>(value);
+        });
+
+    assert_equal(max_length, static_cast<size_t>(9));
+}
+
+void concurrencpp::tests::test_parallel_reduce_exception() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    assert_throws_with_error_message<std::runtime_error>(
+        [executor] {
+            parallel_transform_reduce(
+                executor,
+                0,
+                10'000,
+                0,
+                std::plus<> {},
+                [](int i) {
+                    if (i == 5'000) {
+                        throw std::runtime_error("transform");
+                    }
+
+                    return i;
+                },
+                32);
+        },
+        "transform");
+}
+
+void concurrencpp::tests::test_async_parallel_reduce() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    std::vector<size_t> values(100'000, 3);
+
+    auto sum = async_parallel_reduce(executor, values.begin(), values.end(), size_t(0));
+    assert_equal(sum.get(), static_cast<size_t>(300'000));
+
+    auto squares = async_parallel_transform_reduce(executor, size_t(0), size_t(100), size_t(0), std::plus<> {}, [](size_t i) {
+        return i * i;
+    });
+
+    assert_equal(squares.get(), static_cast<size_t>(328'350));
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("parallel_reduce test");
+
+    tester.add_step("null executor", test_parallel_reduce_null_executor);
+    tester.add_step("empty range", test_parallel_reduce_empty_range);
+    tester.add_step("sum", test_parallel_reduce_sum);
+    tester.add_step("order", test_parallel_reduce_order);
+    tester.add_step("parallel_transform_reduce", test_parallel_transform_reduce);
+    tester.add_step("exception", test_parallel_reduce_exception);
+    tester.add_step("async_parallel_reduce", test_async_parallel_reduce);
+
+    tester.launch_test();
+    return 0;
+}
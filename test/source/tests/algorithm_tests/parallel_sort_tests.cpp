@@ -0,0 +1,284 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/executor_shutdowner.h"
+
+#include <random>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+
+namespace concurrencpp::tests {
+    void test_parallel_sort_null_executor();
+    void test_parallel_sort_thread_pool();
+    void test_parallel_sort_other_executors();
+    void test_parallel_sort_duplicates();
+    void test_parallel_sort_exception();
+    void test_parallel_stable_sort();
+    void test_parallel_partition();
+
+    std::vector<int> make_random_vector(size_t size, int max_value, unsigned seed) {
+        std::default_random_engine generator(seed);
+        std::uniform_int_distribution<int> distribution(0, max_value);
+
+        std::vector<int> values(size);
+        for (auto& value : values) {
+            value = distribution(generator);
+        }
+
+        return values;
+    }
+
+    template<class executor_type>
+    void test_parallel_sort_sizes(const std::shared_ptr<executor_type>& executor) {
+        for (const size_t size : {0, 1, 2, 100, 5'000, 300'000}) {
+            auto values = make_random_vector(size, 1'000'000'000, static_cast<unsigned>(size));
+            auto expected = values;
+            std::sort(expected.begin(), expected.end());
+
+            concurrencpp::parallel_sort(executor, values.begin(), values.end());
+            assert_true(values == expected);
+
+            concurrencpp::parallel_sort(executor, values.begin(), values.end(), std::greater<> {});
+            assert_true(std::is_sorted(values.begin(), values.end(), std::greater<> {}));
+        }
+    }
+}  // namespace concurrencpp::tests
+
+using concurrencpp::parallel_sort;
+using concurrencpp::parallel_stable_sort;
+using concurrencpp::parallel_partition;
+
+void concurrencpp::tests::test_parallel_sort_null_executor() {
+    std::vector<int> values {3, 2, 1};
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&values] {
+            parallel_sort(std::shared_ptr<thread_pool_executor> {}, values.begin(), values.end());
+        },
+        concurrencpp::details::consts::k_parallel_sort_null_executor_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&values] {
+            parallel_stable_sort(std::shared_ptr<thread_pool_executor> {}, values.begin(), values.end());
+        },
+        concurrencpp::details::consts::k_parallel_stable_sort_null_executor_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&values] {
+            parallel_partition(std::shared_ptr<thread_pool_executor> {}, values.begin(), values.end(), [](int) {
+                return true;
+            });
+        },
+        concurrencpp::details::consts::k_parallel_partition_null_executor_err_msg);
+}
+
+void concurrencpp::tests::test_parallel_sort_thread_pool() {
+    for (const size_t pool_size : {1, 4}) {
+        auto executor = std::make_shared<thread_pool_executor>("threadpool", pool_size, std::chrono::seconds(10));
+        executor_shutdowner shutdown(executor);
+
+        test_parallel_sort_sizes(executor);
+
+        // from inside of the pool
+        auto values = make_random_vector(200'000, 1'000, 7);
+        executor
+            ->submit([executor, &values] {
+                parallel_sort(executor, values.begin(), values.end());
+            })
+            .get();
+
+        assert_true(std::is_sorted(values.begin(), values.end()));
+    }
+}
+
+void concurrencpp::tests::test_parallel_sort_other_executors() {
+    {
+        auto executor = std::make_shared<inline_executor>();
+        test_parallel_sort_sizes(executor);
+    }
+
+    {
+        auto executor = std::make_shared<thread_executor>();
+        executor_shutdowner shutdown(executor);
+        test_parallel_sort_sizes(executor);
+    }
+
+    {
+        auto executor = std::make_shared<worker_thread_executor>();
+        executor_shutdowner shutdown(executor);
+        test_parallel_sort_sizes(executor);
+    }
+
+    // nothing loops a manual_executor but the calling thread, so nothing may be forked to it
+    {
+        auto executor = std::make_shared<manual_executor>();
+        executor_shutdowner shutdown(executor);
+        test_parallel_sort_sizes(executor);
+        test_parallel_sort_sizes(std::static_pointer_cast<concurrencpp::executor>(executor));
+
+        auto values = make_random_vector(300'000, 1'000, 5);
+        auto expected = values;
+        std::stable_sort(expected.begin(), expected.end());
+
+        parallel_stable_sort(executor, values.begin(), values.end());
+        assert_true(values == expected);
+
+        const auto is_even = [](int value) {
+            return value % 2 == 0;
+        };
+
+        const auto middle = parallel_partition(executor, values.begin(), values.end(), is_even);
+        assert_true(std::all_of(values.begin(), middle, is_even));
+        assert_true(std::none_of(middle, values.end(), is_even));
+
+        assert_true(executor->empty());
+    }
+}
+
+void concurrencpp::tests::test_parallel_sort_duplicates() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    // few distinct values, and a single one
+    for (const int max_value : {0, 3}) {
+        auto values = make_random_vector(2'000'000, max_value, 11);
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        parallel_sort(executor, values.begin(), values.end());
+        assert_true(values == expected);
+    }
+
+    // already sorted and reversed ranges
+    std::vector<int> values(1'000'000);
+    std::iota(values.begin(), values.end(), 0);
+    parallel_sort(executor, values.begin(), values.end());
+    assert_true(std::is_sorted(values.begin(), values.end()));
+
+    std::reverse(values.begin(), values.end());
+    parallel_sort(executor, values.begin(), values.end());
+    assert_true(std::is_sorted(values.begin(), values.end()));
+}
+
+void concurrencpp::tests::test_parallel_sort_exception() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    auto values = make_random_vector(100'000, 100'000, 3);
+    std::atomic_size_t comparisons = 0;
+
+    assert_throws_with_error_message<std::runtime_error>(
+        [&] {
+            parallel_sort(executor, values.begin(), values.end(), [&comparisons](int a, int b) {
+                if (comparisons.fetch_add(1, std::memory_order_relaxed) == 50'000) {
+                    throw std::runtime_error("compare");
+                }
+
+                return a < b;
+            });
+        },
+        "compare");
+
+    // the range still holds the same elements
+    auto expected = make_random_vector(100'000, 100'000, 3);
+    std::sort(values.begin(), values.end());
+    std::sort(expected.begin(), expected.end());
+    assert_true(values == expected);
+}
+
+void concurrencpp::tests::test_parallel_stable_sort() {
+    struct element {
+        int key;
+        size_t position;
+    };
+
+    const auto by_key = [](const element& a, const element& b) {
+        return a.key < b.key;
+    };
+
+    auto thread_pool = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown_pool(thread_pool);
+
+    auto thread_executor = std::make_shared<concurrencpp::thread_executor>();
+    executor_shutdowner shutdown_thread_executor(thread_executor);
+
+    for (const size_t size : {0, 10, 5'000, 300'000}) {
+        const auto keys = make_random_vector(size, 100, static_cast<unsigned>(size));
+
+        std::vector<element> expected(size);
+        for (size_t i = 0; i < size; i++) {
+            expected[i] = {keys[i], i};
+        }
+
+        auto values = expected;
+        auto other_values = expected;
+        std::stable_sort(expected.begin(), expected.end(), by_key);
+
+        parallel_stable_sort(thread_pool, values.begin(), values.end(), by_key);
+        parallel_stable_sort(thread_executor, other_values.begin(), other_values.end(), by_key);
+
+        for (size_t i = 0; i < size; i++) {
+            assert_equal(values[i].key, expected[i].key);
+            assert_equal(values[i].position, expected[i].position);
+            assert_equal(other_values[i].position, expected[i].position);
+        }
+    }
+
+    // move only elements
+    std::vector<std::unique_ptr<int>> pointers;
+    for (const auto value : make_random_vector(50'000, 1'000, 5)) {
+        pointers.emplace_back(std::make_unique<int>(value));
+    }
+
+    parallel_stable_sort(thread_pool, pointers.begin(), pointers.end(), [](const auto& a, const auto& b) {
+        return *a < *b;
+    });
+
+    assert_true(std::is_sorted(pointers.begin(), pointers.end(), [](const auto& a, const auto& b) {
+        return *a < *b;
+    }));
+}
+
+void concurrencpp::tests::test_parallel_partition() {
+    auto thread_pool = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(thread_pool);
+
+    const auto is_even = [](int value) {
+        return value % 2 == 0;
+    };
+
+    for (const size_t size : {0, 1, 1'000, 100'000, 1'000'000}) {
+        for (const int max_value : {0, 1, 1'000}) {
+            auto values = make_random_vector(size, max_value, static_cast<unsigned>(size + max_value));
+            auto sorted_values = values;
+            std::sort(sorted_values.begin(), sorted_values.end());
+
+            const auto partition_point = parallel_partition(thread_pool, values.begin(), values.end(), is_even);
+
+            assert_true(std::all_of(values.begin(), partition_point, is_even));
+            assert_true(std::none_of(partition_point, values.end(), is_even));
+
+            std::sort(values.begin(), values.end());
+            assert_true(values == sorted_values);
+        }
+    }
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("parallel_sort test");
+
+    tester.add_step("null executor", test_parallel_sort_null_executor);
+    tester.add_step("thread pool", test_parallel_sort_thread_pool);
+    tester.add_step("other executors", test_parallel_sort_other_executors);
+    tester.add_step("duplicates", test_parallel_sort_duplicates);
+    tester.add_step("exception", test_parallel_sort_exception);
+    tester.add_step("parallel_stable_sort", test_parallel_stable_sort);
+    tester.add_step("parallel_partition", test_parallel_partition);
+
+    tester.launch_test();
+    return 0;
+}
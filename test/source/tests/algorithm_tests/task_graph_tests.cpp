@@ -0,0 +1,322 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/random.h"
+#include "utils/object_observer.h"
+#include "utils/executor_shutdowner.h"
+
+#include <vector>
+
+namespace concurrencpp::tests {
+    void test_task_graph_null_executor();
+    void test_task_graph_unknown_node();
+    void test_task_graph_cycle();
+    void test_task_graph_empty();
+    void test_task_graph_dependency_order();
+    void test_task_graph_rerun();
+    void test_task_graph_running();
+    void test_task_graph_exception();
+    void test_task_graph_shutdown();
+
+    struct ordered_graph {
+        task_graph graph;
+        std::vector<std::pair<size_t, size_t>> edges;
+        std::vector<size_t> finish_order;
+        std::atomic_size_t counter {0};
+
+        // a random dag: edges only lead from a node to a node added after it
+        explicit ordered_graph(size_t node_count) : finish_order(node_count) {
+            random randomizer;
+
+            for (size_t i = 0; i < node_count; i++) {
+                graph.add_node([this, i] {
+                    finish_order[i] = counter.fetch_add(1) + 1;
+                });
+            }
+
+            for (size_t to = 1; to < node_count; to++) {
+                const auto predecessors = randomizer(0, 3);
+                for (intptr_t j = 0; j < predecessors; j++) {
+                    const auto from = static_cast<size_t>(randomizer(0, static_cast<intptr_t>(to - 1)));
+                    graph.add_edge(from, to);
+                    edges.emplace_back(from, to);
+                }
+            }
+        }
+
+        void run_and_check(std::shared_ptr<executor> executor) {
+            counter = 0;
+            std::fill(finish_order.begin(), finish_order.end(), 0);
+
+            graph.run(std::move(executor)).get();
+
+            assert_equal(counter.load(), finish_order.size());
+            for (const auto order : finish_order) {
+                assert_not_equal(order, static_cast<size_t>(0));
+            }
+
+            for (const auto& edge : edges) {
+                assert_smaller(finish_order[edge.first], finish_order[edge.second]);
+            }
+        }
+    };
+}  // namespace concurrencpp::tests
+
+using concurrencpp::task_graph;
+
+void concurrencpp::tests::test_task_graph_null_executor() {
+    task_graph graph;
+    graph.add_node([] {
+    });
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&graph] {
+            graph.run({});
+        },
+        concurrencpp::details::consts::k_task_graph_null_executor_err_msg);
+
+    assert_false(graph.running());
+}
+
+void concurrencpp::tests::test_task_graph_unknown_node() {
+    task_graph graph;
+    const auto node = graph.add_node([] {
+    });
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&graph, node] {
+            graph.add_edge(node, node + 1);
+        },
+        concurrencpp::details::consts::k_task_graph_unknown_node_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&graph, node] {
+            graph.add_edge(node + 1, node);
+        },
+        concurrencpp::details::consts::k_task_graph_unknown_node_err_msg);
+
+    assert_equal(graph.edge_count(), static_cast<size_t>(0));
+}
+
+void concurrencpp::tests::test_task_graph_cycle() {
+    auto executor = std::make_shared<inline_executor>();
+    object_observer observer;
+    task_graph graph;
+
+    const auto first = graph.add_node(observer.get_testing_stub());
+    const auto second = graph.add_node(observer.get_testing_stub());
+    const auto third = graph.add_node(observer.get_testing_stub());
+    graph.add_edge(first, second);
+    graph.add_edge(second, third);
+    graph.add_edge(third, second);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            graph.run(executor);
+        },
+        concurrencpp::details::consts::k_task_graph_cycle_err_msg);
+
+    assert_false(graph.running());
+    assert_equal(observer.get_execution_count(), static_cast<size_t>(0));
+
+    // a node that depends on itself
+    task_graph self_loop;
+    const auto node = self_loop.add_node(observer.get_testing_stub());
+    self_loop.add_edge(node, node);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            self_loop.run(executor);
+        },
+        concurrencpp::details::consts::k_task_graph_cycle_err_msg);
+}
+
+void concurrencpp::tests::test_task_graph_empty() {
+    task_graph graph;
+    auto result = graph.run(std::make_shared<inline_executor>());
+
+    assert_equal(result.status(), result_status::value);
+    assert_false(graph.running());
+    assert_equal(graph.size(), static_cast<size_t>(0));
+}
+
+void concurrencpp::tests::test_task_graph_dependency_order() {
+    auto thread_pool = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    auto worker_thread = std::make_shared<worker_thread_executor>();
+    executor_shutdowner shutdown_0(thread_pool), shutdown_1(worker_thread);
+
+    for (const size_t node_count : {1, 2, 16, 1'024}) {
+        ordered_graph graph(node_count);
+        graph.run_and_check(std::make_shared<inline_executor>());
+        graph.run_and_check(worker_thread);
+        graph.run_and_check(thread_pool);
+    }
+
+    // a diamond: the join node runs once, after both branches
+    task_graph graph;
+    std::atomic_size_t branches = 0;
+    size_t branches_at_join = 0;
+
+    const auto source = graph.add_node([] {
+    });
+    const auto left = graph.add_node([&] {
+        branches.fetch_add(1);
+    });
+    const auto right = graph.add_node([&] {
+        branches.fetch_add(1);
+    });
+    const auto join = graph.add_node([&] {
+        branches_at_join = branches.load();
+    });
+
+    graph.add_edge(source, left);
+    graph.add_edge(source, right);
+    graph.add_edge(left, join);
+    graph.add_edge(right, join);
+
+    graph.run(thread_pool).get();
+    assert_equal(branches_at_join, static_cast<size_t>(2));
+}
+
+void concurrencpp::tests::test_task_graph_rerun() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    ordered_graph graph(512);
+    for (size_t i = 0; i < 32; i++) {
+        graph.run_and_check(executor);
+    }
+
+    // a change recompiles the graph, the next run respects the new edge
+    graph.finish_order.resize(513);
+    const auto last = graph.graph.add_node([&graph] {
+        graph.finish_order[512] = graph.counter.fetch_add(1) + 1;
+    });
+
+    graph.graph.add_edge(0, last);
+    graph.graph.run(executor).get();
+
+    assert_equal(graph.finish_order.size(), static_cast<size_t>(513));
+    assert_smaller(graph.finish_order[0], graph.finish_order.back());
+}
+
+void concurrencpp::tests::test_task_graph_running() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 2, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    std::atomic_bool release = false;
+    task_graph graph;
+    graph.add_node([&release] {
+        release.wait(false);
+    });
+
+    auto result = graph.run(executor);
+    assert_true(graph.running());
+
+    assert_throws_contains_error_message<std::system_error>(
+        [&] {
+            graph.run(executor);
+        },
+        concurrencpp::details::consts::k_task_graph_running_err_msg);
+
+    assert_throws_contains_error_message<std::system_error>(
+        [&] {
+            graph.add_node([] {
+            });
+        },
+        concurrencpp::details::consts::k_task_graph_running_err_msg);
+
+    assert_throws_contains_error_message<std::system_error>(
+        [&] {
+            graph.add_edge(0, 0);
+        },
+        concurrencpp::details::consts::k_task_graph_running_err_msg);
+
+    release = true;
+    release.notify_all();
+
+    result.get();
+    assert_false(graph.running());
+    assert_equal(graph.size(), static_cast<size_t>(1));
+}
+
+void concurrencpp::tests::test_task_graph_exception() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    // source -> thrower -> dependent, source -> independent: only the dependent node is skipped for sure
+    object_observer dependent, independent;
+    task_graph graph;
+
+    const auto source = graph.add_node([] {
+    });
+    const auto thrower = graph.add_node([] {
+        throw std::runtime_error("node failed");
+    });
+    const auto dependent_node = graph.add_node(dependent.get_testing_stub());
+    const auto independent_node = graph.add_node(independent.get_testing_stub());
+
+    graph.add_edge(source, thrower);
+    graph.add_edge(thrower, dependent_node);
+    graph.add_edge(source, independent_node);
+
+    for (size_t i = 0; i < 16; i++) {
+        assert_throws_with_error_message<std::runtime_error>(
+            [&] {
+                graph.run(executor).get();
+            },
+            "node failed");
+
+        assert_false(graph.running());
+    }
+
+    assert_equal(dependent.get_execution_count(), static_cast<size_t>(0));
+
+    // a failed run doesn't leak into the next one
+    task_graph healthy;
+    healthy.add_node(independent.get_testing_stub());
+    healthy.run(executor).get();
+    healthy.run(executor).get();
+}
+
+void concurrencpp::tests::test_task_graph_shutdown() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor->shutdown();
+
+    object_observer observer;
+    task_graph graph;
+
+    const auto first = graph.add_node(observer.get_testing_stub());
+    const auto second = graph.add_node(observer.get_testing_stub());
+    graph.add_edge(first, second);
+
+    auto result = graph.run(executor);
+    assert_throws_with_error_message<concurrencpp::errors::broken_task>(
+        [&result] {
+            result.get();
+        },
+        concurrencpp::details::consts::k_task_graph_broken_task_err_msg);
+
+    assert_false(graph.running());
+    assert_equal(observer.get_execution_count(), static_cast<size_t>(0));
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("task_graph test");
+
+    tester.add_step("null executor", test_task_graph_null_executor);
+    tester.add_step("unknown node", test_task_graph_unknown_node);
+    tester.add_step("cycle", test_task_graph_cycle);
+    tester.add_step("empty", test_task_graph_empty);
+    tester.add_step("dependency order", test_task_graph_dependency_order);
+    tester.add_step("rerun", test_task_graph_rerun);
+    tester.add_step("running", test_task_graph_running);
+    tester.add_step("exception", test_task_graph_exception);
+    tester.add_step("shutdown", test_task_graph_shutdown);
+
+    tester.launch_test();
+    return 0;
+}
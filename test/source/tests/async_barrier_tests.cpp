@@ -0,0 +1,155 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/executor_shutdowner.h"
+
+#include "concurrencpp/threads/constants.h"
+
+namespace concurrencpp::tests {
+    void test_async_barrier_constructor();
+    void test_async_barrier_arrive_and_wait_null_resume_executor();
+    void test_async_barrier_arrive_and_wait();
+    void test_async_barrier_arrive_and_drop();
+    void test_async_barrier_phases();
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_barrier_constructor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_barrier barrier(0);
+        },
+        concurrencpp::details::consts::k_async_barrier_invalid_expected_err_msg);
+}
+
+void concurrencpp::tests::test_async_barrier_arrive_and_wait_null_resume_executor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_barrier barrier(1);
+            barrier.arrive_and_wait(std::shared_ptr<concurrencpp::inline_executor> {});
+        },
+        concurrencpp::details::consts::k_async_barrier_arrive_and_wait_null_resume_executor_err_msg);
+}
+
+void concurrencpp::tests::test_async_barrier_arrive_and_wait() {
+    size_t completions = 0;
+    async_barrier barrier(4, [&completions] {
+        ++completions;
+    });
+
+    const auto executor = std::make_shared<manual_executor>();
+    executor_shutdowner es(executor);
+
+    auto task = [&]() -> result<void> {
+        co_await barrier.arrive_and_wait(executor);
+    };
+
+    std::vector<result<void>> results;
+    for (size_t i = 0; i < 3; i++) {
+        results.emplace_back(task());
+        assert_equal(results.back().status(), result_status::idle);
+    }
+
+    assert_equal(completions, 0);
+
+    // the last participant completes the phase and continues inline
+    results.emplace_back(task());
+    assert_equal(results.back().status(), result_status::value);
+    assert_equal(completions, 1);
+    assert_equal(barrier.phase(), 1);
+
+    assert_equal(executor->size(), 3);
+    executor->loop(3);
+
+    for (auto& result : results) {
+        result.get();
+    }
+}
+
+void concurrencpp::tests::test_async_barrier_arrive_and_drop() {
+    async_barrier barrier(3);
+    const auto executor = std::make_shared<manual_executor>();
+    executor_shutdowner es(executor);
+
+    auto task = [&]() -> result<void> {
+        co_await barrier.arrive_and_wait(executor);
+    };
+
+    auto res0 = task();
+    barrier.arrive_and_drop();
+    assert_equal(res0.status(), result_status::idle);
+
+    auto res1 = task();
+    assert_equal(res1.status(), result_status::value);
+    assert_equal(executor->loop(1), 1);
+    res0.get();
+
+    // from now on, only two participants are expected
+    auto res2 = task();
+    assert_equal(res2.status(), result_status::idle);
+
+    auto res3 = task();
+    assert_equal(res3.status(), result_status::value);
+    assert_equal(executor->loop(1), 1);
+    res2.get();
+}
+
+void concurrencpp::tests::test_async_barrier_phases() {
+    const size_t worker_count = concurrencpp::details::thread::hardware_concurrency();
+    constexpr size_t phases = 1'000;
+
+    std::vector<size_t> values(worker_count, 0);
+    std::atomic_size_t errors = 0;
+    async_barrier barrier(worker_count);
+
+    std::vector<std::shared_ptr<worker_thread_executor>> workers(worker_count);
+    for (auto& worker : workers) {
+        worker = std::make_shared<worker_thread_executor>();
+    }
+
+    auto task = [&](executor_tag, std::shared_ptr<executor> ex, size_t index) -> result<void> {
+        for (size_t phase = 0; phase < phases; phase++) {
+            values[index] = phase;
+            co_await barrier.arrive_and_wait(ex);
+
+            for (const auto value : values) {
+                if (value != phase) {
+                    errors.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+
+            co_await barrier.arrive_and_wait(ex);
+        }
+    };
+
+    std::vector<result<void>> results(worker_count);
+    for (size_t i = 0; i < worker_count; i++) {
+        results[i] = task({}, workers[i], i);
+    }
+
+    for (auto& result : results) {
+        result.get();
+    }
+
+    assert_equal(errors.load(), 0);
+    assert_equal(barrier.phase(), phases * 2);
+
+    for (auto& worker : workers) {
+        worker->shutdown();
+    }
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("async_barrier test");
+
+    tester.add_step("constructor", test_async_barrier_constructor);
+    tester.add_step("arrive_and_wait - null resume executor", test_async_barrier_arrive_and_wait_null_resume_executor);
+    tester.add_step("arrive_and_wait", test_async_barrier_arrive_and_wait);
+    tester.add_step("arrive_and_drop", test_async_barrier_arrive_and_drop);
+    tester.add_step("phases", test_async_barrier_phases);
+
+    tester.launch_test();
+    return 0;
+}
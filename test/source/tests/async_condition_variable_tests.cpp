@@ -19,6 +19,14 @@ namespace concurrencpp::tests {
 
     void test_async_condition_variable_notify_one();
     void test_async_condition_variable_notify_all();
+    void test_async_condition_variable_notify_all_wait_morphing();
+
+    void test_async_condition_variable_await_for_null_timer_queue();
+    void test_async_condition_variable_await_for_timeout();
+    void test_async_condition_variable_await_for_notified();
+    void test_async_condition_variable_await_for_pred();
+    void test_async_condition_variable_await_until();
+    void test_async_condition_variable_await_for_mixed_awaiters();
 }  // namespace concurrencpp::tests
 
 using namespace concurrencpp::tests;
@@ -222,6 +230,208 @@ void tests::test_async_condition_variable_notify_all() {
     }
 }
 
+void tests::test_async_condition_variable_notify_all_wait_morphing() {
+    async_lock lock;
+    async_condition_variable cv;
+    size_t counter = 0;
+    const auto executor = std::make_shared<manual_executor>();
+    executor_shutdowner es(executor);
+
+    auto task = [&]() -> result<void> {
+        auto sal = co_await lock.lock(executor);
+        co_await cv.await(executor, sal);
+        ++counter;
+    };
+
+    std::vector<result<void>> results;
+    for (size_t i = 0; i < 16; i++) {
+        results.emplace_back(task());
+    }
+
+    auto guard = lock.lock(executor).run().get();
+    cv.notify_all();
+
+    // notified awaiters are moved to the lock, nobody is resumed while it's held
+    assert_equal(executor->size(), 0);
+
+    guard.unlock();
+
+    // every unlock hands the lock to exactly one former awaiter
+    for (size_t i = 0; i < results.size(); i++) {
+        assert_equal(executor->size(), 1);
+        assert_true(executor->loop_once());
+        assert_equal(counter, i + 1);
+    }
+
+    assert_equal(executor->size(), 0);
+
+    for (auto& result : results) {
+        result.get();
+    }
+}
+
+void tests::test_async_condition_variable_await_for_null_timer_queue() {
+    async_lock lock;
+    async_condition_variable cv;
+    const auto executor = std::make_shared<inline_executor>();
+    executor_shutdowner es(executor);
+
+    auto scoped_lock = lock.lock(executor).run().get();
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            cv.await_for({}, executor, scoped_lock, std::chrono::milliseconds(10));
+        },
+        concurrencpp::details::consts::k_async_condition_variable_await_for_null_timer_queue_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            cv.await_for({}, executor, scoped_lock, std::chrono::milliseconds(10), [] {
+                return true;
+            });
+        },
+        concurrencpp::details::consts::k_async_condition_variable_await_for_null_timer_queue_err_msg);
+}
+
+void tests::test_async_condition_variable_await_for_timeout() {
+    test_async_condition_variable_await_for_null_timer_queue();
+
+    async_lock lock;
+    async_condition_variable cv;
+    const auto timer_queue = std::make_shared<concurrencpp::timer_queue>(std::chrono::milliseconds(120 * 1000));
+    const auto executor = std::make_shared<inline_executor>();
+    executor_shutdowner es(executor);
+
+    auto task = [&]() -> result<std::cv_status> {
+        auto sal = co_await lock.lock(executor);
+        const auto status = co_await cv.await_for(timer_queue, executor, sal, std::chrono::milliseconds(150));
+        assert_true(sal.owns_lock());
+        co_return status;
+    };
+
+    const auto before = std::chrono::steady_clock::now();
+    auto res = task();
+    assert_equal(res.get(), std::cv_status::timeout);
+    assert_bigger_equal(std::chrono::steady_clock::now() - before, std::chrono::milliseconds(150));
+
+    // a notification that comes after the timeout finds nobody to wake
+    cv.notify_all();
+    assert_true(lock.try_lock().run().get());
+    lock.unlock();
+}
+
+void tests::test_async_condition_variable_await_for_notified() {
+    async_lock lock;
+    async_condition_variable cv;
+    const auto timer_queue = std::make_shared<concurrencpp::timer_queue>(std::chrono::milliseconds(120 * 1000));
+    const auto executor = std::make_shared<inline_executor>();
+    executor_shutdowner es(executor);
+
+    std::vector<result<std::cv_status>> results;
+    for (size_t i = 0; i < 16; i++) {
+        results.emplace_back([&]() -> result<std::cv_status> {
+            auto sal = co_await lock.lock(executor);
+            co_return co_await cv.await_for(timer_queue, executor, sal, std::chrono::hours(1));
+        }());
+    }
+
+    for (auto& result : results) {
+        assert_equal(result.status(), result_status::idle);
+    }
+
+    cv.notify_one();
+    assert_equal(results[0].status(), result_status::value);
+    assert_equal(results[1].status(), result_status::idle);
+
+    cv.notify_all();
+    for (auto& result : results) {
+        assert_equal(result.get(), std::cv_status::no_timeout);
+    }
+}
+
+void tests::test_async_condition_variable_await_for_pred() {
+    async_lock lock;
+    async_condition_variable cv;
+    bool ready = false;
+    const auto timer_queue = std::make_shared<concurrencpp::timer_queue>(std::chrono::milliseconds(120 * 1000));
+    const auto executor = std::make_shared<inline_executor>();
+    executor_shutdowner es(executor);
+
+    auto task = [&](std::chrono::milliseconds timeout) -> result<bool> {
+        auto sal = co_await lock.lock(executor);
+        co_return co_await cv.await_for(timer_queue, executor, sal, timeout, [&ready] {
+            return ready;
+        });
+    };
+
+    // spurious notifications don't end the wait before the timeout
+    auto timed_out = task(std::chrono::milliseconds(100));
+    cv.notify_all();
+    assert_false(timed_out.get());
+
+    auto notified = task(std::chrono::hours(1));
+    cv.notify_all();
+    assert_equal(notified.status(), result_status::idle);
+
+    {
+        auto sal = lock.lock(executor).run().get();
+        ready = true;
+    }
+
+    cv.notify_all();
+    assert_true(notified.get());
+
+    // the predicate is checked before suspending
+    assert_true(task(std::chrono::milliseconds(0)).get());
+}
+
+void tests::test_async_condition_variable_await_until() {
+    async_lock lock;
+    async_condition_variable cv;
+    const auto timer_queue = std::make_shared<concurrencpp::timer_queue>(std::chrono::milliseconds(120 * 1000));
+    const auto executor = std::make_shared<inline_executor>();
+    executor_shutdowner es(executor);
+
+    const auto deadline = std::chrono::system_clock::now() + std::chrono::milliseconds(100);
+
+    auto task = [&]() -> result<std::cv_status> {
+        auto sal = co_await lock.lock(executor);
+        co_return co_await cv.await_until(timer_queue, executor, sal, deadline);
+    };
+
+    assert_equal(task().get(), std::cv_status::timeout);
+    assert_bigger_equal(std::chrono::system_clock::now(), deadline);
+
+    // a deadline in the past times out right away
+    assert_equal(task().get(), std::cv_status::timeout);
+}
+
+void tests::test_async_condition_variable_await_for_mixed_awaiters() {
+    async_lock lock;
+    async_condition_variable cv;
+    const auto timer_queue = std::make_shared<concurrencpp::timer_queue>(std::chrono::milliseconds(120 * 1000));
+    const auto executor = std::make_shared<inline_executor>();
+    executor_shutdowner es(executor);
+
+    auto timed = [&]() -> result<std::cv_status> {
+        auto sal = co_await lock.lock(executor);
+        co_return co_await cv.await_for(timer_queue, executor, sal, std::chrono::milliseconds(50));
+    }();
+
+    auto untimed = [&]() -> result<void> {
+        auto sal = co_await lock.lock(executor);
+        co_await cv.await(executor, sal);
+    }();
+
+    assert_equal(timed.get(), std::cv_status::timeout);
+    assert_equal(untimed.status(), result_status::idle);
+
+    // the timed out awaiter left the queue, notify_one wakes the one behind it
+    cv.notify_one();
+    assert_equal(untimed.status(), result_status::value);
+    untimed.get();
+}
+
 int main() {
     tester tester("async_condition_variable test");
 
@@ -229,6 +439,12 @@ int main() {
     tester.add_step("await + pred", test_async_condition_variable_await_pred);
     tester.add_step("notify_one", test_async_condition_variable_notify_one);
     tester.add_step("notify_all", test_async_condition_variable_notify_all);
+    tester.add_step("notify_all - wait morphing", test_async_condition_variable_notify_all_wait_morphing);
+    tester.add_step("await_for - timeout", test_async_condition_variable_await_for_timeout);
+    tester.add_step("await_for - notified", test_async_condition_variable_await_for_notified);
+    tester.add_step("await_for + pred", test_async_condition_variable_await_for_pred);
+    tester.add_step("await_until", test_async_condition_variable_await_until);
+    tester.add_step("await_for - timed and untimed awaiters", test_async_condition_variable_await_for_mixed_awaiters);
 
     tester.launch_test();
     return 0;
@@ -0,0 +1,128 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/executor_shutdowner.h"
+
+#include "concurrencpp/threads/constants.h"
+
+namespace concurrencpp::tests {
+    void test_async_latch_wait_null_resume_executor();
+    void test_async_latch_count_down_invalid_update();
+    void test_async_latch_wait_released();
+    void test_async_latch_wait();
+    void test_async_latch_arrive_and_wait();
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_latch_wait_null_resume_executor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_latch latch(1);
+            latch.wait(std::shared_ptr<concurrencpp::inline_executor> {});
+        },
+        concurrencpp::details::consts::k_async_latch_wait_null_resume_executor_err_msg);
+}
+
+void concurrencpp::tests::test_async_latch_count_down_invalid_update() {
+    async_latch latch(2);
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            latch.count_down(3);
+        },
+        concurrencpp::details::consts::k_async_latch_count_down_invalid_update_err_msg);
+
+    assert_false(latch.try_wait());
+    latch.count_down(2);
+    assert_true(latch.try_wait());
+}
+
+void concurrencpp::tests::test_async_latch_wait_released() {
+    async_latch latch(0);
+    const auto executor = std::make_shared<manual_executor>();
+    executor_shutdowner es(executor);
+
+    auto task = [&]() -> result<void> {
+        co_await latch.wait(executor);
+    };
+
+    auto res = task();
+    assert_equal(res.status(), result_status::value);
+    assert_equal(executor->size(), 0);
+}
+
+void concurrencpp::tests::test_async_latch_wait() {
+    async_latch latch(4);
+    const auto executor = std::make_shared<manual_executor>();
+    executor_shutdowner es(executor);
+
+    auto task = [&]() -> result<void> {
+        co_await latch.wait(executor);
+    };
+
+    std::vector<result<void>> results;
+    for (size_t i = 0; i < 16; i++) {
+        results.emplace_back(task());
+    }
+
+    for (size_t i = 0; i < 3; i++) {
+        latch.count_down();
+        assert_equal(executor->size(), 0);
+    }
+
+    latch.count_down();
+    assert_equal(executor->size(), 16);
+    assert_equal(executor->loop(16), 16);
+
+    for (auto& result : results) {
+        result.get();
+    }
+}
+
+void concurrencpp::tests::test_async_latch_arrive_and_wait() {
+    const size_t worker_count = concurrencpp::details::thread::hardware_concurrency();
+    async_latch latch(worker_count);
+    std::atomic_size_t arrived = 0, early = 0;
+
+    std::vector<std::shared_ptr<worker_thread_executor>> workers(worker_count);
+    for (auto& worker : workers) {
+        worker = std::make_shared<worker_thread_executor>();
+    }
+
+    auto task = [&](executor_tag, std::shared_ptr<executor> ex) -> result<void> {
+        arrived.fetch_add(1, std::memory_order_relaxed);
+        co_await latch.arrive_and_wait(ex);
+        if (arrived.load(std::memory_order_relaxed) != worker_count) {
+            early.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    std::vector<result<void>> results(worker_count);
+    for (size_t i = 0; i < worker_count; i++) {
+        results[i] = task({}, workers[i]);
+    }
+
+    for (auto& result : results) {
+        result.get();
+    }
+
+    assert_equal(early.load(), 0);
+
+    for (auto& worker : workers) {
+        worker->shutdown();
+    }
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("async_latch test");
+
+    tester.add_step("wait - null resume executor", test_async_latch_wait_null_resume_executor);
+    tester.add_step("count_down - invalid update", test_async_latch_count_down_invalid_update);
+    tester.add_step("wait - released latch", test_async_latch_wait_released);
+    tester.add_step("wait", test_async_latch_wait);
+    tester.add_step("arrive_and_wait", test_async_latch_arrive_and_wait);
+
+    tester.launch_test();
+    return 0;
+}
@@ -0,0 +1,183 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/executor_shutdowner.h"
+
+#include "concurrencpp/threads/constants.h"
+
+namespace concurrencpp::tests {
+    void test_async_semaphore_acquire_null_resume_executor();
+    void test_async_semaphore_acquire_uncontended();
+    void test_async_semaphore_acquire_contended();
+    void test_async_semaphore_try_acquire();
+    void test_async_semaphore_release_n();
+    void test_async_semaphore_resumption_fails();
+    void test_async_semaphore_mini_load_test();
+
+    result<void> acquire_coro(async_semaphore& semaphore, std::shared_ptr<executor> ex, size_t& counter) {
+        co_await semaphore.acquire(ex);
+        ++counter;
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_semaphore_acquire_null_resume_executor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_semaphore semaphore(1);
+            semaphore.acquire(std::shared_ptr<concurrencpp::inline_executor> {});
+        },
+        concurrencpp::details::consts::k_async_semaphore_acquire_null_resume_executor_err_msg);
+}
+
+void concurrencpp::tests::test_async_semaphore_acquire_uncontended() {
+    async_semaphore semaphore(3);
+    size_t counter = 0;
+    const auto executor = std::make_shared<manual_executor>();
+    executor_shutdowner es(executor);
+
+    // available permits are acquired inline, without going through the resume executor
+    for (size_t i = 0; i < 3; i++) {
+        auto res = acquire_coro(semaphore, executor, counter);
+        assert_equal(res.status(), result_status::value);
+    }
+
+    assert_equal(counter, 3);
+    assert_equal(semaphore.approx_available(), 0);
+    assert_equal(executor->size(), 0);
+}
+
+void concurrencpp::tests::test_async_semaphore_acquire_contended() {
+    async_semaphore semaphore(0);
+    size_t counter = 0;
+    const auto executor = std::make_shared<manual_executor>();
+    executor_shutdowner es(executor);
+
+    auto res = acquire_coro(semaphore, executor, counter);
+    assert_equal(res.status(), result_status::idle);
+
+    semaphore.release();
+    assert_equal(executor->size(), 1);
+    assert_equal(counter, 0);
+
+    executor->loop_once();
+    res.get();
+    assert_equal(counter, 1);
+    assert_equal(semaphore.approx_available(), 0);
+}
+
+void concurrencpp::tests::test_async_semaphore_try_acquire() {
+    async_semaphore semaphore(2);
+    assert_true(semaphore.try_acquire());
+    assert_true(semaphore.try_acquire());
+    assert_false(semaphore.try_acquire());
+
+    semaphore.release();
+    assert_true(semaphore.try_acquire());
+    assert_false(semaphore.try_acquire());
+}
+
+void concurrencpp::tests::test_async_semaphore_release_n() {
+    async_semaphore semaphore(0);
+    size_t counter = 0;
+    const auto executor = std::make_shared<manual_executor>();
+    executor_shutdowner es(executor);
+
+    std::vector<result<void>> results;
+    for (size_t i = 0; i < 16; i++) {
+        results.emplace_back(acquire_coro(semaphore, executor, counter));
+    }
+
+    semaphore.release(10);
+    assert_equal(executor->size(), 10);
+    assert_false(semaphore.try_acquire());
+
+    semaphore.release(10);
+    assert_equal(executor->size(), 16);
+    assert_equal(semaphore.approx_available(), 4);
+
+    executor->loop(16);
+
+    for (auto& result : results) {
+        result.get();
+    }
+
+    assert_equal(counter, 16);
+}
+
+void concurrencpp::tests::test_async_semaphore_resumption_fails() {
+    // a permit granted to a coroutine whose resume executor was shut down is given back.
+    async_semaphore semaphore(0);
+    size_t counter = 0;
+    const auto executor = std::make_shared<manual_executor>();
+
+    auto res = acquire_coro(semaphore, executor, counter);
+    executor->shutdown();
+    semaphore.release();
+
+    assert_throws<errors::broken_task>([&] {
+        res.get();
+    });
+
+    assert_equal(counter, 0);
+    assert_true(semaphore.try_acquire());
+}
+
+void concurrencpp::tests::test_async_semaphore_mini_load_test() {
+    constexpr size_t max_concurrency = 3;
+    async_semaphore semaphore(max_concurrency);
+    std::atomic_size_t concurrency = 0, violations = 0;
+
+    const size_t worker_count = concurrencpp::details::thread::hardware_concurrency();
+    constexpr size_t cycles = 20'000;
+
+    std::vector<std::shared_ptr<worker_thread_executor>> workers(worker_count);
+    for (auto& worker : workers) {
+        worker = std::make_shared<worker_thread_executor>();
+    }
+
+    auto task = [&](executor_tag, std::shared_ptr<executor> ex) -> result<void> {
+        for (size_t i = 0; i < cycles; i++) {
+            co_await semaphore.acquire(ex);
+            if (concurrency.fetch_add(1, std::memory_order_relaxed) >= max_concurrency) {
+                violations.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            concurrency.fetch_sub(1, std::memory_order_relaxed);
+            semaphore.release();
+        }
+    };
+
+    std::vector<result<void>> results(worker_count);
+    for (size_t i = 0; i < worker_count; i++) {
+        results[i] = task({}, workers[i]);
+    }
+
+    for (auto& result : results) {
+        result.get();
+    }
+
+    assert_equal(violations.load(), 0);
+    assert_equal(semaphore.approx_available(), max_concurrency);
+
+    for (auto& worker : workers) {
+        worker->shutdown();
+    }
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("async_semaphore test");
+
+    tester.add_step("acquire - null resume executor", test_async_semaphore_acquire_null_resume_executor);
+    tester.add_step("acquire - uncontended", test_async_semaphore_acquire_uncontended);
+    tester.add_step("acquire - contended", test_async_semaphore_acquire_contended);
+    tester.add_step("try_acquire", test_async_semaphore_try_acquire);
+    tester.add_step("release(n)", test_async_semaphore_release_n);
+    tester.add_step("resumption fails", test_async_semaphore_resumption_fails);
+    tester.add_step("acquire + release", test_async_semaphore_mini_load_test);
+
+    tester.launch_test();
+    return 0;
+}
@@ -0,0 +1,264 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/executor_shutdowner.h"
+
+#include "concurrencpp/threads/constants.h"
+
+namespace concurrencpp::tests {
+    void test_async_shared_lock_lock_null_resume_executor();
+    void test_async_shared_lock_lock_shared_null_resume_executor();
+    void test_async_shared_lock_try_lock();
+    void test_async_shared_lock_try_lock_shared();
+    void test_async_shared_lock_unlock();
+    void test_async_shared_lock_readers_wake_together();
+    void test_async_shared_lock_writer_preference();
+    void test_async_shared_lock_resumption_fails();
+    void test_async_shared_lock_mini_load_test();
+
+    result<void> read_coro(async_shared_lock& lock, std::shared_ptr<executor> ex, size_t& counter) {
+        auto g = co_await lock.lock_shared(ex);
+        ++counter;
+    }
+
+    result<void> write_coro(async_shared_lock& lock, std::shared_ptr<executor> ex, size_t& counter) {
+        auto g = co_await lock.lock(ex);
+        ++counter;
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_shared_lock_lock_null_resume_executor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_shared_lock lock;
+            lock.lock(std::shared_ptr<concurrencpp::inline_executor> {});
+        },
+        concurrencpp::details::consts::k_async_shared_lock_lock_null_resume_executor_err_msg);
+}
+
+void concurrencpp::tests::test_async_shared_lock_lock_shared_null_resume_executor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_shared_lock lock;
+            lock.lock_shared(std::shared_ptr<concurrencpp::inline_executor> {});
+        },
+        concurrencpp::details::consts::k_async_shared_lock_lock_shared_null_resume_executor_err_msg);
+}
+
+void concurrencpp::tests::test_async_shared_lock_try_lock() {
+    async_shared_lock lock;
+    assert_true(lock.try_lock().run().get());
+    assert_false(lock.try_lock().run().get());
+    assert_false(lock.try_lock_shared().run().get());
+
+    lock.unlock();
+    assert_true(lock.try_lock_shared().run().get());
+    assert_false(lock.try_lock().run().get());
+
+    lock.unlock_shared();
+    assert_true(lock.try_lock().run().get());
+    lock.unlock();
+}
+
+void concurrencpp::tests::test_async_shared_lock_try_lock_shared() {
+    async_shared_lock lock;
+    for (size_t i = 0; i < 16; i++) {
+        assert_true(lock.try_lock_shared().run().get());
+    }
+
+    for (size_t i = 0; i < 16; i++) {
+        lock.unlock_shared();
+    }
+
+    assert_true(lock.try_lock().run().get());
+    lock.unlock();
+}
+
+void concurrencpp::tests::test_async_shared_lock_unlock() {
+    assert_throws_contains_error_message<std::system_error>(
+        [] {
+            async_shared_lock lock;
+            lock.unlock();
+        },
+        concurrencpp::details::consts::k_async_shared_lock_unlock_invalid_lock_err_msg);
+
+    assert_throws_contains_error_message<std::system_error>(
+        [] {
+            async_shared_lock lock;
+            lock.unlock_shared();
+        },
+        concurrencpp::details::consts::k_async_shared_lock_unlock_shared_invalid_lock_err_msg);
+
+    assert_throws_contains_error_message<std::system_error>(
+        [] {
+            scoped_async_shared_lock lock;
+            lock.unlock();
+        },
+        concurrencpp::details::consts::k_scoped_async_shared_lock_unlock_invalid_lock_err_msg);
+
+    assert_throws_contains_error_message<std::system_error>(
+        [] {
+            scoped_async_exclusive_lock lock;
+            lock.unlock();
+        },
+        concurrencpp::details::consts::k_scoped_async_exclusive_lock_unlock_invalid_lock_err_msg);
+}
+
+void concurrencpp::tests::test_async_shared_lock_readers_wake_together() {
+    async_shared_lock lock;
+    size_t counter = 0;
+    const auto executor = std::make_shared<manual_executor>();
+    executor_shutdowner es(executor);
+
+    auto writer_guard = lock.lock(executor).run().get();
+
+    std::vector<result<void>> results;
+    for (size_t i = 0; i < 32; i++) {
+        results.emplace_back(read_coro(lock, executor, counter));
+    }
+
+    assert_equal(executor->size(), 0);
+
+    writer_guard.unlock();
+
+    // all readers are granted shared ownership at once and scheduled together.
+    assert_equal(executor->size(), 32);
+    assert_false(lock.try_lock().run().get());
+
+    assert_equal(executor->loop(32), 32);
+
+    for (auto& result : results) {
+        result.get();
+    }
+
+    assert_equal(counter, 32);
+    assert_true(lock.try_lock().run().get());
+    lock.unlock();
+}
+
+void concurrencpp::tests::test_async_shared_lock_writer_preference() {
+    async_shared_lock lock;
+    size_t reads = 0, writes = 0;
+    const auto executor = std::make_shared<manual_executor>();
+    executor_shutdowner es(executor);
+
+    auto reader_guard = lock.lock_shared(executor).run().get();
+
+    auto writer = write_coro(lock, executor, writes);
+    auto reader = read_coro(lock, executor, reads);
+
+    // a waiting writer blocks new readers
+    assert_false(lock.try_lock_shared().run().get());
+    assert_equal(executor->size(), 0);
+
+    reader_guard.unlock();
+    assert_equal(executor->size(), 1);  // the writer
+
+    assert_true(executor->loop_once());
+    writer.get();
+    assert_equal(writes, 1);
+
+    // the writer released the lock inside write_coro, the reader is now scheduled
+    assert_equal(executor->size(), 1);
+    assert_true(executor->loop_once());
+    reader.get();
+    assert_equal(reads, 1);
+}
+
+void concurrencpp::tests::test_async_shared_lock_resumption_fails() {
+    // ownership handed to a coroutine whose resume executor was shut down must be released and passed on.
+    async_shared_lock lock;
+    size_t counter = 0;
+    const auto dead_executor = std::make_shared<manual_executor>();
+    const auto executor = std::make_shared<manual_executor>();
+    executor_shutdowner es(executor);
+
+    auto writer_guard = lock.lock(executor).run().get();
+
+    auto failing_writer = write_coro(lock, dead_executor, counter);
+    auto failing_reader = read_coro(lock, dead_executor, counter);
+
+    dead_executor->shutdown();
+    writer_guard.unlock();
+
+    assert_throws<errors::broken_task>([&] {
+        failing_writer.get();
+    });
+
+    assert_throws<errors::broken_task>([&] {
+        failing_reader.get();
+    });
+
+    assert_equal(counter, 0);
+    assert_true(lock.try_lock().run().get());
+    lock.unlock();
+}
+
+void concurrencpp::tests::test_async_shared_lock_mini_load_test() {
+    async_shared_lock lock;
+    size_t value = 0;
+    std::atomic_size_t inconsistencies = 0;
+
+    const size_t worker_count = concurrencpp::details::thread::hardware_concurrency();
+    constexpr size_t cycles = 20'000;
+
+    std::vector<std::shared_ptr<worker_thread_executor>> workers(worker_count);
+    for (auto& worker : workers) {
+        worker = std::make_shared<worker_thread_executor>();
+    }
+
+    auto task = [&](executor_tag, std::shared_ptr<executor> ex, size_t index) -> result<void> {
+        for (size_t i = 0; i < cycles; i++) {
+            if ((i + index) % 8 == 0) {
+                auto lk = co_await lock.lock(ex);
+                value += 2;
+                continue;
+            }
+
+            auto lk = co_await lock.lock_shared(ex);
+            if (value % 2 != 0) {
+                inconsistencies.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    std::vector<result<void>> results(worker_count);
+    for (size_t i = 0; i < worker_count; i++) {
+        results[i] = task({}, workers[i], i);
+    }
+
+    for (auto& result : results) {
+        result.get();
+    }
+
+    assert_equal(inconsistencies.load(), 0);
+
+    {
+        auto lk = lock.lock(workers[0]).run().get();
+        assert_equal(value, worker_count * (cycles / 8) * 2);
+    }
+
+    for (auto& worker : workers) {
+        worker->shutdown();
+    }
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("async_shared_lock test");
+
+    tester.add_step("lock - null resume executor", test_async_shared_lock_lock_null_resume_executor);
+    tester.add_step("lock_shared - null resume executor", test_async_shared_lock_lock_shared_null_resume_executor);
+    tester.add_step("try_lock", test_async_shared_lock_try_lock);
+    tester.add_step("try_lock_shared", test_async_shared_lock_try_lock_shared);
+    tester.add_step("unlock", test_async_shared_lock_unlock);
+    tester.add_step("readers are resumed together", test_async_shared_lock_readers_wake_together);
+    tester.add_step("writer preference", test_async_shared_lock_writer_preference);
+    tester.add_step("resumption fails", test_async_shared_lock_resumption_fails);
+    tester.add_step("lock + lock_shared", test_async_shared_lock_mini_load_test);
+
+    tester.launch_test();
+    return 0;
+}
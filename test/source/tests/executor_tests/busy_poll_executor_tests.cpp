@@ -0,0 +1,248 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/object_observer.h"
+#include "utils/executor_shutdowner.h"
+#include "utils/test_thread_callbacks.h"
+
+namespace concurrencpp::tests {
+    void test_busy_poll_executor_name();
+    void test_busy_poll_executor_max_concurrency_level();
+
+    void test_busy_poll_executor_shutdown_method_access();
+    void test_busy_poll_executor_shutdown_more_than_once();
+    void test_busy_poll_executor_shutdown();
+
+    void test_busy_poll_executor_post();
+    void test_busy_poll_executor_submit();
+    void test_busy_poll_executor_bulk_post();
+    void test_busy_poll_executor_local_enqueue();
+    void test_busy_poll_executor_low_power_spin();
+    void test_busy_poll_executor_pinning();
+    void test_busy_poll_executor_thread_callbacks();
+
+    void assert_single_busy_poll_thread(const std::unordered_map<size_t, size_t>& execution_map) {
+        assert_equal(execution_map.size(), static_cast<size_t>(1));
+        assert_not_equal(execution_map.begin()->first, concurrencpp::details::thread::get_current_virtual_id());
+    }
+}  // namespace concurrencpp::tests
+
+using concurrencpp::busy_poll_executor;
+
+void concurrencpp::tests::test_busy_poll_executor_name() {
+    auto executor = std::make_shared<busy_poll_executor>();
+    executor_shutdowner shutdown(executor);
+
+    assert_equal(executor->name, concurrencpp::details::consts::k_busy_poll_executor_name);
+}
+
+void concurrencpp::tests::test_busy_poll_executor_max_concurrency_level() {
+    auto executor = std::make_shared<busy_poll_executor>();
+    executor_shutdowner shutdown(executor);
+
+    assert_equal(executor->max_concurrency_level(), concurrencpp::details::consts::k_busy_poll_executor_max_concurrency_level);
+}
+
+void concurrencpp::tests::test_busy_poll_executor_shutdown_method_access() {
+    auto executor = std::make_shared<busy_poll_executor>();
+    assert_false(executor->shutdown_requested());
+
+    executor->shutdown();
+    assert_true(executor->shutdown_requested());
+
+    assert_throws<concurrencpp::errors::runtime_shutdown>([executor] {
+        executor->enqueue(concurrencpp::task {});
+    });
+
+    assert_throws<concurrencpp::errors::runtime_shutdown>([executor] {
+        concurrencpp::task array[4];
+        std::span<concurrencpp::task> span = array;
+        executor->enqueue(span);
+    });
+}
+
+void concurrencpp::tests::test_busy_poll_executor_shutdown_more_than_once() {
+    auto executor = std::make_shared<busy_poll_executor>();
+    for (size_t i = 0; i < 4; i++) {
+        executor->shutdown();
+    }
+}
+
+void concurrencpp::tests::test_busy_poll_executor_shutdown() {
+    test_busy_poll_executor_shutdown_method_access();
+    test_busy_poll_executor_shutdown_more_than_once();
+}
+
+void concurrencpp::tests::test_busy_poll_executor_post() {
+    object_observer observer;
+    const size_t task_count = 1'024;
+    auto executor = std::make_shared<busy_poll_executor>();
+    executor_shutdowner shutdown(executor);
+
+    // tasks are executed in order
+    size_t last_executed = 0;
+    size_t out_of_order = 0;
+
+    for (size_t i = 1; i <= task_count; i++) {
+        executor->post([i, &last_executed, &out_of_order, stub = observer.get_testing_stub()]() mutable {
+            out_of_order += (last_executed + 1 != i);
+            last_executed = i;
+            stub();
+        });
+    }
+
+    assert_true(observer.wait_execution_count(task_count, std::chrono::minutes(1)));
+    assert_true(observer.wait_destruction_count(task_count, std::chrono::minutes(1)));
+    assert_equal(out_of_order, static_cast<size_t>(0));
+    assert_single_busy_poll_thread(observer.get_execution_map());
+}
+
+void concurrencpp::tests::test_busy_poll_executor_submit() {
+    object_observer observer;
+    const size_t task_count = 1'024;
+    auto executor = std::make_shared<busy_poll_executor>();
+    executor_shutdowner shutdown(executor);
+
+    std::vector<result<size_t>> results;
+    results.resize(task_count);
+
+    for (size_t i = 0; i < task_count; i++) {
+        results[i] = executor->submit(observer.get_testing_stub(i));
+    }
+
+    for (size_t i = 0; i < task_count; i++) {
+        assert_equal(results[i].get(), i);
+    }
+
+    assert_true(observer.wait_destruction_count(task_count, std::chrono::minutes(1)));
+    assert_single_busy_poll_thread(observer.get_execution_map());
+}
+
+void concurrencpp::tests::test_busy_poll_executor_bulk_post() {
+    object_observer observer;
+    const size_t task_count = 1'024;
+    auto executor = std::make_shared<busy_poll_executor>();
+    executor_shutdowner shutdown(executor);
+
+    std::vector<testing_stub> stubs;
+    stubs.reserve(task_count);
+
+    for (size_t i = 0; i < task_count; i++) {
+        stubs.emplace_back(observer.get_testing_stub());
+    }
+
+    executor->bulk_post<testing_stub>(stubs);
+
+    assert_true(observer.wait_execution_count(task_count, std::chrono::minutes(1)));
+    assert_true(observer.wait_destruction_count(task_count, std::chrono::minutes(1)));
+    assert_single_busy_poll_thread(observer.get_execution_map());
+}
+
+void concurrencpp::tests::test_busy_poll_executor_local_enqueue() {
+    object_observer observer;
+    const size_t task_count = 1'024;
+    auto executor = std::make_shared<busy_poll_executor>();
+    executor_shutdowner shutdown(executor);
+
+    executor->post([executor, &observer] {
+        for (size_t i = 0; i < task_count; i++) {
+            executor->post(observer.get_testing_stub());
+        }
+    });
+
+    assert_true(observer.wait_execution_count(task_count, std::chrono::minutes(1)));
+    assert_true(observer.wait_destruction_count(task_count, std::chrono::minutes(1)));
+    assert_single_busy_poll_thread(observer.get_execution_map());
+}
+
+void concurrencpp::tests::test_busy_poll_executor_low_power_spin() {
+    object_observer observer;
+    const size_t task_count = 64;
+
+    // the thread drops to the low power spin right away, tasks are picked up all the same
+    auto executor = std::make_shared<busy_poll_executor>(std::nullopt, std::chrono::nanoseconds::zero());
+    executor_shutdowner shutdown(executor);
+
+    assert_equal(executor->low_power_spin_after(), std::chrono::nanoseconds::zero());
+
+    for (size_t i = 0; i < task_count; i++) {
+        executor->post(observer.get_testing_stub());
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    assert_true(observer.wait_execution_count(task_count, std::chrono::minutes(1)));
+    assert_single_busy_poll_thread(observer.get_execution_map());
+}
+
+void concurrencpp::tests::test_busy_poll_executor_pinning() {
+    {
+        auto executor = std::make_shared<busy_poll_executor>();
+        executor_shutdowner shutdown(executor);
+
+        executor->submit([] {
+        }).get();
+
+        assert_false(executor->core().has_value());
+        assert_false(executor->pinned());
+    }
+
+    {
+        auto executor = std::make_shared<busy_poll_executor>(0);
+        executor_shutdowner shutdown(executor);
+
+        executor->submit([] {
+        }).get();
+
+        assert_equal(executor->core().value(), static_cast<size_t>(0));
+
+#if defined(__linux__)
+        assert_true(executor->pinned());
+#endif
+    }
+}
+
+void concurrencpp::tests::test_busy_poll_executor_thread_callbacks() {
+    auto thread_started_callback_invoked = std::make_shared<size_t>(0);
+    auto thread_terminated_callback_invoked = std::make_shared<size_t>(0);
+
+    auto executor = std::make_shared<busy_poll_executor>(
+        std::nullopt,
+        std::chrono::nanoseconds::max(),
+        [thread_started_callback_invoked](std::string_view thread_name) {
+            ++(*thread_started_callback_invoked);
+            assert_equal(thread_name, concurrencpp::details::make_executor_worker_name(concurrencpp::details::consts::k_busy_poll_executor_name));
+        },
+        [thread_terminated_callback_invoked](std::string_view thread_name) {
+            ++(*thread_terminated_callback_invoked);
+            assert_equal(thread_name, concurrencpp::details::make_executor_worker_name(concurrencpp::details::consts::k_busy_poll_executor_name));
+        });
+
+    executor->submit([] {
+    }).get();
+
+    assert_equal(*thread_started_callback_invoked, static_cast<size_t>(1));
+
+    executor->shutdown();
+    assert_equal(*thread_terminated_callback_invoked, static_cast<size_t>(1));
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("busy_poll_executor test");
+
+    tester.add_step("name", test_busy_poll_executor_name);
+    tester.add_step("max_concurrency_level", test_busy_poll_executor_max_concurrency_level);
+    tester.add_step("shutdown", test_busy_poll_executor_shutdown);
+    tester.add_step("post", test_busy_poll_executor_post);
+    tester.add_step("submit", test_busy_poll_executor_submit);
+    tester.add_step("bulk_post", test_busy_poll_executor_bulk_post);
+    tester.add_step("local_enqueue", test_busy_poll_executor_local_enqueue);
+    tester.add_step("low_power_spin", test_busy_poll_executor_low_power_spin);
+    tester.add_step("pinning", test_busy_poll_executor_pinning);
+    tester.add_step("thread_callbacks", test_busy_poll_executor_thread_callbacks);
+
+    tester.launch_test();
+    return 0;
+}
@@ -0,0 +1,257 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/object_observer.h"
+#include "utils/executor_shutdowner.h"
+
+#include <string>
+
+namespace concurrencpp::tests {
+    void test_keyed_executor_constructor();
+    void test_keyed_executor_shutdown();
+    void test_keyed_executor_submit();
+    void test_keyed_executor_lane_depths();
+    void test_keyed_executor_rebalance();
+    void test_keyed_executor_per_key_ordering();
+}  // namespace concurrencpp::tests
+
+using concurrencpp::keyed_executor;
+using concurrencpp::manual_executor;
+
+void concurrencpp::tests::test_keyed_executor_constructor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            keyed_executor executor(nullptr);
+        },
+        concurrencpp::details::consts::k_keyed_executor_null_executor_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            keyed_executor executor(std::make_shared<inline_executor>(), 0);
+        },
+        concurrencpp::details::consts::k_keyed_executor_zero_lane_count_err_msg);
+
+    const auto underlying_executor = std::make_shared<inline_executor>();
+    keyed_executor executor(underlying_executor, 8);
+
+    assert_equal(executor.underlying_executor(), underlying_executor);
+    assert_equal(executor.lane_count(), static_cast<size_t>(8));
+    assert_equal(executor.lane_depths().size(), static_cast<size_t>(8));
+    assert_smaller(executor.lane_of(std::string("key")), static_cast<size_t>(8));
+    assert_equal(executor.lane_of(12345), executor.lane_of(12345));
+}
+
+void concurrencpp::tests::test_keyed_executor_shutdown() {
+    object_observer observer;
+    auto underlying_executor = std::make_shared<manual_executor>();
+    executor_shutdowner shutdown(underlying_executor);
+    keyed_executor executor(underlying_executor, 4);
+
+    for (size_t i = 0; i < 16; i++) {
+        executor.post(i, observer.get_testing_stub());
+    }
+
+    assert_false(executor.shutdown_requested());
+    executor.shutdown();
+    assert_true(executor.shutdown_requested());
+
+    assert_throws<concurrencpp::errors::runtime_shutdown>([&executor] {
+        executor.post(1, [] {
+        });
+    });
+
+    assert_throws<concurrencpp::errors::runtime_shutdown>([&executor] {
+        executor.submit(1, [] {
+        });
+    });
+
+    underlying_executor->loop(16);
+
+    assert_equal(observer.get_execution_count(), static_cast<size_t>(0));
+    assert_equal(observer.get_destruction_count(), static_cast<size_t>(16));
+
+    for (const auto depth : executor.lane_depths()) {
+        assert_equal(depth, static_cast<size_t>(0));
+    }
+}
+
+void concurrencpp::tests::test_keyed_executor_submit() {
+    auto underlying_executor = std::make_shared<inline_executor>();
+    keyed_executor executor(underlying_executor, 4);
+
+    auto value_result = executor.submit(std::string("key"), [](int a, int b) {
+        return a + b;
+    }, 1, 2);
+
+    assert_equal(value_result.get(), 3);
+
+    auto void_result = executor.submit(7, [] {
+    });
+
+    void_result.get();
+
+    auto exception_result = executor.submit(7, []() -> int {
+        throw std::runtime_error("error");
+    });
+
+    assert_throws<std::runtime_error>([&exception_result] {
+        exception_result.get();
+    });
+}
+
+void concurrencpp::tests::test_keyed_executor_lane_depths() {
+    auto underlying_executor = std::make_shared<manual_executor>();
+    executor_shutdowner shutdown(underlying_executor);
+    keyed_executor executor(underlying_executor, 4);
+
+    const size_t key = 42;
+    const auto lane = executor.lane_of(key);
+
+    for (size_t i = 0; i < 3; i++) {
+        executor.post(key, [] {
+        });
+    }
+
+    auto depths = executor.lane_depths();
+    for (size_t i = 0; i < depths.size(); i++) {
+        assert_equal(depths[i], (i == lane) ? static_cast<size_t>(3) : static_cast<size_t>(0));
+    }
+
+    underlying_executor->loop(16);
+
+    for (const auto depth : executor.lane_depths()) {
+        assert_equal(depth, static_cast<size_t>(0));
+    }
+}
+
+void concurrencpp::tests::test_keyed_executor_rebalance() {
+    auto underlying_executor = std::make_shared<manual_executor>();
+    executor_shutdowner shutdown(underlying_executor);
+    keyed_executor executor(underlying_executor, 2);
+
+    // a hot key and a few cold keys which share its lane
+    const size_t hot_key = 0;
+    const auto hot_lane = executor.lane_of(hot_key);
+
+    std::vector<size_t> cold_keys;
+    for (size_t key = 1; cold_keys.size() < 4; key++) {
+        if (executor.lane_of(key) == hot_lane) {
+            cold_keys.emplace_back(key);
+        }
+    }
+
+    const auto post_tasks = [&] {
+        for (size_t i = 0; i < 100; i++) {
+            executor.post(hot_key, [] {
+            });
+        }
+
+        for (const auto key : cold_keys) {
+            executor.post(key, [] {
+            });
+        }
+    };
+
+    // buckets with tasks in flight are never moved
+    post_tasks();
+    assert_equal(executor.rebalance(), static_cast<size_t>(0));
+    assert_equal(executor.lane_of(hot_key), hot_lane);
+    underlying_executor->loop(1'024);
+
+    post_tasks();
+    underlying_executor->loop(1'024);
+
+    // once idle, the busy lane is split up
+    assert_equal(executor.rebalance(), static_cast<size_t>(1));
+
+    size_t separated = 0;
+    for (const auto key : cold_keys) {
+        separated += (executor.lane_of(key) != executor.lane_of(hot_key));
+    }
+
+    assert_not_equal(separated, static_cast<size_t>(0));
+
+    // nothing was posted since the last call, so there's nothing to rebalance
+    assert_equal(executor.rebalance(), static_cast<size_t>(0));
+}
+
+void concurrencpp::tests::test_keyed_executor_per_key_ordering() {
+    constexpr size_t key_count = 64;
+    constexpr size_t producer_count = 4;
+    constexpr size_t tasks_per_producer = 4'096;
+
+    auto thread_pool = std::make_shared<thread_pool_executor>("keyed_executor test pool", 8, std::chrono::seconds(10));
+    executor_shutdowner shutdown(thread_pool);
+    keyed_executor executor(thread_pool, 8);
+
+    struct key_state {
+        std::atomic_size_t running = 0;
+        std::atomic_size_t overlaps = 0;
+        std::atomic_size_t out_of_order = 0;
+        std::vector<size_t> last_executed = std::vector<size_t>(producer_count, 0);
+    };
+
+    std::vector<key_state> keys(key_count);
+    object_observer observer;
+    std::atomic_bool done = false;
+
+    // buckets are re-routed all along, the order of every key must hold anyway
+    std::thread rebalancer([&] {
+        while (!done.load()) {
+            executor.rebalance();
+            std::this_thread::yield();
+        }
+    });
+
+    std::vector<std::thread> producers;
+    for (size_t i = 0; i < producer_count; i++) {
+        producers.emplace_back([&, i] {
+            for (size_t j = 1; j <= tasks_per_producer; j++) {
+                // a few hot keys get most of the tasks
+                const auto key = (j % 4 == 0) ? (j % key_count) : (j % 3);
+                auto& state = keys[key];
+
+                executor.post(key, [&state, i, j, stub = observer.get_testing_stub()]() mutable {
+                    state.overlaps += (state.running.fetch_add(1) != 0);
+                    state.out_of_order += (state.last_executed[i] >= j);
+                    state.last_executed[i] = j;
+                    stub();
+                    state.running.fetch_sub(1);
+                });
+            }
+        });
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    assert_true(observer.wait_execution_count(producer_count * tasks_per_producer, std::chrono::minutes(1)));
+
+    done = true;
+    rebalancer.join();
+
+    for (auto& state : keys) {
+        assert_equal(state.overlaps.load(), static_cast<size_t>(0));
+        assert_equal(state.out_of_order.load(), static_cast<size_t>(0));
+    }
+
+    executor.shutdown();
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("keyed_executor test");
+
+    tester.add_step("constructor", test_keyed_executor_constructor);
+    tester.add_step("shutdown", test_keyed_executor_shutdown);
+    tester.add_step("submit", test_keyed_executor_submit);
+    tester.add_step("lane_depths", test_keyed_executor_lane_depths);
+    tester.add_step("rebalance", test_keyed_executor_rebalance);
+    tester.add_step("per_key_ordering", test_keyed_executor_per_key_ordering);
+
+    tester.launch_test();
+    return 0;
+}
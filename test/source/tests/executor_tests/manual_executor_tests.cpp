@@ -12,6 +12,7 @@ namespace concurrencpp::tests {
 
     void test_manual_executor_shutdown_method_access();
     void test_manual_executor_shutdown_more_than_once();
+    void test_manual_executor_shutdown_race();
     void test_manual_executor_shutdown();
 
     void test_manual_executor_max_concurrency_level();
@@ -43,6 +44,7 @@ namespace concurrencpp::tests {
     void test_manual_executor_loop();
     void test_manual_executor_loop_for();
     void test_manual_executor_loop_until();
+    void test_manual_executor_loop_batches();
 
     void test_manual_executor_clear();
 
@@ -144,9 +146,45 @@ void concurrencpp::tests::test_manual_executor_shutdown_more_than_once() {
     }
 }
 
+void concurrencpp::tests::test_manual_executor_shutdown_race() {
+    constexpr size_t producer_count = 4;
+
+    // a task enqueued while the executor shuts down is either destroyed by shutdown or isn't accepted
+    for (size_t i = 0; i < 64; i++) {
+        object_observer observer;
+        auto executor = std::make_shared<manual_executor>();
+        std::atomic_size_t accepted = 0;
+        std::vector<std::thread> producers;
+
+        for (size_t j = 0; j < producer_count; j++) {
+            producers.emplace_back([&] {
+                try {
+                    while (true) {
+                        executor->post(observer.get_testing_stub());
+                        ++accepted;
+                    }
+                } catch (const concurrencpp::errors::runtime_shutdown&) {
+                }
+            });
+        }
+
+        std::this_thread::sleep_for(std::chrono::microseconds(500));
+        executor->shutdown();
+
+        for (auto& producer : producers) {
+            producer.join();
+        }
+
+        // the stub of the post that threw is destroyed as well. nothing is left in the queue until the executor dies.
+        assert_equal(observer.get_execution_count(), static_cast<size_t>(0));
+        assert_equal(observer.get_destruction_count(), accepted.load() + producer_count);
+    }
+}
+
 void concurrencpp::tests::test_manual_executor_shutdown() {
     test_manual_executor_shutdown_method_access();
     test_manual_executor_shutdown_more_than_once();
+    test_manual_executor_shutdown_race();
 }
 
 void concurrencpp::tests::test_manual_executor_max_concurrency_level() {
@@ -999,6 +1037,89 @@ void concurrencpp::tests::test_manual_executor_loop_until() {
     }
 }
 
+void concurrencpp::tests::test_manual_executor_loop_batches() {
+    // tasks enqueued while a batch is executed are executed by the same call
+    {
+        auto executor = std::make_shared<concurrencpp::manual_executor>();
+        executor_shutdowner shutdown(executor);
+        size_t counter = 0;
+
+        executor->post([executor, &counter] {
+            ++counter;
+            executor->post([&counter] {
+                ++counter;
+            });
+        });
+
+        assert_equal(executor->loop(10), static_cast<size_t>(2));
+        assert_equal(counter, static_cast<size_t>(2));
+        assert_true(executor->empty());
+    }
+
+    // a task that throws leaves the rest of its batch in the executor
+    {
+        object_observer observer;
+        auto executor = std::make_shared<concurrencpp::manual_executor>();
+        executor_shutdowner shutdown(executor);
+        const size_t task_count = 4;
+
+        executor->enqueue(concurrencpp::task([] {
+            throw std::runtime_error("error");
+        }));
+
+        for (size_t i = 0; i < task_count; i++) {
+            executor->post(observer.get_testing_stub());
+        }
+
+        assert_throws<std::runtime_error>([executor] {
+            executor->loop(10);
+        });
+
+        assert_equal(executor->size(), task_count);
+        assert_equal(observer.get_execution_count(), static_cast<size_t>(0));
+
+        assert_equal(executor->loop(10), task_count);
+        assert_equal(observer.get_execution_count(), task_count);
+    }
+
+    // the deadline is checked before every task of a batch, not only before taking it
+    {
+        auto executor = std::make_shared<concurrencpp::manual_executor>();
+        executor_shutdowner shutdown(executor);
+        const size_t task_count = 8;
+        std::vector<size_t> executed_tasks;
+
+        for (size_t i = 0; i < task_count; i++) {
+            executor->post([i, &executed_tasks] {
+                std::this_thread::sleep_for(milliseconds(50));
+                executed_tasks.emplace_back(i);
+            });
+        }
+
+        assert_equal(executor->loop_for(task_count, milliseconds(20)), static_cast<size_t>(1));
+        assert_equal(executor->size(), task_count - 1);
+
+        assert_equal(executor->loop_until(task_count, steady_clock::now() + milliseconds(20)), static_cast<size_t>(1));
+        assert_equal(executor->size(), task_count - 2);
+
+        // the tasks that weren't executed kept their order
+        assert_equal(executor->loop(task_count), task_count - 2);
+        for (size_t i = 0; i < task_count; i++) {
+            assert_equal(executed_tasks[i], i);
+        }
+    }
+
+    // steady_clock deadlines are used as is
+    {
+        auto executor = std::make_shared<concurrencpp::manual_executor>();
+        executor_shutdowner shutdown(executor);
+
+        const auto deadline = steady_clock::now() + milliseconds(50);
+        assert_false(executor->loop_once_until(deadline));
+        assert_bigger_equal(steady_clock::now(), deadline);
+    }
+}
+
 void concurrencpp::tests::test_manual_executor_clear() {
     object_observer observer;
     const size_t task_count = 100;
@@ -1543,6 +1664,7 @@ int main() {
     tester.add_step("loop", test_manual_executor_loop);
     tester.add_step("loop_for", test_manual_executor_loop_for);
     tester.add_step("loop_until", test_manual_executor_loop_until);
+    tester.add_step("loop_batches", test_manual_executor_loop_batches);
     tester.add_step("wait_for_task", test_manual_executor_wait_for_task);
     tester.add_step("wait_for_task_for", test_manual_executor_wait_for_task_for);
     tester.add_step("wait_for_task_until", test_manual_executor_wait_for_task_until);
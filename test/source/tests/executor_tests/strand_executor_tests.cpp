@@ -0,0 +1,281 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/object_observer.h"
+#include "utils/executor_shutdowner.h"
+
+namespace concurrencpp::tests {
+    void test_strand_executor_name();
+    void test_strand_executor_constructor();
+
+    void test_strand_executor_shutdown_method_access();
+    void test_strand_executor_shutdown_discards_tasks();
+    void test_strand_executor_underlying_shutdown();
+    void test_strand_executor_shutdown();
+
+    void test_strand_executor_max_concurrency_level();
+
+    void test_strand_executor_scheduling();
+    void test_strand_executor_task_exception();
+    void test_strand_executor_serialization();
+}  // namespace concurrencpp::tests
+
+using concurrencpp::strand_executor;
+using concurrencpp::manual_executor;
+
+void concurrencpp::tests::test_strand_executor_name() {
+    auto executor = std::make_shared<strand_executor>(std::make_shared<inline_executor>());
+    assert_equal(executor->name, concurrencpp::details::consts::k_strand_executor_name);
+}
+
+void concurrencpp::tests::test_strand_executor_constructor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            strand_executor executor(nullptr);
+        },
+        concurrencpp::details::consts::k_strand_executor_null_executor_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            strand_executor executor(std::make_shared<inline_executor>(), 0);
+        },
+        concurrencpp::details::consts::k_strand_executor_zero_batch_size_err_msg);
+
+    const auto underlying_executor = std::make_shared<inline_executor>();
+    auto executor = std::make_shared<strand_executor>(underlying_executor, 8);
+    assert_equal(executor->underlying_executor(), underlying_executor);
+    assert_equal(executor->max_batch_size(), static_cast<size_t>(8));
+}
+
+void concurrencpp::tests::test_strand_executor_shutdown_method_access() {
+    auto executor = std::make_shared<strand_executor>(std::make_shared<inline_executor>());
+    assert_false(executor->shutdown_requested());
+
+    executor->shutdown();
+    assert_true(executor->shutdown_requested());
+
+    assert_throws<concurrencpp::errors::runtime_shutdown>([executor] {
+        executor->enqueue(concurrencpp::task {});
+    });
+
+    assert_throws<concurrencpp::errors::runtime_shutdown>([executor] {
+        concurrencpp::task array[4];
+        std::span<concurrencpp::task> span = array;
+        executor->enqueue(span);
+    });
+}
+
+void concurrencpp::tests::test_strand_executor_shutdown_discards_tasks() {
+    object_observer observer;
+    const size_t task_count = 16;
+    auto underlying_executor = std::make_shared<manual_executor>();
+    executor_shutdowner shutdown(underlying_executor);
+    auto executor = std::make_shared<strand_executor>(underlying_executor);
+
+    for (size_t i = 0; i < task_count; i++) {
+        executor->post(observer.get_testing_stub());
+    }
+
+    executor->shutdown();
+    assert_equal(underlying_executor->loop(16), static_cast<size_t>(1));
+
+    assert_equal(observer.get_execution_count(), static_cast<size_t>(0));
+    assert_equal(observer.get_destruction_count(), task_count);
+    assert_true(underlying_executor->empty());
+}
+
+void concurrencpp::tests::test_strand_executor_underlying_shutdown() {
+    // the drain can't be scheduled: the strand shuts down instead of accepting tasks nothing would execute
+    {
+        auto underlying_executor = std::make_shared<manual_executor>();
+        auto executor = std::make_shared<strand_executor>(underlying_executor);
+        underlying_executor->shutdown();
+
+        assert_throws<concurrencpp::errors::runtime_shutdown>([executor] {
+            executor->post([] {
+            });
+        });
+
+        assert_true(executor->shutdown_requested());
+
+        assert_throws_with_error_message<concurrencpp::errors::runtime_shutdown>(
+            [executor] {
+                executor->post([] {
+                });
+            },
+            std::string(concurrencpp::details::consts::k_strand_executor_name) +
+                concurrencpp::details::consts::k_executor_shutdown_err_msg);
+    }
+
+    // the drain was scheduled, but the underlying executor is shut down before running it
+    {
+        object_observer observer;
+        auto underlying_executor = std::make_shared<manual_executor>();
+        auto executor = std::make_shared<strand_executor>(underlying_executor);
+
+        auto result = executor->submit([] {
+        });
+
+        executor->post(observer.get_testing_stub());
+        assert_equal(underlying_executor->size(), static_cast<size_t>(1));
+
+        underlying_executor->shutdown();
+
+        assert_true(executor->shutdown_requested());
+        assert_equal(observer.get_execution_count(), static_cast<size_t>(0));
+        assert_equal(observer.get_destruction_count(), static_cast<size_t>(1));
+        assert_throws<concurrencpp::errors::broken_task>([&result] {
+            result.get();
+        });
+
+        assert_throws<concurrencpp::errors::runtime_shutdown>([executor] {
+            executor->post([] {
+            });
+        });
+    }
+}
+
+void concurrencpp::tests::test_strand_executor_shutdown() {
+    test_strand_executor_shutdown_method_access();
+    test_strand_executor_shutdown_discards_tasks();
+    test_strand_executor_underlying_shutdown();
+}
+
+void concurrencpp::tests::test_strand_executor_max_concurrency_level() {
+    auto executor = std::make_shared<strand_executor>(std::make_shared<inline_executor>());
+    assert_equal(executor->max_concurrency_level(), concurrencpp::details::consts::k_strand_executor_max_concurrency_level);
+}
+
+void concurrencpp::tests::test_strand_executor_scheduling() {
+    object_observer observer;
+    const size_t max_batch_size = 4;
+    auto underlying_executor = std::make_shared<manual_executor>();
+    executor_shutdowner shutdown(underlying_executor);
+    auto executor = std::make_shared<strand_executor>(underlying_executor, max_batch_size);
+
+    // an idle strand schedules nothing
+    assert_true(underlying_executor->empty());
+
+    // a non empty strand is scheduled once, no matter how many tasks it has
+    for (size_t i = 0; i < max_batch_size + 2; i++) {
+        executor->post(observer.get_testing_stub());
+    }
+
+    concurrencpp::task tasks[2] = {concurrencpp::task(observer.get_testing_stub()), concurrencpp::task(observer.get_testing_stub())};
+    executor->enqueue(std::span<concurrencpp::task>(tasks));
+
+    assert_equal(underlying_executor->size(), static_cast<size_t>(1));
+
+    // every scheduling executes one batch, and reschedules the strand only while it isn't empty
+    assert_equal(underlying_executor->loop_once(), true);
+    assert_equal(observer.get_execution_count(), max_batch_size);
+    assert_equal(underlying_executor->size(), static_cast<size_t>(1));
+
+    assert_equal(underlying_executor->loop_once(), true);
+    assert_equal(observer.get_execution_count(), max_batch_size * 2);
+    assert_true(underlying_executor->empty());
+
+    // tasks enqueued by the strand itself are executed by a following scheduling
+    executor->post([executor, stub = observer.get_testing_stub()]() mutable {
+        executor->post(std::move(stub));
+    });
+
+    assert_equal(underlying_executor->loop(16), static_cast<size_t>(2));
+    assert_equal(observer.get_execution_count(), max_batch_size * 2 + 1);
+    assert_true(underlying_executor->empty());
+}
+
+void concurrencpp::tests::test_strand_executor_task_exception() {
+    object_observer observer;
+    auto underlying_executor = std::make_shared<manual_executor>();
+    executor_shutdowner shutdown(underlying_executor);
+    auto executor = std::make_shared<strand_executor>(underlying_executor);
+
+    executor->enqueue(concurrencpp::task([] {
+        throw std::runtime_error("error");
+    }));
+
+    executor->post(observer.get_testing_stub());
+
+    // the exception propagates to the underlying executor, the rest of the tasks are still executed
+    assert_throws<std::runtime_error>([underlying_executor] {
+        underlying_executor->loop_once();
+    });
+
+    assert_equal(observer.get_execution_count(), static_cast<size_t>(0));
+    assert_equal(underlying_executor->loop(16), static_cast<size_t>(1));
+    assert_equal(observer.get_execution_count(), static_cast<size_t>(1));
+}
+
+void concurrencpp::tests::test_strand_executor_serialization() {
+    constexpr size_t strand_count = 4;
+    constexpr size_t producer_count = 8;
+    constexpr size_t tasks_per_producer = 2'048;
+
+    auto thread_pool = std::make_shared<thread_pool_executor>("strand_executor test pool", 8, std::chrono::seconds(10));
+    executor_shutdowner shutdown(thread_pool);
+
+    struct strand_state {
+        std::shared_ptr<strand_executor> executor;
+        std::atomic_size_t running = 0;
+        std::atomic_size_t overlaps = 0;
+        std::atomic_size_t out_of_order = 0;
+        std::vector<size_t> last_executed = std::vector<size_t>(producer_count, 0);
+    };
+
+    std::vector<strand_state> strands(strand_count);
+    for (auto& strand : strands) {
+        strand.executor = std::make_shared<strand_executor>(thread_pool);
+    }
+
+    object_observer observer;
+    std::vector<std::thread> producers;
+
+    // every producer checks that its tasks run in order, and no two tasks of the same strand run at the same time
+    for (size_t i = 0; i < producer_count; i++) {
+        producers.emplace_back([&, i] {
+            for (size_t j = 1; j <= tasks_per_producer; j++) {
+                auto& strand = strands[j % strand_count];
+                strand.executor->post([&strand, i, j, stub = observer.get_testing_stub()]() mutable {
+                    strand.overlaps += (strand.running.fetch_add(1) != 0);
+
+                    strand.out_of_order += (strand.last_executed[i] >= j);
+                    strand.last_executed[i] = j;
+                    stub();
+
+                    strand.running.fetch_sub(1);
+                });
+            }
+        });
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    assert_true(observer.wait_execution_count(producer_count * tasks_per_producer, std::chrono::minutes(1)));
+
+    for (auto& strand : strands) {
+        assert_equal(strand.overlaps.load(), static_cast<size_t>(0));
+        assert_equal(strand.out_of_order.load(), static_cast<size_t>(0));
+        strand.executor->shutdown();
+    }
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("strand_executor test");
+
+    tester.add_step("name", test_strand_executor_name);
+    tester.add_step("constructor", test_strand_executor_constructor);
+    tester.add_step("shutdown", test_strand_executor_shutdown);
+    tester.add_step("max_concurrency_level", test_strand_executor_max_concurrency_level);
+    tester.add_step("scheduling", test_strand_executor_scheduling);
+    tester.add_step("task_exception", test_strand_executor_task_exception);
+    tester.add_step("serialization", test_strand_executor_serialization);
+
+    tester.launch_test();
+    return 0;
+}
@@ -40,6 +40,21 @@ namespace concurrencpp::tests {
 
     void test_thread_executor_thread_callbacks();
 
+    void test_thread_executor_thread_caching();
+
+    // cached threads run many tasks one after the other, so threads are unique only per concurrently running task.
+    void assert_execution_threads(const std::unordered_map<size_t, size_t>& execution_map, const size_t expected_task_count) {
+        assert_bigger_equal(expected_task_count, execution_map.size());
+
+        size_t task_count = 0;
+        for (const auto& [thread_id, invocation_count] : execution_map) {
+            assert_not_equal(thread_id, static_cast<size_t>(0));
+            task_count += invocation_count;
+        }
+
+        assert_equal(task_count, expected_task_count);
+    }
+
     void assert_unique_execution_threads(const std::unordered_map<size_t, size_t>& execution_map, const size_t expected_thread_count) {
         assert_equal(execution_map.size(), expected_thread_count);
 
@@ -137,7 +152,7 @@ void concurrencpp::tests::test_thread_executor_post_foreign() {
     assert_true(observer.wait_execution_count(task_count, std::chrono::minutes(1)));
     assert_true(observer.wait_destruction_count(task_count, std::chrono::minutes(1)));
 
-    assert_unique_execution_threads(observer.get_execution_map(), task_count);
+    assert_execution_threads(observer.get_execution_map(), task_count);
 }
 
 void concurrencpp::tests::test_thread_executor_post_inline() {
@@ -155,7 +170,7 @@ void concurrencpp::tests::test_thread_executor_post_inline() {
     assert_true(observer.wait_execution_count(task_count, std::chrono::minutes(1)));
     assert_true(observer.wait_destruction_count(task_count, std::chrono::minutes(1)));
 
-    assert_unique_execution_threads(observer.get_execution_map(), task_count);
+    assert_execution_threads(observer.get_execution_map(), task_count);
 }
 
 void concurrencpp::tests::test_thread_executor_post() {
@@ -197,7 +212,7 @@ void concurrencpp::tests::test_thread_executor_submit_foreign() {
     assert_true(observer.wait_execution_count(task_count, std::chrono::minutes(1)));
     assert_true(observer.wait_destruction_count(task_count, std::chrono::minutes(1)));
 
-    assert_unique_execution_threads(observer.get_execution_map(), task_count);
+    assert_execution_threads(observer.get_execution_map(), task_count);
 }
 
 void concurrencpp::tests::test_thread_executor_submit_inline() {
@@ -224,7 +239,7 @@ void concurrencpp::tests::test_thread_executor_submit_inline() {
     assert_true(observer.wait_execution_count(task_count, std::chrono::minutes(1)));
     assert_true(observer.wait_destruction_count(task_count, std::chrono::minutes(1)));
 
-    assert_unique_execution_threads(observer.get_execution_map(), task_count);
+    assert_execution_threads(observer.get_execution_map(), task_count);
 }
 
 void concurrencpp::tests::test_thread_executor_submit() {
@@ -265,7 +280,7 @@ void concurrencpp::tests::test_thread_executor_bulk_post_foreign() {
     assert_true(observer.wait_execution_count(task_count, std::chrono::minutes(1)));
     assert_true(observer.wait_destruction_count(task_count, std::chrono::minutes(1)));
 
-    assert_unique_execution_threads(observer.get_execution_map(), task_count);
+    assert_execution_threads(observer.get_execution_map(), task_count);
 }
 
 void concurrencpp::tests::test_thread_executor_bulk_post_inline() {
@@ -288,7 +303,7 @@ void concurrencpp::tests::test_thread_executor_bulk_post_inline() {
     assert_true(observer.wait_execution_count(task_count, std::chrono::minutes(1)));
     assert_true(observer.wait_destruction_count(task_count, std::chrono::minutes(1)));
 
-    assert_unique_execution_threads(observer.get_execution_map(), task_count);
+    assert_execution_threads(observer.get_execution_map(), task_count);
 }
 
 void concurrencpp::tests::test_thread_executor_bulk_post() {
@@ -339,7 +354,7 @@ void concurrencpp::tests::test_thread_executor_bulk_submit_foreign() {
     assert_true(observer.wait_execution_count(task_count, std::chrono::minutes(1)));
     assert_true(observer.wait_destruction_count(task_count, std::chrono::minutes(1)));
 
-    assert_unique_execution_threads(observer.get_execution_map(), task_count);
+    assert_execution_threads(observer.get_execution_map(), task_count);
 }
 
 void concurrencpp::tests::test_thread_executor_bulk_submit_inline() {
@@ -367,7 +382,7 @@ void concurrencpp::tests::test_thread_executor_bulk_submit_inline() {
     assert_true(observer.wait_execution_count(task_count, std::chrono::minutes(1)));
     assert_true(observer.wait_destruction_count(task_count, std::chrono::minutes(1)));
 
-    assert_unique_execution_threads(observer.get_execution_map(), task_count);
+    assert_execution_threads(observer.get_execution_map(), task_count);
 }
 
 void concurrencpp::tests::test_thread_executor_bulk_submit() {
@@ -384,6 +399,101 @@ void concurrencpp::tests::test_thread_executor_thread_callbacks() {
         concurrencpp::details::make_executor_worker_name(concurrencpp::details::consts::k_thread_executor_name));
 }
 
+void concurrencpp::tests::test_thread_executor_thread_caching() {
+    // without caching, every task gets a brand new thread
+    {
+        object_observer observer;
+        constexpr size_t task_count = 16;
+        auto executor = std::make_shared<thread_executor>(nullptr, nullptr, 0, std::chrono::seconds(10));
+        executor_shutdowner shutdown(executor);
+
+        assert_equal(executor->max_cached_threads(), static_cast<size_t>(0));
+        assert_equal(executor->max_worker_idle_time(), std::chrono::milliseconds(std::chrono::seconds(10)));
+
+        for (size_t i = 0; i < task_count; i++) {
+            executor->submit(observer.get_testing_stub()).get();
+        }
+
+        assert_unique_execution_threads(observer.get_execution_map(), task_count);
+    }
+
+    // tasks that run one after the other reuse the same parked thread
+    {
+        object_observer observer;
+        constexpr size_t task_count = 16;
+        std::atomic_size_t threads_started = 0;
+
+        auto executor = std::make_shared<thread_executor>(
+            [&threads_started](std::string_view) {
+                ++threads_started;
+            },
+            nullptr,
+            4,
+            std::chrono::seconds(10));
+        executor_shutdowner shutdown(executor);
+
+        for (size_t i = 0; i < task_count; i++) {
+            executor->submit(observer.get_testing_stub()).get();
+
+            // the result is set before the thread parks, give it a chance to do so
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+
+        assert_equal(observer.get_execution_map().size(), threads_started.load());
+        assert_smaller(threads_started, task_count / 2);
+    }
+
+    // concurrently running tasks still get a thread each, at most max_cached_threads of them are kept when done
+    {
+        constexpr size_t task_count = 8;
+        constexpr size_t max_cached_threads = 3;
+        std::atomic_size_t threads_started = 0, threads_terminated = 0;
+
+        auto executor = std::make_shared<thread_executor>(
+            [&threads_started](std::string_view) {
+                ++threads_started;
+            },
+            [&threads_terminated](std::string_view) {
+                ++threads_terminated;
+            },
+            max_cached_threads,
+            std::chrono::milliseconds(200));
+        executor_shutdowner shutdown(executor);
+
+        std::atomic_size_t running = 0;
+        std::vector<result<void>> results;
+
+        for (size_t i = 0; i < task_count; i++) {
+            results.emplace_back(executor->submit([&running] {
+                ++running;
+                while (running != task_count) {
+                    std::this_thread::yield();
+                }
+            }));
+        }
+
+        for (auto& result : results) {
+            result.get();
+        }
+
+        assert_equal(threads_started, task_count);
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (threads_terminated != task_count - max_cached_threads && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        assert_equal(threads_terminated, task_count - max_cached_threads);
+
+        // parked threads expire after max_worker_idle_time
+        while (threads_terminated != task_count && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        assert_equal(threads_terminated, task_count);
+    }
+}
+
 using namespace concurrencpp::tests;
 
 int main() {
@@ -397,6 +507,7 @@ int main() {
     tester.add_step("bulk_post", test_thread_executor_bulk_post);
     tester.add_step("bulk_submit", test_thread_executor_bulk_submit);
     tester.add_step("thread_callbacks", test_thread_executor_thread_callbacks);
+    tester.add_step("thread_caching", test_thread_executor_thread_caching);
 
     tester.launch_test();
     return 0;
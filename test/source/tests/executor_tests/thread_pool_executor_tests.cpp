@@ -38,6 +38,7 @@ namespace concurrencpp::tests {
 
     void test_thread_pool_executor_enqueue_algorithm();
     void test_thread_pool_executor_dynamic_resizing();
+    void test_thread_pool_executor_work_helping_wait();
 
     void test_thread_pool_executor_thread_callbacks();
 }  // namespace concurrencpp::tests
@@ -563,6 +564,61 @@ void concurrencpp::tests::test_thread_pool_executor_thread_callbacks() {
         concurrencpp::details::make_executor_worker_name(thread_pool_name));
 }
 
+void concurrencpp::tests::test_thread_pool_executor_work_helping_wait() {
+    // case 1 : a single worker waiting for a task it submitted runs that task itself instead of deadlocking
+    {
+        auto executor = std::make_shared<thread_pool_executor>("threadpool", 1, std::chrono::seconds(10));
+        executor_shutdowner shutdown(executor);
+
+        auto result = executor->submit([executor] {
+            auto inner_result = executor->submit([] {
+                return thread::get_current_virtual_id();
+            });
+
+            return inner_result.get() == thread::get_current_virtual_id();
+        });
+
+        assert_true(result.get());
+    }
+
+    // case 2 : nested waits, every level waits for tasks queued behind it
+    {
+        struct fibonacci {
+            static size_t run(std::shared_ptr<thread_pool_executor> executor, size_t n) {
+                if (n < 2) {
+                    return n;
+                }
+
+                auto lhs = executor->submit(run, executor, n - 1);
+                auto rhs = executor->submit(run, executor, n - 2);
+                return lhs.get() + rhs.get();
+            }
+        };
+
+        auto executor = std::make_shared<thread_pool_executor>("threadpool", 2, std::chrono::seconds(10));
+        executor_shutdowner shutdown(executor);
+
+        assert_equal(executor->submit(fibonacci::run, executor, 16).get(), static_cast<size_t>(987));
+    }
+
+    // case 3 : shared_result waits help as well
+    {
+        auto executor = std::make_shared<thread_pool_executor>("threadpool", 1, std::chrono::seconds(10));
+        executor_shutdowner shutdown(executor);
+
+        auto result = executor->submit([executor] {
+            shared_result<int> inner_result = executor->submit([] {
+                return 123;
+            });
+
+            inner_result.wait();
+            return inner_result.get();
+        });
+
+        assert_equal(result.get(), 123);
+    }
+}
+
 using namespace concurrencpp::tests;
 
 int main() {
@@ -576,6 +632,7 @@ int main() {
     tester.add_step("bulk_submit", test_thread_pool_executor_bulk_submit);
     tester.add_step("enqueuing algorithm", test_thread_pool_executor_enqueue_algorithm);
     tester.add_step("dynamic resizing", test_thread_pool_executor_dynamic_resizing);
+    tester.add_step("work helping wait", test_thread_pool_executor_work_helping_wait);
     tester.add_step("thread_callbacks", test_thread_pool_executor_thread_callbacks);
 
     tester.launch_test();
@@ -40,6 +40,10 @@ namespace concurrencpp::tests {
 
     void test_worker_thread_executor_thread_callbacks();
 
+    void test_worker_thread_executor_many_producers();
+    void test_worker_thread_executor_first_enqueue_race();
+    void test_worker_thread_executor_shutdown_race();
+
     void assert_unique_execution_thread(const std::unordered_map<size_t, size_t>& execution_map) {
         assert_equal(execution_map.size(), 1);
         assert_not_equal(execution_map.begin()->first, concurrencpp::details::thread::get_current_virtual_id());
@@ -374,6 +378,119 @@ void concurrencpp::tests::test_worker_thread_executor_thread_callbacks() {
         concurrencpp::details::make_executor_worker_name(concurrencpp::details::consts::k_worker_thread_executor_name));
 }
 
+void concurrencpp::tests::test_worker_thread_executor_many_producers() {
+    constexpr size_t producer_count = 8;
+    constexpr size_t tasks_per_producer = 4'096;
+
+    object_observer observer;
+    auto executor = std::make_shared<worker_thread_executor>();
+    executor_shutdowner shutdown(executor);
+
+    // every producer checks that its own tasks run in the order they were enqueued, single and bulk alike
+    std::vector<size_t> last_executed(producer_count, 0);
+    std::atomic_size_t out_of_order = 0;
+    std::vector<std::thread> producers;
+
+    for (size_t i = 0; i < producer_count; i++) {
+        producers.emplace_back([&, i] {
+            for (size_t j = 1; j <= tasks_per_producer; j += 2) {
+                executor->post([&, i, j, stub = observer.get_testing_stub()]() mutable {
+                    out_of_order += (last_executed[i] + 1 != j);
+                    last_executed[i] = j;
+                    stub();
+                });
+
+                concurrencpp::task bulk[1] = {concurrencpp::task([&, i, j, stub = observer.get_testing_stub()]() mutable {
+                    out_of_order += (last_executed[i] + 1 != j + 1);
+                    last_executed[i] = j + 1;
+                    stub();
+                })};
+
+                executor->enqueue(std::span<concurrencpp::task>(bulk));
+
+                // let the worker run dry and wait every now and then
+                if (j % 512 == 1) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(200));
+                }
+            }
+        });
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    assert_true(observer.wait_execution_count(producer_count * tasks_per_producer, std::chrono::minutes(1)));
+    assert_true(observer.wait_destruction_count(producer_count * tasks_per_producer, std::chrono::minutes(1)));
+    assert_equal(out_of_order, 0);
+    assert_unique_execution_thread(observer.get_execution_map());
+}
+
+void concurrencpp::tests::test_worker_thread_executor_first_enqueue_race() {
+    constexpr size_t producer_count = 8;
+
+    // every producer enqueues one task to a fresh executor at once: none of them may be left waiting for a wake-up
+    for (size_t i = 0; i < 256; i++) {
+        object_observer observer;
+        auto executor = std::make_shared<worker_thread_executor>();
+        executor_shutdowner shutdown(executor);
+
+        std::atomic_bool go = false;
+        std::vector<std::thread> producers;
+
+        for (size_t j = 0; j < producer_count; j++) {
+            producers.emplace_back([&] {
+                go.wait(false);
+                executor->post(observer.get_testing_stub());
+            });
+        }
+
+        go = true;
+        go.notify_all();
+
+        for (auto& producer : producers) {
+            producer.join();
+        }
+
+        assert_true(observer.wait_execution_count(producer_count, std::chrono::seconds(30)));
+    }
+}
+
+void concurrencpp::tests::test_worker_thread_executor_shutdown_race() {
+    constexpr size_t producer_count = 4;
+
+    // a task enqueued while the executor shuts down either runs, or is destroyed by shutdown, or isn't accepted
+    for (size_t i = 0; i < 64; i++) {
+        object_observer observer;
+        auto executor = std::make_shared<worker_thread_executor>();
+        std::atomic_size_t accepted = 0;
+        std::vector<std::thread> producers;
+
+        for (size_t j = 0; j < producer_count; j++) {
+            producers.emplace_back([&] {
+                try {
+                    while (true) {
+                        executor->post(observer.get_testing_stub());
+                        ++accepted;
+                    }
+                } catch (const concurrencpp::errors::runtime_shutdown&) {
+                }
+            });
+        }
+
+        std::this_thread::sleep_for(std::chrono::microseconds(500));
+        executor->shutdown();
+
+        for (auto& producer : producers) {
+            producer.join();
+        }
+
+        // the stub of the post that threw is destroyed as well. nothing is left in the queue until the executor dies.
+        assert_smaller_equal(observer.get_execution_count(), accepted.load());
+        assert_equal(observer.get_destruction_count(), accepted.load() + producer_count);
+    }
+}
+
 using namespace concurrencpp::tests;
 
 int main() {
@@ -387,6 +504,9 @@ int main() {
     tester.add_step("bulk_post", test_worker_thread_executor_bulk_post);
     tester.add_step("bulk_submit", test_worker_thread_executor_bulk_submit);
     tester.add_step("thread_callbacks", test_worker_thread_executor_thread_callbacks);
+    tester.add_step("many_producers", test_worker_thread_executor_many_producers);
+    tester.add_step("first enqueue race", test_worker_thread_executor_first_enqueue_race);
+    tester.add_step("shutdown race", test_worker_thread_executor_shutdown_race);
 
     tester.launch_test();
     return 0;
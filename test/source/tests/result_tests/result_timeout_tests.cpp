@@ -0,0 +1,292 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/executor_shutdowner.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono;
+using namespace std::chrono_literals;
+
+namespace concurrencpp::tests {
+    void test_result_with_timeout_validation();
+    void test_result_with_timeout_ready_result();
+    void test_result_with_timeout_result_first();
+    void test_result_with_timeout_exception();
+    void test_result_with_timeout_timeout_first();
+    void test_result_with_timeout_shutdown_timer_queue();
+    void test_result_with_timeout_race();
+    void test_result_async_wait_for();
+    void test_lazy_result_with_timeout();
+}  // namespace concurrencpp::tests
+
+namespace concurrencpp::tests {
+    result<int> await_with_timeout(result<int>& result,
+                                   std::shared_ptr<timer_queue> timer_queue,
+                                   nanoseconds timeout,
+                                   std::shared_ptr<executor> executor) {
+        co_return co_await result.with_timeout(std::move(timer_queue), timeout, std::move(executor));
+    }
+
+    result<result_status> await_wait_for(result<int>& result,
+                                         std::shared_ptr<timer_queue> timer_queue,
+                                         nanoseconds timeout,
+                                         std::shared_ptr<executor> executor) {
+        co_return co_await result.async_wait_for(std::move(timer_queue), timeout, std::move(executor));
+    }
+
+    result<int> await_lazy_with_timeout(lazy_result<int> lazy,
+                                        std::shared_ptr<timer_queue> timer_queue,
+                                        nanoseconds timeout,
+                                        std::shared_ptr<executor> executor) {
+        co_return co_await lazy.with_timeout(std::move(timer_queue), timeout, std::move(executor));
+    }
+
+    lazy_result<int> delayed_lazy_value(std::shared_ptr<timer_queue> timer_queue, nanoseconds delay, std::shared_ptr<executor> executor) {
+        co_await timer_queue->make_delay_object(delay, std::move(executor));
+        co_return 42;
+    }
+}  // namespace concurrencpp::tests
+
+using namespace concurrencpp::tests;
+
+void concurrencpp::tests::test_result_with_timeout_validation() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto executor = std::make_shared<inline_executor>();
+    executor_shutdowner es(executor);
+
+    assert_throws_with_error_message<errors::empty_result>(
+        [&] {
+            result<int> result;
+            result.with_timeout(timer_queue, 1ms, executor);
+        },
+        concurrencpp::details::consts::k_result_with_timeout_error_msg);
+
+    assert_throws_with_error_message<errors::empty_result>(
+        [&] {
+            result<int> result;
+            result.async_wait_for(timer_queue, 1ms, executor);
+        },
+        concurrencpp::details::consts::k_result_async_wait_for_error_msg);
+
+    result_promise<int> rp;
+    auto result = rp.get_result();
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            result.with_timeout({}, 1ms, executor);
+        },
+        concurrencpp::details::consts::k_result_with_timeout_null_timer_queue_error_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            result.with_timeout(timer_queue, 1ms, {});
+        },
+        concurrencpp::details::consts::k_result_with_timeout_null_executor_error_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            result.async_wait_for({}, 1ms, executor);
+        },
+        concurrencpp::details::consts::k_result_async_wait_for_null_timer_queue_error_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            result.async_wait_for(timer_queue, 1ms, {});
+        },
+        concurrencpp::details::consts::k_result_async_wait_for_null_executor_error_msg);
+
+    assert_throws_with_error_message<errors::empty_result>(
+        [&] {
+            lazy_result<int> lazy;
+            lazy.with_timeout(timer_queue, 1ms, executor);
+        },
+        concurrencpp::details::consts::k_empty_lazy_result_with_timeout_err_msg);
+
+    assert_true(static_cast<bool>(result));
+}
+
+void concurrencpp::tests::test_result_with_timeout_ready_result() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto executor = std::make_shared<inline_executor>();
+    executor_shutdowner es(executor);
+
+    auto result = make_ready_result<int>(42);
+    auto awaiting = await_with_timeout(result, timer_queue, 1h, executor);
+
+    assert_equal(awaiting.status(), result_status::value);
+    assert_equal(awaiting.get(), 42);
+    assert_false(static_cast<bool>(result));
+}
+
+void concurrencpp::tests::test_result_with_timeout_result_first() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto executor = std::make_shared<thread_executor>();
+    executor_shutdowner es(executor);
+
+    result_promise<int> rp;
+    auto result = rp.get_result();
+
+    const auto before = high_resolution_clock::now();
+    auto awaiting = await_with_timeout(result, timer_queue, 10s, executor);
+
+    std::thread producer([&rp] {
+        std::this_thread::sleep_for(20ms);
+        rp.set_result(42);
+    });
+
+    assert_equal(awaiting.get(), 42);
+    assert_smaller(high_resolution_clock::now() - before, 5s);
+    assert_false(static_cast<bool>(result));
+
+    producer.join();
+}
+
+void concurrencpp::tests::test_result_with_timeout_exception() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto executor = std::make_shared<thread_executor>();
+    executor_shutdowner es(executor);
+
+    result_promise<int> rp;
+    auto result = rp.get_result();
+    auto awaiting = await_with_timeout(result, timer_queue, 10s, executor);
+
+    rp.set_exception(std::make_exception_ptr(std::logic_error("error")));
+
+    assert_throws_with_error_message<std::logic_error>(
+        [&awaiting] {
+            awaiting.get();
+        },
+        "error");
+}
+
+void concurrencpp::tests::test_result_with_timeout_timeout_first() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto executor = std::make_shared<thread_executor>();
+    executor_shutdowner es(executor);
+
+    result_promise<int> rp;
+    auto result = rp.get_result();
+
+    const auto before = high_resolution_clock::now();
+    auto awaiting = await_with_timeout(result, timer_queue, 20ms, executor);
+
+    assert_throws_with_error_message<errors::timeout>(
+        [&awaiting] {
+            awaiting.get();
+        },
+        concurrencpp::details::consts::k_result_timeout_error_msg);
+
+    assert_bigger_equal(high_resolution_clock::now() - before, 20ms);
+
+    // the result is left usable
+    assert_true(static_cast<bool>(result));
+    assert_equal(result.status(), result_status::idle);
+
+    rp.set_result(42);
+    assert_equal(result.get(), 42);
+}
+
+void concurrencpp::tests::test_result_with_timeout_shutdown_timer_queue() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto executor = std::make_shared<inline_executor>();
+    executor_shutdowner es(executor);
+
+    timer_queue->shutdown();
+
+    result_promise<int> rp;
+    auto result = rp.get_result();
+    auto awaiting = await_with_timeout(result, timer_queue, 1h, executor);
+
+    assert_throws_with_error_message<errors::runtime_shutdown>(
+        [&awaiting] {
+            awaiting.get();
+        },
+        concurrencpp::details::consts::k_timer_queue_shutdown_err_msg);
+
+    assert_true(static_cast<bool>(result));
+    rp.set_result(42);
+    assert_equal(result.get(), 42);
+}
+
+void concurrencpp::tests::test_result_with_timeout_race() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto executor = std::make_shared<inline_executor>();
+    executor_shutdowner es(executor);
+
+    // the result and the timeout complete at about the same time, exactly one of them wins
+    for (size_t i = 0; i < 1'000; i++) {
+        result_promise<int> rp;
+        auto result = rp.get_result();
+        auto awaiting = await_with_timeout(result, timer_queue, 50us, executor);
+
+        std::this_thread::sleep_for(50us);
+        rp.set_result(static_cast<int>(i));
+
+        try {
+            assert_equal(awaiting.get(), static_cast<int>(i));
+            assert_false(static_cast<bool>(result));
+        } catch (const errors::timeout&) {
+            assert_true(static_cast<bool>(result));
+            assert_equal(result.get(), static_cast<int>(i));
+        }
+    }
+}
+
+void concurrencpp::tests::test_result_async_wait_for() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto executor = std::make_shared<thread_executor>();
+    executor_shutdowner es(executor);
+
+    result_promise<int> rp;
+    auto result = rp.get_result();
+
+    assert_equal(await_wait_for(result, timer_queue, 10ms, executor).get(), result_status::idle);
+    assert_true(static_cast<bool>(result));
+
+    auto awaiting = await_wait_for(result, timer_queue, 10s, executor);
+    rp.set_result(42);
+
+    assert_equal(awaiting.get(), result_status::value);
+
+    // async_wait_for doesn't consume the result
+    assert_equal(await_wait_for(result, timer_queue, 10s, executor).get(), result_status::value);
+    assert_equal(result.get(), 42);
+}
+
+void concurrencpp::tests::test_lazy_result_with_timeout() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto executor = std::make_shared<thread_executor>();
+    executor_shutdowner es(executor);
+
+    auto fast = await_lazy_with_timeout(delayed_lazy_value(timer_queue, 1ms, executor), timer_queue, 10s, executor);
+    assert_equal(fast.get(), 42);
+
+    auto slow = await_lazy_with_timeout(delayed_lazy_value(timer_queue, 200ms, executor), timer_queue, 10ms, executor);
+    assert_throws<errors::timeout>([&slow] {
+        slow.get();
+    });
+
+    // let the detached task finish before the executor is shut down
+    std::this_thread::sleep_for(300ms);
+}
+
+int main() {
+    tester tester("result timeout test");
+
+    tester.add_step("validation", test_result_with_timeout_validation);
+    tester.add_step("with_timeout - ready result", test_result_with_timeout_ready_result);
+    tester.add_step("with_timeout - result first", test_result_with_timeout_result_first);
+    tester.add_step("with_timeout - exception", test_result_with_timeout_exception);
+    tester.add_step("with_timeout - timeout first", test_result_with_timeout_timeout_first);
+    tester.add_step("with_timeout - timer_queue was shut down", test_result_with_timeout_shutdown_timer_queue);
+    tester.add_step("with_timeout - race", test_result_with_timeout_race);
+    tester.add_step("async_wait_for", test_result_async_wait_for);
+    tester.add_step("lazy_result::with_timeout", test_lazy_result_with_timeout);
+
+    tester.launch_test();
+    return 0;
+}
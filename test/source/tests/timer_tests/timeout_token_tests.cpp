@@ -0,0 +1,257 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <cstdlib>
+#include <new>
+
+using namespace std::chrono;
+using namespace std::chrono_literals;
+
+namespace concurrencpp::tests {
+    void test_timeout_token_arm();
+    void test_timeout_token_expire();
+    void test_timeout_token_disarm();
+    void test_timeout_token_rearm();
+    void test_timeout_token_disarm_while_expiring();
+    void test_timeout_token_shutdown();
+    void test_timeout_token_no_allocations();
+}  // namespace concurrencpp::tests
+
+namespace concurrencpp::tests {
+    thread_local size_t tl_allocation_count = 0;
+
+    class flag_callback {
+
+       private:
+        std::atomic_size_t& m_counter;
+
+       public:
+        flag_callback(std::atomic_size_t& counter) noexcept : m_counter(counter) {}
+
+        void operator()() noexcept {
+            m_counter.fetch_add(1, std::memory_order_release);
+            m_counter.notify_all();
+        }
+    };
+
+    void wait_for_count(std::atomic_size_t& counter, size_t count) {
+        for (auto value = counter.load(std::memory_order_acquire); value < count; value = counter.load(std::memory_order_acquire)) {
+            counter.wait(value, std::memory_order_acquire);
+        }
+    }
+}  // namespace concurrencpp::tests
+
+void* operator new(size_t size) {
+    ++concurrencpp::tests::tl_allocation_count;
+
+    if (const auto ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+using namespace concurrencpp::tests;
+
+void concurrencpp::tests::test_timeout_token_arm() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    std::atomic_size_t counter = 0;
+    concurrencpp::timeout_token token(flag_callback {counter});
+
+    assert_false(token.armed());
+    assert_false(token.disarm());
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            token.arm(*timer_queue, 1ms, -1ms);
+        },
+        concurrencpp::details::consts::k_timeout_token_arm_negative_slack_err_msg);
+
+    assert_false(token.armed());
+
+    token.arm(*timer_queue, 1h);
+    assert_true(token.armed());
+
+    timer_queue->shutdown();
+
+    assert_throws_with_error_message<errors::runtime_shutdown>(
+        [&] {
+            token.arm(*timer_queue, 1ms);
+        },
+        concurrencpp::details::consts::k_timer_queue_shutdown_err_msg);
+
+    assert_false(token.armed());
+    assert_equal(counter.load(), 0);
+}
+
+void concurrencpp::tests::test_timeout_token_expire() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    std::atomic_size_t counter = 0;
+    concurrencpp::timeout_token token(flag_callback {counter});
+
+    const auto before = high_resolution_clock::now();
+    token.arm(*timer_queue, 20ms);
+
+    wait_for_count(counter, 1);
+    assert_bigger_equal(high_resolution_clock::now() - before, 20ms);
+
+    assert_false(token.armed());
+    assert_false(token.disarm());
+
+    // a token with slack expires within its window, never before its deadline
+    const auto before_slack = high_resolution_clock::now();
+    token.arm(*timer_queue, 10ms, 5ms);
+
+    wait_for_count(counter, 2);
+    assert_bigger_equal(high_resolution_clock::now() - before_slack, 10ms);
+}
+
+void concurrencpp::tests::test_timeout_token_disarm() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    std::atomic_size_t counter = 0;
+
+    {
+        concurrencpp::timeout_token token(flag_callback {counter});
+        token.arm(*timer_queue, 20ms);
+        assert_true(token.disarm());
+        assert_false(token.armed());
+        assert_false(token.disarm());
+    }
+
+    {
+        // the destructor disarms the token
+        concurrencpp::timeout_token token(flag_callback {counter});
+        token.arm(*timer_queue, 20ms);
+    }
+
+    std::this_thread::sleep_for(50ms);
+    assert_equal(counter.load(), 0);
+}
+
+void concurrencpp::tests::test_timeout_token_rearm() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    std::atomic_size_t counter = 0;
+    concurrencpp::timeout_token token(flag_callback {counter});
+
+    // re-arming replaces the previous deadline
+    token.arm(*timer_queue, 1h);
+    token.arm(*timer_queue, 5ms);
+    wait_for_count(counter, 1);
+
+    // an earlier deadline wakes up a worker that's waiting for a later one
+    concurrencpp::timeout_token late_token(flag_callback {counter});
+    late_token.arm(*timer_queue, 1h);
+    token.arm(*timer_queue, 5ms);
+    wait_for_count(counter, 2);
+
+    assert_true(late_token.disarm());
+
+    // a token can re-arm itself from its callable
+    std::atomic_size_t self_counter = 0;
+    concurrencpp::timer_queue* queue_ptr = timer_queue.get();
+    concurrencpp::details::timeout_token_base* self = nullptr;
+
+    concurrencpp::timeout_token self_arming_token([&]() noexcept {
+        if (self_counter.fetch_add(1, std::memory_order_acq_rel) + 1 < 3) {
+            self->arm(*queue_ptr, 1ms);
+        }
+
+        self_counter.notify_all();
+    });
+
+    self = &self_arming_token;
+    self_arming_token.arm(*timer_queue, 1ms);
+
+    wait_for_count(self_counter, 3);
+    std::this_thread::sleep_for(10ms);
+    assert_equal(self_counter.load(), 3);
+    assert_false(self_arming_token.armed());
+}
+
+void concurrencpp::tests::test_timeout_token_disarm_while_expiring() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    std::atomic_bool started = false, finished = false;
+
+    concurrencpp::timeout_token token([&]() noexcept {
+        started.store(true, std::memory_order_release);
+        started.notify_all();
+
+        std::this_thread::sleep_for(50ms);
+        finished.store(true, std::memory_order_release);
+    });
+
+    token.arm(*timer_queue, 1ms);
+    started.wait(false, std::memory_order_acquire);
+
+    // the token has expired, disarm waits for the callable to return
+    assert_false(token.disarm());
+    assert_true(finished.load(std::memory_order_acquire));
+}
+
+void concurrencpp::tests::test_timeout_token_shutdown() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s, nullptr, nullptr, 2);
+    std::atomic_size_t counter = 0;
+
+    concurrencpp::timeout_token token_0(flag_callback {counter});
+    concurrencpp::timeout_token token_1(flag_callback {counter});
+
+    token_0.arm(*timer_queue, 20ms);
+    token_1.arm(*timer_queue, 1h);
+
+    timer_queue->shutdown();
+
+    assert_false(token_0.armed());
+    assert_false(token_1.armed());
+    assert_false(token_0.disarm());
+
+    std::this_thread::sleep_for(50ms);
+    assert_equal(counter.load(), 0);
+}
+
+void concurrencpp::tests::test_timeout_token_no_allocations() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    std::atomic_size_t counter = 0;
+    concurrencpp::timeout_token token(flag_callback {counter});
+
+    // the first arm starts the worker thread
+    token.arm(*timer_queue, 1h);
+
+    const auto allocations_before = tl_allocation_count;
+    for (size_t i = 0; i < 10'000; i++) {
+        token.arm(*timer_queue, 10s + i * 1us);
+        assert_true(token.disarm());
+    }
+
+    token.arm(*timer_queue, 1ms);
+    wait_for_count(counter, 1);
+
+    assert_equal(tl_allocation_count, allocations_before);
+}
+
+int main() {
+    tester test("timeout_token test");
+
+    test.add_step("arm", test_timeout_token_arm);
+    test.add_step("expire", test_timeout_token_expire);
+    test.add_step("disarm", test_timeout_token_disarm);
+    test.add_step("rearm", test_timeout_token_rearm);
+    test.add_step("disarm while expiring", test_timeout_token_disarm_while_expiring);
+    test.add_step("shutdown", test_timeout_token_shutdown);
+    test.add_step("no allocations", test_timeout_token_no_allocations);
+
+    test.launch_test();
+    return 0;
+}
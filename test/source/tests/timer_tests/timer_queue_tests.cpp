@@ -1,4 +1,5 @@
 #include "concurrencpp/concurrencpp.h"
+#include "concurrencpp/timers/impl/timerfd_poller.h"
 
 #include "infra/tester.h"
 #include "infra/assertions.h"
@@ -6,6 +7,8 @@
 #include "utils/executor_shutdowner.h"
 
 #include <chrono>
+#include <thread>
+#include <vector>
 
 using namespace std::chrono_literals;
 
@@ -16,6 +19,11 @@ namespace concurrencpp::tests {
     void test_timer_queue_max_worker_idle_time();
     void test_timer_queue_thread_injection();
     void test_timer_queue_thread_callbacks();
+    void test_timer_queue_sharding();
+    void test_timer_queue_timerfd_backend();
+    void test_timer_queue_concurrent_add_cancel();
+    void test_timer_queue_cancel_while_idle();
+    void test_timer_queue_make_inline_timer();
 }  // namespace concurrencpp::tests
 
 void concurrencpp::tests::test_timer_queue_make_timer() {
@@ -29,6 +37,14 @@ void concurrencpp::tests::test_timer_queue_make_timer() {
         },
         concurrencpp::details::consts::k_timer_queue_make_timer_executor_null_err_msg);
 
+    assert_throws_with_error_message<std::invalid_argument>(
+        [timer_queue] {
+            auto inline_executor = std::make_shared<concurrencpp::inline_executor>();
+            timer_queue->make_timer(100ms, 100ms, -1ms, inline_executor, [] {
+            });
+        },
+        concurrencpp::details::consts::k_timer_queue_make_timer_negative_slack_err_msg);
+
     timer_queue->shutdown();
     assert_true(timer_queue->shutdown_requested());
 
@@ -52,6 +68,14 @@ void concurrencpp::tests::test_timer_queue_make_oneshot_timer() {
         },
         concurrencpp::details::consts::k_timer_queue_make_oneshot_timer_executor_null_err_msg);
 
+    assert_throws_with_error_message<std::invalid_argument>(
+        [timer_queue] {
+            auto inline_executor = std::make_shared<concurrencpp::inline_executor>();
+            timer_queue->make_one_shot_timer(100ms, -1ms, inline_executor, [] {
+            });
+        },
+        concurrencpp::details::consts::k_timer_queue_make_oneshot_timer_negative_slack_err_msg);
+
     timer_queue->shutdown();
     assert_true(timer_queue->shutdown_requested());
 
@@ -142,6 +166,287 @@ void concurrencpp::tests::test_timer_queue_thread_callbacks() {
     assert_equal(thread_terminated_callback_invocations_num, 1);
 }
 
+void concurrencpp::tests::test_timer_queue_sharding() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            concurrencpp::timer_queue timer_queue(50ms, {}, {}, 0);
+        },
+        concurrencpp::details::consts::k_timer_queue_zero_shard_count_err_msg);
+
+    constexpr size_t shard_count = 4;
+    constexpr size_t thread_count = 8;
+    constexpr size_t timers_per_thread = 16;
+
+    std::atomic_size_t thread_started_callback_invocations_num = 0;
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(
+        120s,
+        [&thread_started_callback_invocations_num](std::string_view) {
+            ++thread_started_callback_invocations_num;
+        },
+        nullptr,
+        shard_count);
+
+    assert_equal(timer_queue->shard_count(), shard_count);
+
+    auto inline_executor = std::make_shared<concurrencpp::inline_executor>();
+    executor_shutdowner es(inline_executor);
+
+    std::atomic_size_t fired = 0, cancelled_fired = 0;
+    std::vector<std::vector<concurrencpp::timer>> timers(thread_count);
+    std::vector<concurrencpp::timer> cancelled_timers(thread_count);
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0; i < thread_count; i++) {
+        threads.emplace_back([&, i] {
+            for (size_t j = 0; j < timers_per_thread; j++) {
+                timers[i].emplace_back(timer_queue->make_one_shot_timer(1ms + j * 100us, inline_executor, [&fired] {
+                    ++fired;
+                }));
+            }
+
+            cancelled_timers[i] = timer_queue->make_one_shot_timer(100ms, inline_executor, [&cancelled_fired] {
+                ++cancelled_fired;
+            });
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // every calling thread picked a shard, each shard got a thread of its own
+    assert_equal(thread_started_callback_invocations_num, shard_count);
+
+    // timers are cancelled through the shard they were added to, not the one of the cancelling thread
+    for (auto& timer : cancelled_timers) {
+        timer.cancel();
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + 10s;
+    while (fired != thread_count * timers_per_thread && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(1ms);
+    }
+
+    assert_equal(fired, thread_count * timers_per_thread);
+
+    std::this_thread::sleep_for(200ms);
+    assert_equal(cancelled_fired, 0);
+
+    timer_queue->shutdown();
+}
+
+void concurrencpp::tests::test_timer_queue_timerfd_backend() {
+    if (!concurrencpp::details::timerfd_poller::supported()) {
+        assert_throws_with_error_message<std::invalid_argument>(
+            [] {
+                concurrencpp::timer_queue timer_queue(50ms, {}, {}, 1, concurrencpp::timer_queue_backend::timerfd);
+            },
+            concurrencpp::details::consts::k_timerfd_poller_unsupported_err_msg);
+        return;
+    }
+
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(50ms, nullptr, nullptr, 2, concurrencpp::timer_queue_backend::timerfd);
+    assert_equal(timer_queue->backend(), concurrencpp::timer_queue_backend::timerfd);
+
+    auto inline_executor = std::make_shared<concurrencpp::inline_executor>();
+    executor_shutdowner es(inline_executor);
+
+    const auto wait_for_count = [](const std::atomic_size_t& counter, size_t count) {
+        const auto deadline = std::chrono::steady_clock::now() + 10s;
+        while (counter < count && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(1ms);
+        }
+    };
+
+    // the timer threads become idle and are re-created between the rounds
+    for (size_t round = 0; round < 2; round++) {
+        std::atomic_size_t fired = 0, periodic_fired = 0, cancelled_fired = 0;
+
+        const auto before = concurrencpp::timer_queue::clock_type::now();
+        auto one_shot = timer_queue->make_one_shot_timer(20ms, inline_executor, [&fired, before] {
+            assert_bigger_equal(concurrencpp::timer_queue::clock_type::now(), before + 20ms);
+            ++fired;
+        });
+
+        auto periodic = timer_queue->make_timer(1ms, 1ms, inline_executor, [&periodic_fired] {
+            ++periodic_fired;
+        });
+
+        auto cancelled = timer_queue->make_one_shot_timer(50ms, inline_executor, [&cancelled_fired] {
+            ++cancelled_fired;
+        });
+
+        cancelled.cancel();
+
+        wait_for_count(fired, 1);
+        wait_for_count(periodic_fired, 10);
+        periodic.cancel();
+
+        assert_equal(fired, 1);
+        assert_bigger_equal(periodic_fired, 10);
+
+        std::this_thread::sleep_for(timer_queue->max_worker_idle_time() + 100ms);
+        assert_equal(cancelled_fired, 0);
+    }
+
+    timer_queue->shutdown();
+
+    assert_throws_with_error_message<errors::runtime_shutdown>(
+        [timer_queue, inline_executor] {
+            timer_queue->make_one_shot_timer(1ms, inline_executor, [] {
+            });
+        },
+        concurrencpp::details::consts::k_timer_queue_shutdown_err_msg);
+}
+
+void concurrencpp::tests::test_timer_queue_concurrent_add_cancel() {
+    constexpr size_t thread_count = 8;
+    constexpr size_t timers_per_thread = 512;
+
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto inline_executor = std::make_shared<concurrencpp::inline_executor>();
+    executor_shutdowner es(inline_executor);
+
+    object_observer cancelled_observer;
+    std::atomic_size_t fired = 0;
+    std::vector<std::vector<concurrencpp::timer>> timers(thread_count);
+    std::vector<std::thread> threads;
+
+    // every thread adds timers that fire soon and timers that are cancelled right away, racing with the timer thread
+    // that takes the requests in batches.
+    for (size_t i = 0; i < thread_count; i++) {
+        threads.emplace_back([&, i] {
+            for (size_t j = 0; j < timers_per_thread; j++) {
+                auto cancelled = timer_queue->make_one_shot_timer(1h, inline_executor, cancelled_observer.get_testing_stub());
+                cancelled.cancel();
+
+                timers[i].emplace_back(timer_queue->make_one_shot_timer(1ms + (j % 16) * 100us, inline_executor, [&fired] {
+                    ++fired;
+                }));
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + 10s;
+    while (fired != thread_count * timers_per_thread && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(1ms);
+    }
+
+    assert_equal(fired, thread_count * timers_per_thread);
+
+    // cancelled timers are released by the timer thread without waiting for their due time
+    assert_true(cancelled_observer.wait_destruction_count(thread_count * timers_per_thread, 10s));
+    assert_equal(cancelled_observer.get_execution_count(), 0);
+
+    timer_queue->shutdown();
+}
+
+void concurrencpp::tests::test_timer_queue_cancel_while_idle() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(50ms);
+    auto inline_executor = std::make_shared<concurrencpp::inline_executor>();
+    executor_shutdowner es(inline_executor);
+
+    object_observer observer;
+    std::vector<concurrencpp::timer> timers;
+
+    for (size_t i = 0; i < 16; i++) {
+        timers.emplace_back(timer_queue->make_one_shot_timer(10ms, inline_executor, observer.get_testing_stub()));
+    }
+
+    assert_true(observer.wait_execution_count(16, 10s));
+
+    // the worker goes idle once every timer fired. the removals of the cancellation don't wait for the next worker.
+    std::this_thread::sleep_for(timer_queue->max_worker_idle_time() + 100ms);
+    timers.clear();
+
+    assert_equal(observer.get_destruction_count(), 16);
+
+    timer_queue->shutdown();
+}
+
+void concurrencpp::tests::test_timer_queue_make_inline_timer() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [timer_queue] {
+            timer_queue->make_inline_timer(1ms, 1ms, -1ms, [] {
+            });
+        },
+        concurrencpp::details::consts::k_timer_queue_make_inline_timer_negative_budget_err_msg);
+
+    const auto wait_for_count = [](const std::atomic_size_t& counter, size_t count) {
+        const auto deadline = std::chrono::steady_clock::now() + 10s;
+        while (counter < count && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(1ms);
+        }
+    };
+
+    // inline callbacks run on the timer thread itself, one after the other
+    std::atomic_size_t fired = 0;
+    std::thread::id first_thread;
+    std::atomic_bool same_thread = true;
+
+    auto timer = timer_queue->make_inline_timer(1ms, 1ms, 1s, [&] {
+        const auto id = std::this_thread::get_id();
+        if (fired == 0) {
+            first_thread = id;
+        }
+
+        if (id != first_thread) {
+            same_thread = false;
+        }
+        ++fired;
+    });
+
+    assert_equal(timer.get_executor(), std::shared_ptr<concurrencpp::executor>());
+
+    wait_for_count(fired, 20);
+    timer.cancel();
+
+    assert_bigger_equal(fired, 20);
+    assert_true(same_thread);
+    assert_not_equal(first_thread, std::this_thread::get_id());
+    assert_equal(timer_queue->inline_timer_overruns(), 0);
+
+    // a callback that runs longer than its budget is counted, and doesn't stop the timer
+    const auto overruns_before = timer_queue->inline_timer_overruns();
+    std::atomic_size_t slow_fired = 0;
+    auto slow_timer = timer_queue->make_inline_timer(1ms, 5ms, 100us, [&slow_fired] {
+        std::this_thread::sleep_for(1ms);
+        ++slow_fired;
+    });
+
+    wait_for_count(slow_fired, 3);
+    slow_timer.cancel();
+
+    assert_bigger_equal(slow_fired, 3);
+    assert_bigger_equal(timer_queue->inline_timer_overruns() - overruns_before, 3);
+
+    // exceptions thrown by inline callbacks are swallowed
+    std::atomic_size_t throwing_fired = 0;
+    auto throwing_timer = timer_queue->make_inline_timer(1ms, 1ms, 1s, [&throwing_fired] {
+        ++throwing_fired;
+        throw std::runtime_error("");
+    });
+
+    wait_for_count(throwing_fired, 3);
+    throwing_timer.cancel();
+    assert_bigger_equal(throwing_fired, 3);
+
+    timer_queue->shutdown();
+
+    assert_throws_with_error_message<errors::runtime_shutdown>(
+        [timer_queue] {
+            timer_queue->make_inline_timer(1ms, 1ms, 1s, [] {
+            });
+        },
+        concurrencpp::details::consts::k_timer_queue_shutdown_err_msg);
+}
+
 using namespace concurrencpp::tests;
 
 int main() {
@@ -153,6 +458,11 @@ int main() {
     test.add_step("max_worker_idle_time", test_timer_queue_max_worker_idle_time);
     test.add_step("thread_injection", test_timer_queue_thread_injection);
     test.add_step("thread_callbacks", test_timer_queue_thread_callbacks);
+    test.add_step("sharding", test_timer_queue_sharding);
+    test.add_step("timerfd backend", test_timer_queue_timerfd_backend);
+    test.add_step("concurrent add and cancel", test_timer_queue_concurrent_add_cancel);
+    test.add_step("cancel while idle", test_timer_queue_cancel_while_idle);
+    test.add_step("make_inline_timer", test_timer_queue_make_inline_timer);
 
     test.launch_test();
     return 0;
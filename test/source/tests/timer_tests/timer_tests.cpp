@@ -68,8 +68,11 @@ namespace concurrencpp::tests {
             task();
         }
 
-        void enqueue(std::span<concurrencpp::task>) override {
-            // do nothing
+        void enqueue(std::span<concurrencpp::task> tasks) override {
+            // timers that are fired together are enqueued as one batch.
+            for (auto& task : tasks) {
+                enqueue(std::move(task));
+            }
         }
 
         int max_concurrency_level() const noexcept override {
@@ -112,8 +115,11 @@ namespace concurrencpp::tests {
             task();
         }
 
-        void enqueue(std::span<concurrencpp::task>) override {
-            // do nothing
+        void enqueue(std::span<concurrencpp::task> tasks) override {
+            // timers that are fired together are enqueued as one batch.
+            for (auto& task : tasks) {
+                enqueue(std::move(task));
+            }
         }
 
         int max_concurrency_level() const noexcept override {
@@ -168,6 +174,7 @@ namespace concurrencpp::tests {
 
         void assert_timer_stats() noexcept {
             assert_equal(m_timer.get_due_time(), m_due_time);
+            assert_equal(m_timer.get_slack(), std::chrono::nanoseconds::zero());
             assert_equal(m_timer.get_frequency(), m_frequency);
             assert_equal(m_timer.get_executor().get(), m_executor.get());
             assert_equal(m_timer.get_timer_queue().lock(), m_timer_queue);
@@ -0,0 +1,348 @@
+#include "concurrencpp/concurrencpp.h"
+#include "concurrencpp/timers/impl/timer_wheel.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/throwing_executor.h"
+
+#include <chrono>
+#include <vector>
+
+using namespace std::chrono;
+using namespace std::chrono_literals;
+
+namespace concurrencpp::tests {
+    void test_timer_wheel_add();
+    void test_timer_wheel_cascading();
+    void test_timer_wheel_remove();
+    void test_timer_wheel_next_deadline();
+    void test_timer_wheel_periodic_timer();
+    void test_timer_wheel_slack();
+    void test_timer_wheel_batched_enqueue();
+    void test_timer_wheel_destructor();
+}  // namespace concurrencpp::tests
+
+using concurrencpp::details::timer_wheel;
+using concurrencpp::details::timer_state;
+using concurrencpp::details::timer_state_base;
+
+namespace concurrencpp::tests {
+    class counting_callback {
+
+       private:
+        size_t& m_counter;
+
+       public:
+        counting_callback(size_t& counter) noexcept : m_counter(counter) {}
+
+        void operator()() noexcept {
+            ++m_counter;
+        }
+    };
+
+    struct batch_counting_executor : public executor {
+        size_t enqueue_calls = 0;
+        size_t batch_enqueue_calls = 0;
+
+        batch_counting_executor() : executor("batch_counting_executor") {}
+
+        void enqueue(concurrencpp::task task) override {
+            ++enqueue_calls;
+            task();
+        }
+
+        void enqueue(std::span<concurrencpp::task> tasks) override {
+            ++batch_enqueue_calls;
+            for (auto& task : tasks) {
+                task();
+            }
+        }
+
+        int max_concurrency_level() const noexcept override {
+            return 0;
+        }
+
+        bool shutdown_requested() const noexcept override {
+            return false;
+        }
+
+        void shutdown() noexcept override {
+            // do nothing
+        }
+    };
+
+    std::shared_ptr<timer_state_base> make_timer_state(const std::shared_ptr<executor>& executor,
+                                                       nanoseconds due_time,
+                                                       size_t& counter,
+                                                       nanoseconds frequency = nanoseconds::zero(),
+                                                       nanoseconds slack = nanoseconds::zero()) {
+        return std::make_shared<timer_state<counting_callback>>(due_time,
+                                                                frequency,
+                                                                executor,
+                                                                std::weak_ptr<timer_queue> {},
+                                                                frequency == nanoseconds::zero(),
+                                                                counting_callback(counter),
+                                                                slack);
+    }
+}  // namespace concurrencpp::tests
+
+using namespace concurrencpp::tests;
+
+void concurrencpp::tests::test_timer_wheel_add() {
+    const auto executor = std::make_shared<inline_executor>();
+    timer_wheel wheel;
+    size_t counter = 0;
+
+    assert_true(wheel.empty());
+
+    wheel.add(make_timer_state(executor, 0ms, counter));
+    wheel.add(make_timer_state(executor, 50ms, counter));
+    assert_equal(wheel.size(), 2);
+
+    // deadlines are rounded up to the next tick
+    wheel.process_timers(timer_wheel::clock_type::now() + timer_wheel::k_tick);
+    assert_equal(counter, 1);
+    assert_equal(wheel.size(), 1);
+}
+
+void concurrencpp::tests::test_timer_wheel_cascading() {
+    // due times that land on every level, on level boundaries and in the overflow slot
+    const std::vector<microseconds> due_times = {1us,
+                                                 2us,
+                                                 255us,
+                                                 256us,
+                                                 300us,
+                                                 511us,
+                                                 65'535us,
+                                                 65'536us,
+                                                 70'000us,
+                                                 16'777'216us,
+                                                 16'777'300us,
+                                                 4'294'967'296us,
+                                                 4'294'967'296us + 1'000us};
+
+    const auto executor = std::make_shared<inline_executor>();
+    timer_wheel wheel;
+
+    std::vector<size_t> counters(due_times.size());
+    std::vector<std::shared_ptr<timer_state_base>> timers;
+    for (size_t i = 0; i < due_times.size(); i++) {
+        timers.emplace_back(make_timer_state(executor, due_times[i], counters[i]));
+        wheel.add(timers.back());
+    }
+
+    for (size_t i = 0; i < timers.size(); i++) {
+        const auto deadline = timers[i]->get_deadline();
+
+        wheel.process_timers(deadline - 1ns);
+        assert_equal(counters[i], 0);
+
+        wheel.process_timers(deadline + timer_wheel::k_tick);
+        for (size_t j = 0; j < counters.size(); j++) {
+            assert_equal(counters[j], (j <= i) ? 1 : 0);
+        }
+
+        assert_equal(wheel.size(), timers.size() - i - 1);
+    }
+
+    assert_true(wheel.empty());
+}
+
+void concurrencpp::tests::test_timer_wheel_remove() {
+    const auto executor = std::make_shared<inline_executor>();
+    const auto origin = timer_wheel::clock_type::now();
+    timer_wheel wheel(origin);
+    size_t counter = 0;
+
+    std::vector<std::shared_ptr<timer_state_base>> timers;
+    for (size_t i = 0; i < 1'024; i++) {
+        timers.emplace_back(make_timer_state(executor, 10us + i * 97us, counter));
+        wheel.add(timers.back());
+    }
+
+    // remove every other timer, from the head, middle and tail of their slots
+    for (size_t i = 0; i < timers.size(); i += 2) {
+        timers[i]->cancel();
+        wheel.remove(timers[i]);
+    }
+
+    assert_equal(wheel.size(), timers.size() / 2);
+
+    // removing a timer twice or after it was fired is a no-op
+    wheel.remove(timers[0]);
+    assert_equal(wheel.size(), timers.size() / 2);
+
+    wheel.process_timers(origin + hours(1));
+    assert_equal(counter, timers.size() / 2);
+    assert_true(wheel.empty());
+
+    for (const auto& timer : timers) {
+        assert_equal(timer.use_count(), 1);
+    }
+}
+
+void concurrencpp::tests::test_timer_wheel_next_deadline() {
+    const auto executor = std::make_shared<inline_executor>();
+    const auto origin = timer_wheel::clock_type::now();
+    timer_wheel wheel(origin);
+    size_t counter = 0;
+
+    const auto now = origin + milliseconds(1);
+    assert_bigger_equal(wheel.process_timers(now), now + hours(1));
+
+    // following the returned deadlines fires a timer on time, with a bounded number of wake-ups for cascading
+    const nanoseconds due_times[] = {100us, 100ms, 10s, 2h};
+    for (const auto due_time : due_times) {
+        const auto timer = make_timer_state(executor, due_time, counter);
+        const auto expected_count = counter + 1;
+        wheel.add(timer);
+
+        auto next_deadline = wheel.process_timers(now);
+        for (size_t i = 0; i < 8 && counter != expected_count; i++) {
+            assert_smaller_equal(next_deadline, timer->get_deadline() + timer_wheel::k_tick);
+
+            const auto process_time = next_deadline;
+            next_deadline = wheel.process_timers(process_time);
+
+            if (counter == expected_count) {
+                assert_bigger_equal(process_time, timer->get_deadline());
+            }
+        }
+
+        assert_equal(counter, expected_count);
+        assert_true(wheel.empty());
+    }
+}
+
+void concurrencpp::tests::test_timer_wheel_periodic_timer() {
+    const auto executor = std::make_shared<inline_executor>();
+    timer_wheel wheel;
+    size_t counter = 0;
+
+    const auto timer = make_timer_state(executor, 0ms, counter, 1ms);
+    wheel.add(timer);
+
+    const auto deadline = timer_wheel::clock_type::now() + milliseconds(50);
+    while (timer_wheel::clock_type::now() < deadline) {
+        wheel.process_timers(timer_wheel::clock_type::now());
+    }
+
+    assert_bigger(counter, 25);  // the deadline of a periodic timer drifts by the time it takes to process it, and the thread can be preempted
+    assert_smaller_equal(counter, 52);
+    assert_equal(wheel.size(), 1);
+
+    timer->cancel();
+    wheel.remove(timer);
+    assert_true(wheel.empty());
+    assert_equal(timer.use_count(), 1);
+}
+
+void concurrencpp::tests::test_timer_wheel_slack() {
+    const auto executor = std::make_shared<inline_executor>();
+    const auto origin = timer_wheel::clock_type::now();
+    timer_wheel wheel(origin);
+    size_t counter = 0;
+
+    // staggered deadlines whose slack windows overlap are fired in a single wake-up, never before their deadline
+    std::vector<std::shared_ptr<timer_state_base>> timers;
+    for (size_t i = 0; i < 16; i++) {
+        timers.emplace_back(make_timer_state(executor, 10ms + i * 50us, counter, 0ms, 5ms));
+        wheel.add(timers.back());
+    }
+
+    const auto& last_timer = timers.back();
+    auto next_deadline = wheel.process_timers(origin);
+    while (counter == 0) {
+        assert_smaller_equal(next_deadline, timers.front()->get_deadline() + 5ms + timer_wheel::k_tick);
+        next_deadline = wheel.process_timers(next_deadline);
+    }
+
+    assert_equal(counter, timers.size());
+    assert_true(wheel.empty());
+
+    // without slack, every timer gets a wake-up of its own
+    counter = 0;
+    size_t wake_ups = 0;
+    for (size_t i = 0; i < 16; i++) {
+        wheel.add(make_timer_state(executor, 20ms + i * 50us, counter));
+    }
+
+    next_deadline = wheel.process_timers(last_timer->get_deadline());
+    while (!wheel.empty()) {
+        const auto fired_before = counter;
+        next_deadline = wheel.process_timers(next_deadline);
+        wake_ups += (counter != fired_before) ? 1 : 0;
+    }
+
+    assert_equal(counter, 16);
+    assert_equal(wake_ups, 16);
+}
+
+void concurrencpp::tests::test_timer_wheel_batched_enqueue() {
+    const auto executor_0 = std::make_shared<batch_counting_executor>();
+    const auto executor_1 = std::make_shared<batch_counting_executor>();
+    const auto origin = timer_wheel::clock_type::now();
+    timer_wheel wheel(origin);
+    size_t counter = 0;
+
+    for (size_t i = 0; i < 64; i++) {
+        const auto& executor = (i % 2 == 0) ? executor_0 : executor_1;
+        wheel.add(make_timer_state(executor, 1ms + i * 10us, counter));
+    }
+
+    wheel.process_timers(origin + 10ms);
+
+    assert_equal(counter, 64);
+    assert_equal(executor_0->enqueue_calls, 0);
+    assert_equal(executor_0->batch_enqueue_calls, 1);
+    assert_equal(executor_1->enqueue_calls, 0);
+    assert_equal(executor_1->batch_enqueue_calls, 1);
+
+    // an executor that throws doesn't prevent the other executors from getting their tasks
+    const auto throwing_executor = std::make_shared<concurrencpp::tests::throwing_executor>();
+    wheel.add(make_timer_state(throwing_executor, 11ms, counter));
+    wheel.add(make_timer_state(executor_0, 11ms, counter));
+    wheel.add(make_timer_state(executor_1, 11ms, counter));
+
+    assert_throws<executor_enqueue_exception>([&] {
+        wheel.process_timers(origin + 20ms);
+    });
+
+    assert_equal(counter, 66);
+    assert_true(wheel.empty());
+}
+
+void concurrencpp::tests::test_timer_wheel_destructor() {
+    const auto executor = std::make_shared<inline_executor>();
+    size_t counter = 0;
+    std::vector<std::shared_ptr<timer_state_base>> timers;
+
+    {
+        timer_wheel wheel;
+        for (size_t i = 0; i < 64; i++) {
+            timers.emplace_back(make_timer_state(executor, i * 1'000h, counter));
+            wheel.add(timers.back());
+        }
+    }
+
+    assert_equal(counter, 0);
+    for (const auto& timer : timers) {
+        assert_equal(timer.use_count(), 1);
+    }
+}
+
+int main() {
+    tester test("timer_wheel test");
+
+    test.add_step("add", test_timer_wheel_add);
+    test.add_step("cascading", test_timer_wheel_cascading);
+    test.add_step("remove", test_timer_wheel_remove);
+    test.add_step("next deadline", test_timer_wheel_next_deadline);
+    test.add_step("periodic timer", test_timer_wheel_periodic_timer);
+    test.add_step("slack", test_timer_wheel_slack);
+    test.add_step("batched enqueue", test_timer_wheel_batched_enqueue);
+    test.add_step("destructor", test_timer_wheel_destructor);
+
+    test.launch_test();
+    return 0;
+}